@@ -0,0 +1,46 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __CLOCKWATCH_HPP
+#define __CLOCKWATCH_HPP
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+// Wall clock steps, resume from suspend and a replaced zone file as pollable events
+// (timerfd, inotify); Linux only, elsewhere fds () is empty
+
+namespace dotname {
+
+  constexpr unsigned kClockStepped = 1; // settime, NTP step
+  constexpr unsigned kClockResumed = 2; // the machine was suspended
+  constexpr unsigned kZoneChanged = 4;  // the zone file was replaced, tzset () already ran
+
+  class ClockWatch {
+  public:
+    explicit ClockWatch (const std::filesystem::path& zoneFile = "/etc/localtime");
+    ~ClockWatch ();
+
+    ClockWatch (const ClockWatch&) = delete;
+    ClockWatch& operator= (const ClockWatch&) = delete;
+
+    // descriptors to poll () for POLLIN
+    std::vector<int> fds () const;
+    // Drains the descriptors without blocking, a mask of kClockStepped, kClockResumed and
+    // kZoneChanged; 0 when nothing happened
+    unsigned check ();
+
+  private:
+    int arm ();
+
+    int timerFd_ = -1;
+    int zoneFd_ = -1;
+    std::string zoneName_;
+    std::int64_t suspendedNs_ = 0; // CLOCK_BOOTTIME - CLOCK_MONOTONIC at the last check
+  };
+
+} // namespace dotname
+
+#endif // __CLOCKWATCH_HPP
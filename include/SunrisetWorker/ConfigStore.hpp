@@ -0,0 +1,93 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __CONFIGSTORE_HPP
+#define __CONFIGSTORE_HPP
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+// config.json as a transaction: set () values, commit () them in one atomic write, none
+// when nothing changed; ConfigWatcher reports edits of the file
+
+namespace dotname {
+
+  struct ConfigStoreStats {
+    std::uint64_t loads = 0;
+    std::uint64_t writes = 0;  // commits that wrote the file
+    std::uint64_t skipped = 0; // commits with nothing to write
+  };
+
+  class ConfigStore {
+  public:
+    explicit ConfigStore (const std::filesystem::path& file = {});
+    ConfigStore (ConfigStore&&) noexcept;
+    ConfigStore& operator= (ConfigStore&&) noexcept;
+    ~ConfigStore ();
+
+    ConfigStore (const ConfigStore&) = delete;
+    ConfigStore& operator= (const ConfigStore&) = delete;
+
+    // 0 on success, -1 when the file is missing or not a JSON object (logged); the
+    // store is empty and dirty then, the next commit () writes it. Discards uncommitted
+    // changes
+    int load ();
+    // 0 on success or when clean, -1 when the file cannot be written (logged)
+    int commit ();
+
+    // fallback when the key is missing or holds another type
+    double get (const std::string& key, double fallback) const;
+    int get (const std::string& key, int fallback) const;
+    std::string get (const std::string& key, const std::string& fallback) const;
+    std::vector<std::string> get (const std::string& key,
+                                  const std::vector<std::string>& fallback) const;
+
+    void set (const std::string& key, double value);
+    void set (const std::string& key, int value);
+    void set (const std::string& key, const std::string& value);
+    void set (const std::string& key, const std::vector<std::string>& value);
+
+    bool dirty () const {
+      return dirty_;
+    }
+    const std::filesystem::path& path () const {
+      return file_;
+    }
+    const ConfigStoreStats& stats () const {
+      return stats_;
+    }
+
+  private:
+    struct Values; // the parsed JSON object
+    std::filesystem::path file_;
+    std::unique_ptr<Values> values_;
+    bool dirty_ = false;
+    ConfigStoreStats stats_;
+  };
+
+  class ConfigWatcher {
+  public:
+    explicit ConfigWatcher (const std::filesystem::path& file);
+    ~ConfigWatcher ();
+
+    ConfigWatcher (const ConfigWatcher&) = delete;
+    ConfigWatcher& operator= (const ConfigWatcher&) = delete;
+
+    // pollable descriptor, -1 where inotify is not available
+    int fd () const {
+      return fd_;
+    }
+    // Reads the pending events without blocking, true when one concerned the file
+    bool changed ();
+
+  private:
+    int fd_ = -1;
+    std::string name_;
+  };
+
+} // namespace dotname
+
+#endif // __CONFIGSTORE_HPP
@@ -0,0 +1,54 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __DCONFWRITER_HPP
+#define __DCONFWRITER_HPP
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+// dconf keys written in process through the ca.desrt.dconf Writer on the session bus,
+// one changeset per write ()
+
+namespace dotname {
+
+  namespace dbus {
+    class Connection;
+  }
+
+  class DconfWriter {
+  public:
+    DconfWriter ();
+    ~DconfWriter ();
+
+    DconfWriter (const DconfWriter&) = delete;
+    DconfWriter& operator= (const DconfWriter&) = delete;
+
+    // An empty address uses DBUS_SESSION_BUS_ADDRESS. 0 on success, -1 when the bus is
+    // not reachable (see error ())
+    int connect (const std::string& address = {});
+    bool isConnected () const;
+
+    // Sets the keys (absolute dconf paths) to GVariant string values in one Change call,
+    // connecting first if needed. 0 when dconf accepted the changeset, -1 otherwise
+    int write (const std::vector<std::pair<std::string, std::string>>& keys,
+               int timeoutMs = 2000);
+
+    // color-scheme and gtk-theme of org.gnome.desktop.interface in one transaction
+    int switchLightTheme (bool lightTheme);
+
+    const std::string& error () const {
+      return error_;
+    }
+
+  private:
+    std::unique_ptr<dbus::Connection> bus_;
+    std::string address_;
+    std::string error_;
+  };
+
+} // namespace dotname
+
+#endif // __DCONFWRITER_HPP
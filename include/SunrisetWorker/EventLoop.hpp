@@ -0,0 +1,255 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __EVENTLOOP_HPP
+#define __EVENTLOOP_HPP
+
+#include <chrono>
+#include <coroutine>
+#include <cstdint>
+#include <initializer_list>
+#include <map>
+#include <vector>
+
+// Single threaded executor for C++20 coroutines on epoll: fds, deadlines, signals and
+// child exits as awaitables; Linux only
+
+namespace dotname {
+
+  class EventLoop;
+
+  // Coroutine with an int result (0 / -1 like the rest of the library). It starts
+  // suspended: EventLoop::spawn () schedules it, co_await task runs it to its end from
+  // another task and gives its co_return value.
+  class Task {
+  public:
+    struct promise_type {
+      int result = 0;
+      std::coroutine_handle<> continuation;
+      EventLoop* loop = nullptr; // spawned: the loop retires it at the end
+
+      Task get_return_object () {
+        return Task (std::coroutine_handle<promise_type>::from_promise (*this));
+      }
+      std::suspend_always initial_suspend () noexcept {
+        return {};
+      }
+      struct FinalAwaiter {
+        bool await_ready () noexcept {
+          return false;
+        }
+        std::coroutine_handle<> await_suspend (std::coroutine_handle<promise_type> h) noexcept;
+        void await_resume () noexcept {
+        }
+      };
+      FinalAwaiter final_suspend () noexcept {
+        return {};
+      }
+      void return_value (int rc) {
+        result = rc;
+      }
+      // logged, the task ends with -1
+      void unhandled_exception ();
+    };
+
+    Task (Task&& other) noexcept : handle_ (other.handle_) {
+      other.handle_ = nullptr;
+    }
+    Task& operator= (Task&& other) noexcept;
+    ~Task ();
+
+    Task (const Task&) = delete;
+    Task& operator= (const Task&) = delete;
+
+    struct Awaiter {
+      std::coroutine_handle<promise_type> handle;
+
+      bool await_ready () const noexcept {
+        return !handle || handle.done ();
+      }
+      std::coroutine_handle<> await_suspend (std::coroutine_handle<> caller) noexcept {
+        handle.promise ().continuation = caller;
+        return handle;
+      }
+      int await_resume () const noexcept {
+        return handle ? handle.promise ().result : -1;
+      }
+    };
+    Awaiter operator co_await () const noexcept {
+      return { handle_ };
+    }
+
+  private:
+    friend class EventLoop;
+    explicit Task (std::coroutine_handle<promise_type> handle) : handle_ (handle) {
+    }
+
+    std::coroutine_handle<promise_type> handle_;
+  };
+
+  struct EventLoopStats {
+    std::uint64_t wakeups = 0; // returns from epoll_wait ()
+    std::uint64_t events = 0;  // fd / timer events delivered
+    std::uint64_t resumes = 0; // coroutines resumed by the loop
+  };
+
+  // Blocks the signals and receives them through a signalfd for EventLoop::signal (); the
+  // destructor unblocks them again. Create it before the process starts any thread: the
+  // mask is per thread and only threads started afterwards inherit it, so with other
+  // threads already running it fails (fd () == -1) rather than miss signals.
+  class SignalSet {
+  public:
+    SignalSet (std::initializer_list<int> signals);
+    ~SignalSet ();
+
+    SignalSet (const SignalSet&) = delete;
+    SignalSet& operator= (const SignalSet&) = delete;
+
+    // -1 when the signals could not be blocked or other threads ran (logged)
+    int fd () const {
+      return fd_;
+    }
+
+  private:
+    std::vector<int> signals_;
+    int fd_ = -1;
+  };
+
+  class LoopTimer;
+
+  class EventLoop {
+  public:
+    EventLoop ();
+    ~EventLoop ();
+
+    EventLoop (const EventLoop&) = delete;
+    EventLoop& operator= (const EventLoop&) = delete;
+
+    // Schedules the task, the loop owns it from here on
+    void spawn (Task task);
+    // Runs the tasks until stop () or until all of them finished. Returns the rc given to
+    // stop (), else the co_return value of the task that finished last; -1 when the loop
+    // failed (logged)
+    int run ();
+    // run () returns once the current resume suspends
+    void stop (int rc = 0);
+
+    const EventLoopStats& stats () const {
+      return stats_;
+    }
+
+    // co_await: the ready events (EPOLLIN, ...) or -errno when the fd cannot be polled
+    struct FdWait {
+      EventLoop* loop;
+      int fd;
+      std::uint32_t events;
+      std::coroutine_handle<> handle = nullptr;
+      int result = -1;
+
+      bool await_ready () const noexcept {
+        return false;
+      }
+      bool await_suspend (std::coroutine_handle<> caller);
+      int await_resume () const noexcept {
+        return result;
+      }
+    };
+    // events as for epoll (EPOLLIN, EPOLLOUT, ...), EPOLLIN (1) by default
+    FdWait wait (int fd, std::uint32_t events = 1);
+
+    // co_await: 0 at the deadline, 1 when LoopTimer::wake () came first
+    struct SleepWait {
+      EventLoop* loop;
+      std::chrono::system_clock::time_point at;
+      LoopTimer* timer = nullptr;
+      std::coroutine_handle<> handle = nullptr;
+      std::multimap<std::chrono::system_clock::time_point, SleepWait*>::iterator node {};
+      int result = 0;
+
+      bool await_ready () noexcept;
+      void await_suspend (std::coroutine_handle<> caller);
+      int await_resume () const noexcept {
+        return result;
+      }
+    };
+    SleepWait sleepUntil (std::chrono::system_clock::time_point at) {
+      return { this, at };
+    }
+    SleepWait sleepFor (std::chrono::system_clock::duration d) {
+      return { this, std::chrono::system_clock::now () + d };
+    }
+
+    // co_await: the number of the next signal of the set, -1 on failure
+    struct SignalWait : FdWait {
+      int await_resume () const noexcept;
+    };
+    SignalWait signal (const SignalSet& signals);
+
+    // co_await: the wait status of the child (WIFEXITED () ...) once it exited, -1 when
+    // it is not a child of this process or the kernel has no pidfd
+    struct ChildWait : FdWait {
+      int pid;
+
+      ChildWait (EventLoop* loop, int pid);
+      ~ChildWait ();
+      ChildWait (const ChildWait&) = delete;
+      ChildWait& operator= (const ChildWait&) = delete;
+
+      bool await_ready () const noexcept {
+        return fd < 0;
+      }
+      int await_resume () noexcept;
+    };
+    ChildWait childExit (int pid) {
+      return { this, pid };
+    }
+
+  private:
+    friend class LoopTimer;
+    friend struct Task::promise_type::FinalAwaiter;
+
+    void post (std::coroutine_handle<> handle) {
+      ready_.push_back (handle);
+    }
+    void cancel (SleepWait& sleep);
+    void retire (std::coroutine_handle<Task::promise_type> handle);
+    void armTimer ();
+    void expireTimers ();
+
+    int epoll_ = -1;
+    int timerFd_ = -1;
+    std::chrono::system_clock::time_point armedAt_; // epoch when the timerfd is disarmed
+    std::multimap<std::chrono::system_clock::time_point, SleepWait*> timers_;
+    std::vector<std::coroutine_handle<>> ready_;
+    std::vector<std::coroutine_handle<>> resuming_;
+    std::vector<std::coroutine_handle<Task::promise_type>> tasks_; // spawned, not finished
+    bool stopped_ = false;
+    int rc_ = 0;
+    EventLoopStats stats_;
+  };
+
+  // A sleep that other tasks can cut short, e.g. to reschedule after a config change;
+  // one sleeper at a time
+  class LoopTimer {
+  public:
+    explicit LoopTimer (EventLoop& loop) : loop_ (loop) {
+    }
+
+    // co_await: 0 at the deadline, 1 when wake () came first or came while nobody slept
+    EventLoop::SleepWait until (std::chrono::system_clock::time_point at) {
+      return { &loop_, at, this };
+    }
+    void wake ();
+
+  private:
+    friend struct EventLoop::SleepWait;
+    friend class EventLoop;
+
+    EventLoop& loop_;
+    EventLoop::SleepWait* sleeper_ = nullptr;
+    bool woken_ = false;
+  };
+
+} // namespace dotname
+
+#endif // __EVENTLOOP_HPP
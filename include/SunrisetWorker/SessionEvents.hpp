@@ -0,0 +1,67 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __SESSIONEVENTS_HPP
+#define __SESSIONEVENTS_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+
+// Screen lock/unlock and suspend/resume signals from the session and system bus as
+// pollable events
+
+namespace dotname {
+
+  namespace dbus {
+    class Connection;
+  }
+
+  enum class SessionEvent {
+    Locked,     // ActiveChanged (true)
+    Unlocked,   // ActiveChanged (false)
+    Suspending, // PrepareForSleep (true)
+    Resumed,    // PrepareForSleep (false)
+  };
+
+  const char* sessionEventName (SessionEvent event);
+
+  class SessionEventListener {
+  public:
+    SessionEventListener ();
+    ~SessionEventListener ();
+
+    SessionEventListener (const SessionEventListener&) = delete;
+    SessionEventListener& operator= (const SessionEventListener&) = delete;
+
+    // An empty session address uses DBUS_SESSION_BUS_ADDRESS, an empty system address
+    // DBUS_SYSTEM_BUS_ADDRESS or the standard system bus socket. Either bus may be missing
+    // (a headless session, a container); 0 when at least one subscription stands, -1 when
+    // none (see error ())
+    int connect (const std::string& sessionAddress = {}, const std::string& systemAddress = {},
+                 int timeoutMs = 2000);
+    bool listensToScreenSaver () const;
+    bool listensToLogind () const;
+
+    // descriptors to poll () for POLLIN, the connected buses only
+    std::vector<int> fds () const;
+    // Appends the events that arrived, in order, without blocking; returns how many.
+    // A bus that went away is closed and drops out of fds ()
+    std::size_t drain (std::vector<SessionEvent>& events);
+
+    const std::string& error () const {
+      return error_;
+    }
+
+  private:
+    int subscribe (dbus::Connection& bus, const std::string& address, const char* rule,
+                   int timeoutMs);
+    void drain (dbus::Connection& bus, std::vector<SessionEvent>& events);
+
+    std::unique_ptr<dbus::Connection> session_, system_;
+    std::string error_;
+  };
+
+} // namespace dotname
+
+#endif // __SESSIONEVENTS_HPP
@@ -0,0 +1,47 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __STARTUPSNAPSHOT_HPP
+#define __STARTUPSNAPSHOT_HPP
+
+#include <SunrisetWorker/SunState.hpp>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+// Resolved config.json plus the schedule of one local date in a fixed size binary record,
+// valid while config.json and the date stay the same
+
+namespace dotname {
+
+  constexpr std::uint32_t kStartupSnapshotVersion = 3;
+
+  struct StartupSnapshot {
+    // config.json after validation
+    double lat = 0.0;
+    double lon = 0.0;
+    int utcOffsetMinutes = 0; // of the zone at save time when timeZone is set
+    std::string timeZone;     // tz database name, empty for a fixed offset
+    bool zoneDerived = false; // the zone is not in config.json, derive it again on load
+    int riseOffsetMinutes = 0;
+    int setOffsetMinutes = 0;
+    int themeTimeoutMs = 2000;
+    std::vector<std::string> themeBackends;
+    // schedule of the local date, isDay is left for the caller's time of day
+    int year = 0, month = 0, day = 0;
+    SunState state;
+  };
+
+  // 0 when file holds a snapshot of config as it is now for that date, -1 otherwise
+  int loadStartupSnapshot (const std::filesystem::path& file,
+                           const std::filesystem::path& config, int year, int month, int day,
+                           StartupSnapshot& snapshot);
+  // 0 on success, -1 when it cannot be written or the backend or zone names do not fit
+  // (logged)
+  int saveStartupSnapshot (const std::filesystem::path& file,
+                           const std::filesystem::path& config, const StartupSnapshot& snapshot);
+
+} // namespace dotname
+
+#endif // __STARTUPSNAPSHOT_HPP
@@ -0,0 +1,49 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __SUNALTITUDES_HPP
+#define __SUNALTITUDES_HPP
+
+#include <SunrisetWorker/SunEngine.hpp>
+#include <cstddef>
+#include <vector>
+
+// Rise/set for several altitude thresholds from one evaluation of the ephemeris
+
+namespace dotname {
+
+  struct SunAltitude {
+    double altit;  // altitude the Sun should cross, degrees
+    int upperLimb; // non-zero -> upper limb, zero -> center
+  };
+
+  namespace SunAltitudes {
+    // same values as the sunriset.h macros
+    constexpr SunAltitude RiseSet{ -35.0 / 60.0, 1 };
+    constexpr SunAltitude DayLength{ -50.0 / 60.0, 1 };
+    constexpr SunAltitude CivilTwilight{ -6.0, 0 };
+    constexpr SunAltitude NauticalTwilight{ -12.0, 0 };
+    constexpr SunAltitude AstronomicalTwilight{ -18.0, 0 };
+    // photographer's thresholds
+    constexpr SunAltitude GoldenHour{ 6.0, 0 };
+    constexpr SunAltitude BlueHour{ -4.0, 0 };
+  } // namespace SunAltitudes
+
+  struct SunCrossing {
+    double rise;      // hours UT, as __sunriset__
+    double set;       // hours UT, as __sunriset__
+    double dayLength; // hours, as __daylen__
+    int rc;           // return code of __sunriset__
+  };
+
+  void sunCrossings (int year, int month, int day, double lon, double lat,
+                     const SunAltitude* altitudes, std::size_t count, SunCrossing* out,
+                     SunEngine engine = SunEngine::Reference);
+
+  std::vector<SunCrossing> sunCrossings (int year, int month, int day, double lon, double lat,
+                                         const std::vector<SunAltitude>& altitudes,
+                                         SunEngine engine = SunEngine::Reference);
+
+} // namespace dotname
+
+#endif // __SUNALTITUDES_HPP
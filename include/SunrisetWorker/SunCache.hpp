@@ -0,0 +1,64 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __SUNCACHE_HPP
+#define __SUNCACHE_HPP
+
+#include <SunrisetWorker/SunAltitudes.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+// In-process cache of __sunriset__ results and their HH:MM strings, keyed by quantized
+// lat/lon, day and altitude
+
+namespace dotname {
+
+  struct SunCacheValue {
+    double rise; // hours UT, as __sunriset__
+    double set;  // hours UT, as __sunriset__
+    int rc;      // return code of __sunriset__
+    std::string riseTimeUT; // rise as H:MM UT, folded into 0..24 h
+    std::string setTimeUT;
+  };
+
+  struct SunCacheStats {
+    std::uint64_t hits = 0;
+    std::uint64_t misses = 0;
+    std::uint64_t evictions = 0;
+    std::size_t entries = 0;
+    std::size_t capacity = 0;    // entries, all shards
+    std::size_t memoryBytes = 0; // estimate for the current entries
+  };
+
+  class SunCache {
+  public:
+    static constexpr std::size_t kDefaultMemoryCap = 16u << 20;
+
+    explicit SunCache (std::size_t memoryCapBytes = kDefaultMemoryCap, std::size_t shards = 16,
+                       double quantumDegrees = 0.01);
+    SunCache (SunCache&&) noexcept;
+    SunCache& operator= (SunCache&&) noexcept;
+    ~SunCache ();
+
+    // Thread safe. Returns a copy, entries may be evicted by other threads at any time.
+    SunCacheValue get (double lat, double lon, int year, int month, int day,
+                       SunAltitude altitude = SunAltitudes::RiseSet);
+
+    SunCacheStats stats () const;
+    void clear ();
+
+    // bytes one entry is accounted with against the memory cap
+    static std::size_t entryBytes ();
+
+  private:
+    struct Shard;
+    std::unique_ptr<Shard[]> shards_;
+    std::size_t shardCount_;
+    double quantum_;
+  };
+
+} // namespace dotname
+
+#endif // __SUNCACHE_HPP
@@ -0,0 +1,29 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __SUNENGINE_HPP
+#define __SUNENGINE_HPP
+
+// Selectable computation engines behind __sunriset__ / __daylen__
+
+namespace dotname {
+
+  enum class SunEngine {
+    Reference,      // the original trig path from sunriset.c
+    EphemerisTable, // per-day table (1801-2099), one acos per call
+    FastMath        // polynomial trig (src/FastMath/FastTrig.hpp), opt-in
+  };
+
+  const char* sunEngineName (SunEngine engine);
+
+  // Same contract as __sunriset__
+  int sunriset (SunEngine engine, int year, int month, int day, double lon, double lat,
+                double altit, int upperLimb, double* rise, double* set);
+
+  // Same contract as __daylen__
+  double daylen (SunEngine engine, int year, int month, int day, double lon, double lat,
+                 double altit, int upperLimb);
+
+} // namespace dotname
+
+#endif // __SUNENGINE_HPP
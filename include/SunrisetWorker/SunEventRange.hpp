@@ -0,0 +1,68 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __SUNEVENTRANGE_HPP
+#define __SUNEVENTRANGE_HPP
+
+#include <SunrisetWorker/SunAltitudes.hpp>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+
+// Rise/set for every day of a date range at one location, the ephemeris stepped from day
+// to day: for (const auto& ev : dotname::SunEventRange (lat, lon, from, to))
+
+namespace dotname {
+
+  struct SunEvent {
+    int dayNumber;
+    double rise; // hours UT, as __sunriset__
+    double set;  // hours UT, as __sunriset__
+    int rc;      // return code of __sunriset__
+  };
+
+  class SunEventRange {
+  public:
+    class iterator {
+    public:
+      using iterator_category = std::input_iterator_tag;
+      using value_type = SunEvent;
+      using difference_type = std::ptrdiff_t;
+      using pointer = const SunEvent*;
+      using reference = const SunEvent&;
+
+      reference operator* () const;
+      pointer operator->() const {
+        return &**this;
+      }
+      iterator& operator++ ();
+      bool operator== (const iterator& other) const;
+      bool operator!= (const iterator& other) const {
+        return !(*this == other);
+      }
+
+    private:
+      friend class SunEventRange;
+      explicit iterator (SunEventRange* range) : range_ (range) {
+      }
+      SunEventRange* range_;
+    };
+
+    SunEventRange (double lat, double lon, int fromDay, int toDay,
+                   SunAltitude altitude = SunAltitudes::RiseSet, int anchorInterval = 64);
+    SunEventRange (SunEventRange&&) noexcept;
+    SunEventRange& operator= (SunEventRange&&) noexcept;
+    ~SunEventRange ();
+
+    iterator begin ();
+    iterator end ();
+    std::size_t size () const;
+
+  private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+  };
+
+} // namespace dotname
+
+#endif // __SUNEVENTRANGE_HPP
@@ -0,0 +1,58 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __SUNGRID_HPP
+#define __SUNGRID_HPP
+
+#include <SunrisetWorker/SunAltitudes.hpp>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// Rise/set/day length over a lat/lon grid and a range of days, computed in parallel;
+// output is [day][row][column][altitude], row 0 is latMin, column 0 is lonMin
+
+namespace dotname {
+
+  struct SunGridSpec {
+    double latMin = -90.0, latMax = 90.0; // degrees, inclusive
+    double lonMin = -180.0, lonMax = 180.0;
+    double resolution = 1.0;   // degrees, step in both directions
+    int fromDay = 0, toDay = 0; // days since 2000 Jan 0, inclusive (see dayNumber ())
+    std::vector<SunAltitude> altitudes{ SunAltitudes::RiseSet };
+    SunEngine engine = SunEngine::Reference;
+
+    std::size_t rows () const;
+    std::size_t columns () const;
+    std::size_t days () const;
+    // number of SunCrossing the output buffer needs
+    std::size_t size () const;
+    std::size_t index (int dayNumber, std::size_t row, std::size_t column,
+                       std::size_t altitude) const;
+  };
+
+  class SunGridEngine {
+  public:
+    // threads == 0 -> all cores
+    explicit SunGridEngine (unsigned threads = 0);
+    SunGridEngine (SunGridEngine&&) noexcept;
+    SunGridEngine& operator= (SunGridEngine&&) noexcept;
+    ~SunGridEngine ();
+
+    unsigned threads () const;
+
+    // Into a caller supplied buffer of spec.size () elements
+    void compute (const SunGridSpec& spec, SunCrossing* out);
+
+    // Into the engine's arena, valid until the next compute () on this engine. The arena
+    // only grows, repeated runs of the same spec do not allocate.
+    const SunCrossing* compute (const SunGridSpec& spec);
+
+  private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+  };
+
+} // namespace dotname
+
+#endif // __SUNGRID_HPP
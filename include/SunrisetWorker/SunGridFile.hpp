@@ -0,0 +1,89 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __SUNGRIDFILE_HPP
+#define __SUNGRIDFILE_HPP
+
+#include <SunrisetWorker/SunAltitudes.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+// Precomputed lat x lon x day-of-year grid of rise/set times in a memory mapped file,
+// interpolated, with __sunriset__ itself where the grid is off
+
+namespace dotname {
+
+  struct SunGridFileHeader {
+    char magic[8];         // "SUNGRID"
+    std::uint32_t version; // kSunGridFileVersion
+    std::uint32_t headerSize;
+    std::uint32_t rows, columns, days; // days: 2 + 366 (Feb 29 included) + 2
+    float latMin, latStep;
+    float lonMin, lonStep;
+    float altit;
+    std::int32_t upperLimb;
+    std::int32_t referenceYear;             // leap year the nodes were computed for
+    std::int32_t validFromYear, validToYear; // years the error bound was measured over
+    float toleranceSeconds;                  // cells above it answer with __sunriset__
+    float maxErrorSeconds;                   // measured over validFromYear..validToYear
+    std::uint64_t nodesOffset; // [day][row][column] of { uint16 rise, uint16 set }
+    std::uint64_t cellsOffset; // [day][row][column] int8, rc of the cell or kSunGridExact
+    std::uint64_t fileSize;
+  };
+
+  constexpr std::uint32_t kSunGridFileVersion = 1;
+  // cell value: answer with the exact __sunriset__
+  constexpr std::int8_t kSunGridExact = 2;
+
+  struct SunGridFileSpec {
+    double latStep = 1.0;  // degrees
+    double lonStep = 10.0; // degrees, must divide 360
+    SunAltitude altitude = SunAltitudes::RiseSet;
+    int referenceYear = 2024;
+    double toleranceSeconds = 60.0;
+    int validFromYear = 2020, validToYear = 2040;
+    std::size_t validationSamples = 200000;
+  };
+
+  // AssetContext::getAssetsPath () / "sungrid.bin"
+  std::filesystem::path sunGridFilePath ();
+
+  // Offline builder, returns 0 on success and -1 on failure (logged)
+  int buildSunGridFile (const std::filesystem::path& file, const SunGridFileSpec& spec = {},
+                        unsigned threads = 0);
+
+  class SunGridFile {
+  public:
+    SunGridFile () = default;
+    explicit SunGridFile (const std::filesystem::path& file);
+    SunGridFile (SunGridFile&& other) noexcept;
+    SunGridFile& operator= (SunGridFile&& other) noexcept;
+    ~SunGridFile ();
+
+    SunGridFile (const SunGridFile&) = delete;
+    SunGridFile& operator= (const SunGridFile&) = delete;
+
+    // 0 on success, -1 when the file is missing, truncated or of another version
+    int open (const std::filesystem::path& file);
+    void close ();
+    bool isOpen () const {
+      return header_ != nullptr;
+    }
+    const SunGridFileHeader& header () const {
+      return *header_;
+    }
+
+    // Same contract as __sunriset__ for the altitude the file was built for
+    int sunriset (int year, int month, int day, double lon, double lat, double* rise,
+                  double* set) const;
+
+  private:
+    const void* data_ = nullptr;
+    std::size_t size_ = 0;
+    const SunGridFileHeader* header_ = nullptr;
+  };
+
+} // namespace dotname
+
+#endif // __SUNGRIDFILE_HPP
@@ -0,0 +1,110 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __SUNRAMP_HPP
+#define __SUNRAMP_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+// Continuous output (night light temperature, brightness) following the solar elevation,
+// written only when its quantized value changes
+
+namespace dotname {
+
+  struct SunRampSpec {
+    double lowElevation = -6.0; // degrees
+    double highElevation = 3.0; // degrees
+    double nightValue = 3500.0;
+    double dayValue = 6500.0;
+    double step = 100.0;        // output levels nightValue + k * step, ends included
+    std::chrono::milliseconds minInterval { 1000 };
+    int sampleSeconds = 60;
+  };
+
+  struct SunRampPoint {
+    std::chrono::system_clock::time_point at;
+    double value; // quantized output from `at` on
+  };
+
+  struct SunRampStats {
+    std::uint64_t writes = 0;
+    std::uint64_t coalesced = 0;   // plan points superseded before they were written
+    std::uint64_t rateLimited = 0; // fire () calls held back by minInterval
+  };
+
+  class SunRamp {
+  public:
+    using Callback = std::function<void (double value)>;
+
+    SunRamp (double lat, double lon, int utcOffsetMinutes, const SunRampSpec& spec);
+
+    // Solar elevation (degrees, Sun's center, no refraction) from the date's curve
+    double elevationAt (std::chrono::system_clock::time_point t);
+    // Unquantized output at t
+    double valueAt (std::chrono::system_clock::time_point t);
+
+    // Change points of the local date (days since 1970-01-01) and the value its midnight
+    // starts with; valid until the next call
+    const std::vector<SunRampPoint>& plan (long localDay, double* startValue = nullptr);
+    long localDay (std::chrono::system_clock::time_point t) const;
+
+    // Writes the value due at now when it differs from the last write, 1 when written.
+    // The first call always writes
+    std::size_t fire (std::chrono::system_clock::time_point now, const Callback& onValue);
+    // next instant fire () may write: a change point, the end of a held back interval or
+    // the next local midnight
+    std::chrono::system_clock::time_point nextAt () const;
+    const SunRampStats& stats () const {
+      return stats_;
+    }
+
+    // fire () loop on one timer until stop (), the only call safe from another thread;
+    // a stop () that comes before run () still counts
+    void run (const Callback& onValue);
+    void stop ();
+
+  private:
+    struct Curve {
+      long day = 0;
+      bool valid = false;
+      double sinDec = 0.0, cosDec = 1.0;
+      double tsouth = 12.0; // hours UT of the local date's upper culmination
+    };
+
+    void curve (long localDay);
+    double elevation (std::int64_t t) const;
+    double output (double elevation) const;
+    double quantize (double value) const;
+    void build (long localDay, std::vector<SunRampPoint>& out, double& startValue);
+
+    double lat_, lon_, sinLat_, cosLat_;
+    int utcOffsetMinutes_;
+    SunRampSpec spec_;
+    Curve curve_;
+
+    std::vector<SunRampPoint> plan_, scratch_;
+    double startValue_ = 0.0;
+    long planDay_ = 0;
+    bool planned_ = false;
+    std::size_t cursor_ = 0;
+    std::size_t pending_ = 0; // points passed since the last write
+
+    double written_ = 0.0;
+    std::int64_t writtenAt_ = 0; // ticks
+    bool started_ = false;
+    bool held_ = false; // a change waits for minInterval
+    SunRampStats stats_;
+
+    std::mutex m_;
+    std::condition_variable wake_;
+    bool stop_ = false;
+  };
+
+} // namespace dotname
+
+#endif // __SUNRAMP_HPP
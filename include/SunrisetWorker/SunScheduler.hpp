@@ -0,0 +1,140 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __SUNSCHEDULER_HPP
+#define __SUNSCHEDULER_HPP
+
+#include <SunrisetWorker/SunState.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+// Light/dark transitions of many independent schedules fired from one thread
+
+namespace dotname {
+
+  using SunScheduleId = std::uint32_t;
+
+  // UTC offset in minutes a zone has at an instant
+  using SunZone = std::function<int (std::chrono::system_clock::time_point)>;
+  // the process' local zone through localtime_r (), tzset () rereads a replaced zone
+  int systemZoneOffset (std::chrono::system_clock::time_point t);
+
+  struct SunSchedulerStats {
+    std::uint64_t windows = 0; // all schedules recomputed for a new window
+    std::uint64_t resyncs = 0; // ... for a clock step, resume or a late fire ()
+    std::uint64_t retimed = 0; // single local schedules recomputed for an offset change
+  };
+
+  struct SunScheduleEvent {
+    SunScheduleId id;
+    bool toLight; // light theme from `at` on, else dark
+    std::chrono::system_clock::time_point at;
+  };
+
+  class SunScheduler {
+  public:
+    using Callback = std::function<void (const SunScheduleEvent&)>;
+
+    // onTransition runs on the thread calling fire () / run (), without the lock held;
+    // zone is what addLocal () schedules follow
+    explicit SunScheduler (Callback onTransition, SunZone zone = systemZoneOffset);
+
+    // Ids of removed schedules are reused
+    SunScheduleId add (const SunStateParams& params,
+                       std::chrono::system_clock::time_point now
+                       = std::chrono::system_clock::now ());
+    // params.utcOffsetMinutes is ignored, the schedule takes the zone's offset
+    SunScheduleId addLocal (const SunStateParams& params,
+                            std::chrono::system_clock::time_point now
+                            = std::chrono::system_clock::now ());
+    // false when the id is not scheduled
+    bool remove (SunScheduleId id);
+
+    std::size_t size () const;
+    // state of the schedule after the last fired event, false for unknown ids
+    bool isDay (SunScheduleId id) const;
+    // earliest pending event or window end, time_point::max () without schedules
+    std::chrono::system_clock::time_point nextWake () const;
+    SunSchedulerStats stats () const;
+
+    // Fires every transition due at `now` in time order, returns how many
+    std::size_t fire (std::chrono::system_clock::time_point now
+                      = std::chrono::system_clock::now ());
+    // The wall clock jumped (either way) or the machine resumed: every schedule is
+    // resynchronized to `now`, state changes are fired at `now`. Returns how many
+    std::size_t clockChanged (std::chrono::system_clock::time_point now
+                              = std::chrono::system_clock::now ());
+    // The zone itself changed: fires what was due, then recomputes the local schedules
+    // whose offset differs now. Returns the transitions fired
+    std::size_t zoneChanged (std::chrono::system_clock::time_point now
+                             = std::chrono::system_clock::now ());
+
+    // fire () loop sleeping until nextWake (), add / remove / stop wake it up; a stop ()
+    // that comes before run () still counts
+    void run ();
+    void stop ();
+
+  private:
+    struct Event {
+      std::int64_t at; // system_clock ticks
+      bool toLight;
+    };
+
+    struct Schedule {
+      SunStateParams params;
+      Event events[6]; // two local dates: midnight, lightAt, darkAt each
+      std::uint8_t count = 0;
+      std::uint8_t next = 0;
+      bool isDay = false;
+      bool active = false;
+      bool local = false; // params.utcOffsetMinutes follows zone_
+      std::uint32_t heapPos; // kNotQueued when no event is pending
+    };
+
+    struct HeapEntry {
+      std::int64_t key;
+      SunScheduleId id;
+    };
+
+    SunScheduleId addSchedule (const SunStateParams& params, std::int64_t now, bool local);
+    void windowEvents (Schedule& s, long localDay, const double* rise, const double* set,
+                       const int* rc, std::int64_t from);
+    void recompute (std::int64_t windowStart, std::int64_t from);
+    void resync (std::int64_t now, std::vector<SunScheduleEvent>& due);
+    void retime (SunScheduleId id, std::int64_t from, std::vector<SunScheduleEvent>& due);
+    void retimeLocal (std::int64_t at, std::vector<SunScheduleEvent>& due);
+    std::int64_t nextZoneChange (std::int64_t from) const;
+    std::int64_t wakeAt () const;
+    void drain (std::int64_t t, std::vector<SunScheduleEvent>& due);
+
+    void heapPush (SunScheduleId id);
+    void heapUpdate (SunScheduleId id);
+    void heapErase (std::uint32_t pos);
+    void heapRebuild ();
+    void siftUp (std::uint32_t pos);
+    void siftDown (std::uint32_t pos);
+    void place (std::uint32_t pos, const HeapEntry& entry);
+
+    Callback onTransition_;
+    SunZone zone_;
+    std::vector<Schedule> schedules_;
+    std::vector<SunScheduleId> free_;
+    std::vector<HeapEntry> heap_;
+    std::vector<SunScheduleId> local_; // schedules following zone_
+    std::size_t active_ = 0;
+    std::int64_t windowStart_ = 0, windowEnd_ = 0;
+    std::int64_t zoneChangeAt_; // next offset change of zone_ in the window, or never
+    SunSchedulerStats stats_;
+
+    mutable std::mutex m_;
+    std::condition_variable wake_;
+    bool stop_ = false;
+  };
+
+} // namespace dotname
+
+#endif // __SUNSCHEDULER_HPP
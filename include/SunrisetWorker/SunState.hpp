@@ -0,0 +1,75 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __SUNSTATE_HPP
+#define __SUNSTATE_HPP
+
+#include <SunrisetWorker/SunAltitudes.hpp>
+#include <chrono>
+
+// Pure rise/set/theme state computation, no I/O and no global state
+
+namespace dotname {
+
+  struct SunStateParams {
+    double lat = 0.0;
+    double lon = 0.0;
+    int utcOffsetMinutes = 0;
+    int riseOffsetMinutes = 0; // light theme this long after (negative: before) sunrise
+    int setOffsetMinutes = 0;  // dark theme this long after (negative: before) sunset
+    SunAltitude altitude = SunAltitudes::RiseSet;
+  };
+
+  struct SunState {
+    int rc;         // return code of __sunriset__, +1 polar day, -1 polar night
+    double rise;    // local hours (UT + utc offset), 0..24
+    double set;     // local hours, 0..24
+    double lightAt; // rise + riseOffsetMinutes, local hours 0..24
+    double darkAt;  // set + setOffsetMinutes, local hours 0..24
+    bool isDay;     // light theme at the queried time
+  };
+
+  struct SunTransition {
+    bool found;                               // false: no transition within the search
+    bool toLight;                             // light theme from `at` on, else dark
+    std::chrono::system_clock::time_point at; // absolute instant of the switch
+  };
+
+  class SunStateEngine {
+  public:
+    explicit SunStateEngine (const SunStateParams& params);
+
+    const SunStateParams& params () const {
+      return params_;
+    }
+
+    // year/month/day is the local date, localHours the local time of day (0..24)
+    SunState compute (int year, int month, int day, double localHours) const;
+
+    // isDay for a local time of day, given the triggers of that date
+    static bool isDayAt (const SunState& state, double localHours);
+
+    // compute () for an absolute instant, local date and time follow utcOffsetMinutes
+    SunState stateAt (std::chrono::system_clock::time_point t) const;
+
+    // start of the next local day after t
+    std::chrono::system_clock::time_point nextMidnight (
+        std::chrono::system_clock::time_point t) const;
+
+    // Next instant after `now` where isDay flips, offsets included. Local dates follow
+    // utcOffsetMinutes. Rolls over into the following days and skips polar day/night
+    // (rc = +-1) for up to searchDays, then reports found = false. A date that starts in
+    // the other state (a polar night begins, a late darkAt moves past 00:00) flips at
+    // its local midnight.
+    SunTransition nextTransition (std::chrono::system_clock::time_point now,
+                                  int searchDays = 370) const;
+
+  private:
+    void localDay (std::chrono::system_clock::time_point t, long& day, double& hours) const;
+
+    SunStateParams params_;
+  };
+
+} // namespace dotname
+
+#endif // __SUNSTATE_HPP
@@ -0,0 +1,91 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __SUNTIMELINE_HPP
+#define __SUNTIMELINE_HPP
+
+#include <SunrisetWorker/SunAltitudes.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Daily plan of named actions at solar events, run from a single timer
+
+namespace dotname {
+
+  struct SunRule {
+    SunAltitude altitude = SunAltitudes::RiseSet;
+    bool rising = true;     // morning crossing, else evening
+    int offsetMinutes = 0;  // after (negative: before) the crossing
+    std::string action;
+  };
+
+  struct SunPlanEntry {
+    std::chrono::system_clock::time_point at;
+    std::uint32_t action; // index into SunTimeline::actions ()
+  };
+
+  class SunTimeline {
+  public:
+    using Callback = std::function<void (const SunPlanEntry&)>;
+
+    SunTimeline (double lat, double lon, int utcOffsetMinutes, const std::vector<SunRule>& rules);
+
+    // distinct action names in the order of their first rule
+    const std::vector<std::string>& actions () const {
+      return actions_;
+    }
+    const std::string& action (const SunPlanEntry& entry) const {
+      return actions_[entry.action];
+    }
+
+    // Plan of the local date (days since 1970-01-01), valid until the next call
+    const std::vector<SunPlanEntry>& plan (long localDay);
+    long localDay (std::chrono::system_clock::time_point t) const;
+
+    // Latest entry at or before t on its date or the one before, false when none
+    bool latest (std::chrono::system_clock::time_point t, SunPlanEntry& entry);
+
+    // The first call only positions the timeline at `now`. Later calls fire the entries
+    // after the previous call up to `now` in time order and return how many. A call more
+    // than a day late (suspend) skips the missed days and fires latest (now) alone.
+    std::size_t fire (std::chrono::system_clock::time_point now, const Callback& onAction);
+    // when fire () has something to do next: an entry or the next local midnight
+    std::chrono::system_clock::time_point nextAt () const;
+
+    // fire () loop on one timer until stop (), the only call safe from another thread;
+    // a stop () that comes before run () still counts
+    void run (const Callback& onAction);
+    void stop ();
+
+  private:
+    void build (long localDay, std::vector<SunPlanEntry>& out);
+    void position (long localDay, std::int64_t after);
+
+    double lat_, lon_;
+    int utcOffsetMinutes_;
+    std::vector<SunRule> rules_;
+    std::vector<std::uint32_t> ruleAction_;
+    std::vector<std::string> actions_;
+    std::vector<SunAltitude> altitudes_;   // distinct elevations
+    std::vector<std::uint32_t> ruleAltitude_;
+    std::vector<SunCrossing> crossings_;
+
+    std::vector<SunPlanEntry> plan_, scratch_; // scratch_: plan () and latest () queries
+    long planDay_ = 0;
+    std::size_t cursor_ = 0;
+    std::int64_t last_ = 0; // ticks of the previous fire ()
+    bool started_ = false;
+
+    std::mutex m_;
+    std::condition_variable wake_;
+    bool stop_ = false;
+  };
+
+} // namespace dotname
+
+#endif // __SUNTIMELINE_HPP
@@ -0,0 +1,41 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __SUNRISETBATCH_HPP
+#define __SUNRISETBATCH_HPP
+
+#include <cstddef>
+
+// Batch (structure-of-arrays) variant of __sunriset__, times in hours UT
+
+namespace dotname {
+
+  enum class SimdIsa { Scalar, Sse2, Avx2, Avx512 };
+
+  // Best instruction set supported by the running CPU
+  SimdIsa detectSimdIsa ();
+  const char* simdIsaName (SimdIsa isa);
+
+  // Same as days_since_2000_Jan_0 from sunriset.h
+  int dayNumber (int year, int month, int day);
+
+  // Requested isa is lowered to the best one the CPU supports
+  void sunrisetBatch (const int* days, const double* lat, const double* lon, std::size_t count,
+                      double altit, int upperLimb, double* rise, double* set, int* rc,
+                      SimdIsa isa = detectSimdIsa ());
+
+  // float32 path, twice the lanes, about 1 s RMS (up to minutes right at polar day/night)
+  void sunrisetBatch (const int* days, const float* lat, const float* lon, std::size_t count,
+                      double altit, int upperLimb, float* rise, float* set, int* rc,
+                      SimdIsa isa = detectSimdIsa ());
+
+  // Counterpart of the sun_rise_set macro
+  template <typename T>
+  void sunRiseSetBatch (const int* days, const T* lat, const T* lon, std::size_t count, T* rise,
+                        T* set, int* rc, SimdIsa isa = detectSimdIsa ()) {
+    sunrisetBatch (days, lat, lon, count, -35.0 / 60.0, 1, rise, set, rc, isa);
+  }
+
+} // namespace dotname
+
+#endif // __SUNRISETBATCH_HPP
@@ -4,10 +4,16 @@
 #ifndef __SUNRISETWORKER_HPP
 #define __SUNRISETWORKER_HPP
 
+#include <SunrisetWorker/ConfigStore.hpp>
+#include <SunrisetWorker/SunState.hpp>
+#include <SunrisetWorker/ThemeBackend.hpp>
+#include <SunrisetWorker/ThemeState.hpp>
 #include <SunrisetWorker/version.h>
+#include <chrono>
 #include <filesystem>
 #include <string>
 #include <utility>
+#include <vector>
 
 extern "C" {
 #include "SunrisetC/sunriset.h"
@@ -24,6 +30,7 @@ namespace dotname {
     std::pair<bool, int> riseOffsetMinutes;
     std::pair<bool, int> setOffsetMinutes;
     std::pair<bool, bool> clear;
+    std::pair<bool, bool> force;
   };
 
   class SunrisetWorker {
@@ -38,33 +45,66 @@ namespace dotname {
     ~SunrisetWorker ();
 
     int loadConfig ();
+    // One transaction, writes config.json only when a value changed
     int saveConfig ();
+    // Re-reads config.json (command line values still win), keeps the running values
+    // when the new ones are out of range; 0 on success
+    int reloadConfig ();
+    // The system's time zone changed: a zone config.json does not set follows it
+    void systemZoneChanged ();
+    const ConfigStoreStats& configStats () const {
+      return config_.stats ();
+    }
+    const std::filesystem::path& configPath () const {
+      return configPath_;
+    }
 
-    void switchLightThemeGNome (bool lightTheme) {
-      if (lightTheme) {
-        // Switch to light theme
-        std::system ("gsettings set org.gnome.desktop.interface color-scheme 'default'");
-        std::system ("gsettings set org.gnome.desktop.interface gtk-theme 'Adwaita'");
-      } else {
-        // Switch to dark theme
-        std::system ("gsettings set org.gnome.desktop.interface color-scheme 'prefer-dark'");
-        std::system ("gsettings set org.gnome.desktop.interface gtk-theme 'Adwaita-dark'");
-      }
+    // Parameters of the loaded configuration for SunStateEngine; with a time zone
+    // (config "timeZone") the UTC offset is the zone's at `at`, daylight saving included
+    SunStateParams stateParams (
+        std::chrono::system_clock::time_point at = std::chrono::system_clock::now ()) const;
+    // tz database name the UTC offset follows, empty for a fixed offset
+    const std::string& timeZone () const {
+      return timeZone_;
     }
 
-    template <typename T> std::string to24Time (T time) {
-      // Convert time to 24-hour format
-      int hours = static_cast<int> (time);
-      int minutes = static_cast<int> ((time - hours) * 60);
-      return std::to_string (hours) + ":" + (minutes < 10 ? "0" : "") + std::to_string (minutes);
+    // Next light/dark switch after `now`, see SunStateEngine::nextTransition
+    SunTransition nextTransition (
+        std::chrono::system_clock::time_point now = std::chrono::system_clock::now ()) const;
+
+    // Switches the configured backends (config "themeBackends", default gnome, plus the
+    // executables in assets/hooks) that do not have lightTheme applied yet, per the
+    // recorded state (assets/themestate.json); true when at least one backend switched
+    bool applyTheme (bool lightTheme);
+    // the next applyTheme () switches every backend, e.g. after an unlock or --force
+    void forgetAppliedTheme ();
+    const ThemeStateStats& themeStats () const {
+      return themeState_.stats ();
     }
 
+    // Convert time to 24-hour format
+    std::string to24Time (double time) const;
+
   private:
+    void resolveConfig ();
+    void setupThemeBackends ();
+    // time zone for settings without one: the system's, else a guess from lat_ / lon_
+    std::string derivedZone () const;
+    // offset of timeZone_ at `at` from the tz database, its standard offset without one
+    int zoneOffsetMinutes (std::chrono::system_clock::time_point at) const;
+
     std::filesystem::path configPath_;
+    ConfigStore config_;
+    ThemeState themeState_;
+    ThemeBackendRegistry themeBackends_;
+    std::vector<std::string> themeBackendNames_ { "gnome" };
+    int themeTimeoutMs_ = 2000;
     
     double lat_;
     double lon_;
     int utcOffsetMinutes_;
+    std::string timeZone_;
+    bool zoneDerived_ = false; // timeZone_ is not from the config, never saved
     int riseOffsetMinutes_;
     int setOffsetMinutes_;
     bool clear_;
@@ -0,0 +1,112 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __THEMEBACKEND_HPP
+#define __THEMEBACKEND_HPP
+
+#include <SunrisetWorker/DconfWriter.hpp>
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Theme targets switched together, in parallel: desktops (GNOME, KDE, Xfce) and user
+// hooks
+
+namespace dotname {
+
+  class WorkStealingPool;
+
+  // ThemeBackend::apply () result besides 0 / -1
+  constexpr int kThemeBackendTimedOut = -2;
+
+  using ThemeDeadline = std::chrono::steady_clock::time_point;
+
+  class ThemeBackend {
+  public:
+    virtual ~ThemeBackend () = default;
+
+    virtual std::string name () const = 0;
+    // 0 on success, -1 on failure, kThemeBackendTimedOut when the deadline passed.
+    // Called from a pool thread, concurrently with the other backends
+    virtual int apply (bool lightTheme, ThemeDeadline deadline) = 0;
+  };
+
+  // Runs the commands for the theme one after another, argv[0] is looked up in PATH
+  class CommandBackend : public ThemeBackend {
+  public:
+    using Command = std::vector<std::string>;
+
+    CommandBackend (std::string name, std::vector<Command> light, std::vector<Command> dark);
+
+    std::string name () const override {
+      return name_;
+    }
+    int apply (bool lightTheme, ThemeDeadline deadline) override;
+
+    // one command, exit status 0 -> 0
+    static int run (const Command& command, ThemeDeadline deadline);
+
+  private:
+    std::string name_;
+    std::vector<Command> light_, dark_;
+  };
+
+  // color-scheme and gtk-theme in one dconf transaction over D-Bus, the gsettings
+  // commands when the session bus or dconf is not there
+  class GnomeBackend : public ThemeBackend {
+  public:
+    std::string name () const override {
+      return "gnome";
+    }
+    int apply (bool lightTheme, ThemeDeadline deadline) override;
+
+  private:
+    DconfWriter dconf_;
+  };
+
+  // "gnome", "gsettings", "kde" (plasma-apply-colorscheme), "xfce" (xfconf-query);
+  // nullptr for other names
+  std::unique_ptr<ThemeBackend> makeThemeBackend (const std::string& name);
+
+  // an executable called as `hook light` or `hook dark` (terminal palettes, editors,
+  // wallpaper, ...)
+  std::unique_ptr<ThemeBackend> makeHookBackend (const std::filesystem::path& executable);
+
+  struct ThemeBackendResult {
+    std::string name;
+    int rc = 0; // as ThemeBackend::apply ()
+    std::chrono::microseconds latency {};
+  };
+
+  class ThemeBackendRegistry {
+  public:
+    ThemeBackendRegistry ();
+    ~ThemeBackendRegistry ();
+    ThemeBackendRegistry (ThemeBackendRegistry&&) noexcept;
+    ThemeBackendRegistry& operator= (ThemeBackendRegistry&&) noexcept;
+
+    void add (std::unique_ptr<ThemeBackend> backend);
+    // every executable file in dir as a hook backend, in name order; returns how many
+    std::size_t addHooks (const std::filesystem::path& dir);
+    std::size_t size () const {
+      return backends_.size ();
+    }
+    std::vector<std::string> names () const;
+
+    // Applies all backends concurrently, every one bounded by timeout. Results are in
+    // registration order
+    std::vector<ThemeBackendResult> apply (bool lightTheme, std::chrono::milliseconds timeout);
+    // the same for the backends named in `only`
+    std::vector<ThemeBackendResult> apply (bool lightTheme, std::chrono::milliseconds timeout,
+                                           const std::vector<std::string>& only);
+
+  private:
+    std::vector<std::unique_ptr<ThemeBackend>> backends_;
+    std::unique_ptr<WorkStealingPool> pool_; // one worker per backend, idle between switches
+  };
+
+} // namespace dotname
+
+#endif // __THEMEBACKEND_HPP
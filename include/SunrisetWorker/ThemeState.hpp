@@ -0,0 +1,65 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __THEMESTATE_HPP
+#define __THEMESTATE_HPP
+
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <string>
+#include <vector>
+
+// Theme last applied per backend, so only real light/dark transitions reach the desktop;
+// kept in a small JSON file next to the config
+
+namespace dotname {
+
+  struct ThemeStateStats {
+    std::uint64_t applied = 0;
+    std::uint64_t skipped = 0;
+  };
+
+  class ThemeState {
+  public:
+    // An empty path keeps the state in memory only
+    explicit ThemeState (const std::filesystem::path& file = {});
+
+    // The backends switched together; a set other than the recorded one drops what was
+    // recorded, so the next switch reaches all of them
+    void setBackends (const std::vector<std::string>& names);
+    // false and counted as skipped when every backend has lightTheme applied
+    bool needsSwitch (bool lightTheme);
+    // backends without lightTheme applied: the other theme, unknown or failed last time
+    std::vector<std::string> pending (bool lightTheme) const;
+    // one backend's outcome, in memory; a failed backend turns unknown and is retried
+    void record (const std::string& backend, bool lightTheme, bool ok);
+    // counts an applied switch and stores the file, 0 on success, -1 when the file cannot
+    // be written (logged, the state in memory is still updated)
+    int applied ();
+    // every backend unknown, for when the desktop may have been changed behind our back
+    void forget ();
+
+    bool known (const std::string& backend) const {
+      return theme (backend) >= 0;
+    }
+    bool lightTheme (const std::string& backend) const {
+      return theme (backend) > 0;
+    }
+    const ThemeStateStats& stats () const {
+      return stats_;
+    }
+
+  private:
+    int theme (const std::string& backend) const;
+    int load ();
+    int save () const;
+
+    std::filesystem::path file_;
+    std::map<std::string, int> themes_; // backend -> -1 unknown, 0 dark, 1 light
+    ThemeStateStats stats_;
+  };
+
+} // namespace dotname
+
+#endif // __THEMESTATE_HPP
@@ -0,0 +1,66 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __TIMEZONEINDEX_HPP
+#define __TIMEZONEINDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Offline lat/lon -> time zone lookup: the zone of the nearest tzdata reference location,
+// the nautical zone at sea
+
+namespace dotname {
+
+  using TimeZoneId = std::uint16_t;
+
+  struct TimeZoneInfo {
+    const char* name; // tz database name, "Europe/Prague", "Etc/GMT-1"
+    double lat, lon;  // reference location, 0 for nautical zones
+    int standardOffsetMinutes;
+    bool nautical;
+  };
+
+  constexpr double kTimeZoneMaxDistanceKm = 2000.0;
+
+  std::size_t timeZoneCount ();
+  // id < timeZoneCount ()
+  const TimeZoneInfo& timeZoneInfo (TimeZoneId id);
+  // lat -90..90, lon -180..180
+  TimeZoneId timeZoneAt (double lat, double lon);
+  // the nautical zone of a longitude, round (lon / 15) hours
+  TimeZoneId nauticalTimeZone (double lon);
+  // the zone the system is set to: TZ, the zoneinfo file /etc/localtime links to or
+  // /etc/timezone; empty when none of them names one
+  std::string systemTimeZone ();
+
+  class TimeZoneIndex {
+  public:
+    // threads == 0 -> all cores, for building the cell table
+    explicit TimeZoneIndex (double cellDegrees = 1.0, unsigned threads = 0);
+
+    TimeZoneId lookup (double lat, double lon) const;
+    // zones[i] = lookup (lat[i], lon[i]), split over threads (0 -> all cores)
+    void lookup (const double* lat, const double* lon, std::size_t count, TimeZoneId* zones,
+                 unsigned threads = 0) const;
+
+    std::size_t cells () const {
+      return rows_ * columns_;
+    }
+    // candidate locations stored over all cells
+    std::size_t candidates () const {
+      return candidates_.size ();
+    }
+
+  private:
+    double cellDegrees_;
+    std::size_t rows_, columns_;
+    std::vector<std::uint32_t> offsets_;  // cell -> first candidate, cells () + 1 entries
+    std::vector<std::uint16_t> candidates_; // ascending location numbers per cell
+  };
+
+} // namespace dotname
+
+#endif // __TIMEZONEINDEX_HPP
@@ -0,0 +1,98 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __TIMEZONERULES_HPP
+#define __TIMEZONERULES_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+// UTC offsets of a named zone over time from the tz database's compiled TZif files
+
+namespace dotname {
+
+  constexpr int kTimeZoneRulesExpandToYear = 2100;
+
+  class TimeZoneRules {
+  public:
+    // UTC, no transitions
+    TimeZoneRules () = default;
+
+    // 0 on success, -1 when the file is missing or not TZif (logged)
+    int load (const std::filesystem::path& file);
+    // TZif content already in memory, name is for the log only
+    int parse (const std::string& data, const std::string& name = "TZif");
+    // a POSIX TZ string alone, "CET-1CEST,M3.5.0,M10.5.0/3" or "<+0530>-5:30"; -1 when
+    // malformed
+    int parsePosix (const std::string& rule);
+
+    // east of Greenwich positive, CET is +3600
+    int offsetSecondsAt (std::int64_t utcSeconds) const;
+    int offsetMinutesAt (std::chrono::system_clock::time_point t) const {
+      using namespace std::chrono;
+      return offsetSecondsAt (duration_cast<seconds> (t.time_since_epoch ()).count ()) / 60;
+    }
+
+    // offsetSeconds[i] = offsetSecondsAt (utcSeconds[i]), fastest on ascending input
+    void offsetsAt (const std::int64_t* utcSeconds, std::size_t count, int* offsetSeconds) const;
+    // Local wall clock hours of UT results as __sunriset__ / sunrisetBatch / SunEventRange
+    // give them: localHours[i] = utHours[i] + offset at that instant, not wrapped to 0..24.
+    // days are days since 2000 Jan 0 (dayNumber ()), fastest on ascending days.
+    void toLocalHours (const int* days, const double* utHours, std::size_t count,
+                       double* localHours) const;
+
+    // offset changes held in the table, including the expanded rule
+    std::size_t transitions () const {
+      return at_.size ();
+    }
+    // POSIX TZ rule in effect after the table, empty for none
+    const std::string& rule () const {
+      return rule_;
+    }
+
+  private:
+    struct PosixRule {
+      int stdOffset = 0; // seconds east
+      int dstOffset = 0;
+      bool hasDst = false;
+      // start / end of DST: kind 'J' (1..365, no Feb 29), 'D' (0..365) or 'M' (month,
+      // week 1..5, weekday 0..6); time of day in local seconds, may exceed a day
+      struct Date {
+        char kind = 'M';
+        int a = 0, b = 0, c = 0;
+        int time = 7200;
+      } start, end;
+    };
+
+    static int parseRule (const std::string& text, PosixRule& rule);
+    // the two UTC instants of DST start and end in a year
+    static void ruleInstants (const PosixRule& rule, int year, std::int64_t& start,
+                              std::int64_t& end);
+    int ruleOffsetAt (std::int64_t utcSeconds) const;
+    void expandRule (std::int64_t from);
+    // index of the last transition at or before t, -1 before the first
+    long find (std::int64_t t) const;
+
+    int initial_ = 0;              // offset before the first transition
+    std::vector<std::int64_t> at_; // ascending UTC instants of offset changes
+    std::vector<std::int32_t> offset_;
+    std::string rule_;
+    PosixRule posix_;
+    bool hasRule_ = false;
+    std::int64_t expandedTo_ = 0; // rule lookups from here on
+  };
+
+  // TZDIR or /usr/share/zoneinfo
+  std::filesystem::path zoneinfoDir ();
+
+  // The zone "Europe/Prague" loaded once per process from zoneinfoDir () and kept, nullptr
+  // when there is no such zone (logged once). Thread safe, the pointer stays valid.
+  const TimeZoneRules* timeZoneRules (const std::string& name);
+
+} // namespace dotname
+
+#endif // __TIMEZONERULES_HPP
@@ -0,0 +1,137 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/ClockWatch.hpp>
+#include <Logger/Logger.hpp>
+
+#if defined(__linux__)
+  #include <cerrno>
+  #include <climits>
+  #include <cstring>
+  #include <ctime>
+  #include <sys/inotify.h>
+  #include <sys/timerfd.h>
+  #include <unistd.h>
+#endif
+
+namespace dotname {
+
+#if defined(__linux__)
+  namespace {
+
+    // time spent suspended since boot
+    std::int64_t suspendedNs () {
+      timespec boot {}, mono {};
+      clock_gettime (CLOCK_BOOTTIME, &boot);
+      clock_gettime (CLOCK_MONOTONIC, &mono);
+      return (boot.tv_sec - mono.tv_sec) * 1000000000LL + (boot.tv_nsec - mono.tv_nsec);
+    }
+
+    // shorter gaps are jitter between the two clock reads
+    constexpr std::int64_t kResumeThresholdNs = 1000000000LL;
+    // year 2223, the kernel rejects expirations past 2262
+    constexpr long long kFarFuture = 8000000000LL;
+
+  } // namespace
+
+  ClockWatch::ClockWatch (const std::filesystem::path& zoneFile)
+      : zoneName_ (zoneFile.filename ().string ()), suspendedNs_ (suspendedNs ()) {
+    timerFd_ = timerfd_create (CLOCK_REALTIME, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (timerFd_ < 0 || arm () != 0) {
+      LOG_W_STREAM << "Clock steps are not watched: " << std::strerror (errno) << std::endl;
+      if (timerFd_ >= 0)
+        ::close (timerFd_);
+      timerFd_ = -1;
+    }
+
+    zoneFd_ = inotify_init1 (IN_NONBLOCK | IN_CLOEXEC);
+    std::filesystem::path dir
+        = zoneFile.parent_path ().empty () ? "." : zoneFile.parent_path ();
+    if (zoneFd_ < 0
+        || inotify_add_watch (zoneFd_, dir.c_str (),
+                              IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_DELETE)
+               < 0) {
+      LOG_W_STREAM << "Cannot watch " << zoneFile << ": " << std::strerror (errno) << std::endl;
+      if (zoneFd_ >= 0)
+        ::close (zoneFd_);
+      zoneFd_ = -1;
+    }
+  }
+
+  ClockWatch::~ClockWatch () {
+    if (timerFd_ >= 0)
+      ::close (timerFd_);
+    if (zoneFd_ >= 0)
+      ::close (zoneFd_);
+  }
+
+  // never expires, only the cancel on a clock change makes it readable
+  int ClockWatch::arm () {
+    itimerspec spec {};
+    spec.it_value.tv_sec = static_cast<time_t> (kFarFuture);
+    return timerfd_settime (timerFd_, TFD_TIMER_ABSTIME | TFD_TIMER_CANCEL_ON_SET, &spec,
+                            nullptr);
+  }
+
+  std::vector<int> ClockWatch::fds () const {
+    std::vector<int> fds;
+    if (timerFd_ >= 0)
+      fds.push_back (timerFd_);
+    if (zoneFd_ >= 0)
+      fds.push_back (zoneFd_);
+    return fds;
+  }
+
+  unsigned ClockWatch::check () {
+    unsigned changes = 0;
+    if (timerFd_ >= 0) {
+      std::uint64_t expirations;
+      if (::read (timerFd_, &expirations, sizeof (expirations)) < 0 && errno == ECANCELED) {
+        changes |= kClockStepped;
+        arm (); // a canceled timer stays disarmed
+      }
+      std::int64_t suspended = suspendedNs ();
+      if (suspended - suspendedNs_ > kResumeThresholdNs)
+        changes |= kClockResumed;
+      suspendedNs_ = suspended;
+    }
+
+    if (zoneFd_ >= 0) {
+      alignas (inotify_event) char buffer[16 * (sizeof (inotify_event) + NAME_MAX + 1)];
+      for (;;) {
+        ssize_t n = ::read (zoneFd_, buffer, sizeof (buffer));
+        if (n <= 0)
+          break; // EAGAIN, drained
+        for (char* p = buffer; p < buffer + n;) {
+          const auto* event = reinterpret_cast<const inotify_event*> (p);
+          if (event->len > 0 && zoneName_ == event->name)
+            changes |= kZoneChanged;
+          p += sizeof (inotify_event) + event->len;
+        }
+      }
+      if (changes & kZoneChanged)
+        tzset (); // localtime_r () does not reread the zone on its own
+    }
+    return changes;
+  }
+#else
+  ClockWatch::ClockWatch (const std::filesystem::path& zoneFile)
+      : zoneName_ (zoneFile.filename ().string ()) {
+  }
+
+  ClockWatch::~ClockWatch () = default;
+
+  int ClockWatch::arm () {
+    return -1;
+  }
+
+  std::vector<int> ClockWatch::fds () const {
+    return {};
+  }
+
+  unsigned ClockWatch::check () {
+    return 0;
+  }
+#endif
+
+} // namespace dotname
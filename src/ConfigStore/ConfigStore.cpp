@@ -0,0 +1,267 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/ConfigStore.hpp>
+#include <Logger/Logger.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <fstream>
+
+#if defined(__linux__) || defined(__APPLE__)
+  #include <cerrno>
+  #include <cstring>
+  #include <fcntl.h>
+  #include <unistd.h>
+#endif
+#if defined(__linux__)
+  #include <climits>
+  #include <sys/inotify.h>
+#endif
+
+namespace dotname {
+
+  struct ConfigStore::Values {
+    nlohmann::json json = nlohmann::json::object ();
+  };
+
+  namespace {
+
+    template <typename T>
+    T valueOr (const nlohmann::json& json, const std::string& key, const T& fallback) {
+      auto it = json.find (key);
+      if (it == json.end ())
+        return fallback;
+      try {
+        return it->get<T> ();
+      } catch (const nlohmann::json::exception&) {
+        LOG_W_STREAM << "Config key " << key << " has the wrong type, using the default"
+                     << std::endl;
+        return fallback;
+      }
+    }
+
+#if defined(__linux__) || defined(__APPLE__)
+    int writeDurably (const std::filesystem::path& file, const std::string& text) {
+      std::filesystem::path temp = file;
+      temp += ".tmp." + std::to_string (getpid ());
+      int fd = ::open (temp.c_str (), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+      if (fd < 0) {
+        LOG_E_STREAM << "Failed to open " << temp << ": " << std::strerror (errno) << std::endl;
+        return -1;
+      }
+      const char* p = text.data ();
+      std::size_t left = text.size ();
+      while (left > 0) {
+        ssize_t n = ::write (fd, p, left);
+        if (n < 0 && errno == EINTR)
+          continue;
+        if (n <= 0)
+          break;
+        p += n;
+        left -= static_cast<std::size_t> (n);
+      }
+      // the data has to be on disk before the rename makes it the config
+      if (left > 0 || ::fsync (fd) != 0) {
+        LOG_E_STREAM << "Failed to write " << temp << ": " << std::strerror (errno) << std::endl;
+        ::close (fd);
+        ::unlink (temp.c_str ());
+        return -1;
+      }
+      ::close (fd);
+      if (::rename (temp.c_str (), file.c_str ()) != 0) {
+        LOG_E_STREAM << "Failed to replace " << file << ": " << std::strerror (errno)
+                     << std::endl;
+        ::unlink (temp.c_str ());
+        return -1;
+      }
+      // and the rename itself survives a crash once the directory entry is synced
+      std::filesystem::path dir = file.parent_path ().empty () ? "." : file.parent_path ();
+      int dirFd = ::open (dir.c_str (), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+      if (dirFd >= 0) {
+        ::fsync (dirFd);
+        ::close (dirFd);
+      }
+      return 0;
+    }
+#else
+    int writeDurably (const std::filesystem::path& file, const std::string& text) {
+      std::filesystem::path temp = file;
+      temp += ".tmp";
+      {
+        std::ofstream out (temp, std::ios::binary | std::ios::trunc);
+        if (!out.is_open () || !(out << text) || !out.flush ()) {
+          LOG_E_STREAM << "Failed to write " << temp << std::endl;
+          return -1;
+        }
+      }
+      std::error_code ec;
+      std::filesystem::rename (temp, file, ec);
+      if (ec) {
+        LOG_E_STREAM << "Failed to replace " << file << ": " << ec.message () << std::endl;
+        std::filesystem::remove (temp, ec);
+        return -1;
+      }
+      return 0;
+    }
+#endif
+
+  } // namespace
+
+  ConfigStore::ConfigStore (const std::filesystem::path& file)
+      : file_ (file), values_ (std::make_unique<Values> ()) {
+  }
+
+  ConfigStore::ConfigStore (ConfigStore&&) noexcept = default;
+  ConfigStore& ConfigStore::operator= (ConfigStore&&) noexcept = default;
+  ConfigStore::~ConfigStore () = default;
+
+  int ConfigStore::load () {
+    ++stats_.loads;
+    values_->json = nlohmann::json::object ();
+    // a missing or broken file gets written on the next commit
+    dirty_ = true;
+
+    std::ifstream in (file_);
+    if (!in.is_open ()) {
+      LOG_E_STREAM << "Failed to open config file: " << file_ << std::endl;
+      return -1;
+    }
+    nlohmann::json json;
+    try {
+      in >> json;
+    } catch (const nlohmann::json::parse_error& e) {
+      LOG_E_STREAM << "Failed to parse config file: " << e.what () << std::endl;
+      return -1;
+    }
+    if (!json.is_object ()) {
+      LOG_E_STREAM << "Config file is not a JSON object: " << file_ << std::endl;
+      return -1;
+    }
+    values_->json = std::move (json);
+    dirty_ = false;
+    return 0;
+  }
+
+  int ConfigStore::commit () {
+    if (!dirty_) {
+      ++stats_.skipped;
+      return 0;
+    }
+    std::string text;
+    try {
+      text = values_->json.dump (4); // Pretty print with 4 spaces
+    } catch (const nlohmann::json::exception& e) {
+      LOG_E_STREAM << "Failed to write config file: " << e.what () << std::endl;
+      return -1;
+    }
+    if (writeDurably (file_, text) != 0)
+      return -1;
+    ++stats_.writes;
+    dirty_ = false;
+    return 0;
+  }
+
+  double ConfigStore::get (const std::string& key, double fallback) const {
+    return valueOr (values_->json, key, fallback);
+  }
+
+  int ConfigStore::get (const std::string& key, int fallback) const {
+    return valueOr (values_->json, key, fallback);
+  }
+
+  std::string ConfigStore::get (const std::string& key, const std::string& fallback) const {
+    return valueOr (values_->json, key, fallback);
+  }
+
+  std::vector<std::string> ConfigStore::get (const std::string& key,
+                                             const std::vector<std::string>& fallback) const {
+    return valueOr (values_->json, key, fallback);
+  }
+
+  // json compares numbers by value, 50 in the file equals 50.0 set here
+  void ConfigStore::set (const std::string& key, double value) {
+    auto& slot = values_->json[key];
+    if (slot != value) {
+      slot = value;
+      dirty_ = true;
+    }
+  }
+
+  void ConfigStore::set (const std::string& key, int value) {
+    auto& slot = values_->json[key];
+    if (slot != value) {
+      slot = value;
+      dirty_ = true;
+    }
+  }
+
+  void ConfigStore::set (const std::string& key, const std::string& value) {
+    auto& slot = values_->json[key];
+    if (slot != value) {
+      slot = value;
+      dirty_ = true;
+    }
+  }
+
+  void ConfigStore::set (const std::string& key, const std::vector<std::string>& value) {
+    auto& slot = values_->json[key];
+    if (slot != nlohmann::json (value)) {
+      slot = value;
+      dirty_ = true;
+    }
+  }
+
+#if defined(__linux__)
+  ConfigWatcher::ConfigWatcher (const std::filesystem::path& file)
+      : name_ (file.filename ().string ()) {
+    fd_ = inotify_init1 (IN_NONBLOCK | IN_CLOEXEC);
+    if (fd_ < 0) {
+      LOG_W_STREAM << "inotify_init1: " << std::strerror (errno) << std::endl;
+      return;
+    }
+    // editors and commit () replace the file, a watch on its inode would go stale
+    std::filesystem::path dir = file.parent_path ().empty () ? "." : file.parent_path ();
+    if (inotify_add_watch (fd_, dir.c_str (), IN_CLOSE_WRITE | IN_MOVED_TO) < 0) {
+      LOG_W_STREAM << "Cannot watch " << dir << ": " << std::strerror (errno) << std::endl;
+      ::close (fd_);
+      fd_ = -1;
+    }
+  }
+
+  ConfigWatcher::~ConfigWatcher () {
+    if (fd_ >= 0)
+      ::close (fd_);
+  }
+
+  bool ConfigWatcher::changed () {
+    if (fd_ < 0)
+      return false;
+    bool hit = false;
+    alignas (inotify_event) char buffer[16 * (sizeof (inotify_event) + NAME_MAX + 1)];
+    for (;;) {
+      ssize_t n = ::read (fd_, buffer, sizeof (buffer));
+      if (n <= 0)
+        break; // EAGAIN, drained
+      for (char* p = buffer; p < buffer + n;) {
+        const auto* event = reinterpret_cast<const inotify_event*> (p);
+        if (event->len > 0 && name_ == event->name)
+          hit = true;
+        p += sizeof (inotify_event) + event->len;
+      }
+    }
+    return hit;
+  }
+#else
+  ConfigWatcher::ConfigWatcher (const std::filesystem::path& file)
+      : name_ (file.filename ().string ()) {
+  }
+
+  ConfigWatcher::~ConfigWatcher () = default;
+
+  bool ConfigWatcher::changed () {
+    return false;
+  }
+#endif
+
+} // namespace dotname
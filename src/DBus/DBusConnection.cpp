@@ -0,0 +1,539 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include "DBusConnection.hpp"
+
+#include <cerrno>
+#include <cstddef>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+
+#if !defined(_WIN32)
+  #include <poll.h>
+  #include <sys/socket.h>
+  #include <sys/un.h>
+  #include <unistd.h>
+#endif
+
+namespace dotname::dbus {
+
+  namespace {
+
+    // header fields
+    constexpr std::uint8_t kFieldPath = 1;
+    constexpr std::uint8_t kFieldInterface = 2;
+    constexpr std::uint8_t kFieldMember = 3;
+    constexpr std::uint8_t kFieldErrorName = 4;
+    constexpr std::uint8_t kFieldReplySerial = 5;
+    constexpr std::uint8_t kFieldDestination = 6;
+    constexpr std::uint8_t kFieldSender = 7;
+    constexpr std::uint8_t kFieldSignature = 8;
+
+    constexpr std::size_t kMaxMessage = std::size_t (1) << 27; // the D-Bus limit
+
+    char hostEndian () {
+      const std::uint16_t probe = 1;
+      char low;
+      std::memcpy (&low, &probe, 1);
+      return low ? 'l' : 'B';
+    }
+
+    void pad (std::string& s, std::size_t alignment) {
+      s.resize ((s.size () + alignment - 1) / alignment * alignment, '\0');
+    }
+
+    void putUint32 (std::string& s, std::uint32_t v) {
+      pad (s, 4);
+      s.append (reinterpret_cast<const char*> (&v), 4);
+    }
+
+    void putString (std::string& s, const std::string& v) {
+      putUint32 (s, static_cast<std::uint32_t> (v.size ()));
+      s.append (v);
+      s.push_back ('\0');
+    }
+
+    void putSignature (std::string& s, const std::string& v) {
+      s.push_back (static_cast<char> (v.size ()));
+      s.append (v);
+      s.push_back ('\0');
+    }
+
+    void putField (std::string& s, std::uint8_t code, char type, const std::string& v) {
+      if (v.empty ())
+        return;
+      pad (s, 8);
+      s.push_back (static_cast<char> (code));
+      putSignature (s, std::string (1, type));
+      if (type == 'g')
+        putSignature (s, v);
+      else
+        putString (s, v);
+    }
+
+    std::string marshal (const Message& m) {
+      std::string s;
+      s.push_back (hostEndian ());
+      s.push_back (static_cast<char> (m.type));
+      s.push_back (static_cast<char> (m.flags));
+      s.push_back (1); // protocol version
+      putUint32 (s, static_cast<std::uint32_t> (m.body.size ()));
+      putUint32 (s, m.serial);
+      putUint32 (s, 0); // header fields length, patched below
+
+      putField (s, kFieldPath, 'o', m.path);
+      putField (s, kFieldInterface, 's', m.interface);
+      putField (s, kFieldMember, 's', m.member);
+      putField (s, kFieldErrorName, 's', m.errorName);
+      if (m.replySerial) {
+        pad (s, 8);
+        s.push_back (static_cast<char> (kFieldReplySerial));
+        putSignature (s, "u");
+        putUint32 (s, m.replySerial);
+      }
+      putField (s, kFieldDestination, 's', m.destination);
+      putField (s, kFieldSender, 's', m.sender);
+      putField (s, kFieldSignature, 'g', m.signature);
+
+      auto fields = static_cast<std::uint32_t> (s.size () - 16);
+      std::memcpy (&s[12], &fields, 4);
+      pad (s, 8);
+      s.append (m.body);
+      return s;
+    }
+
+    // Cursor over a message or body with D-Bus alignment, relative to its start
+    struct Cursor {
+      const char* data;
+      std::size_t size;
+      std::size_t pos = 0;
+
+      bool align (std::size_t alignment) {
+        std::size_t next = (pos + alignment - 1) / alignment * alignment;
+        if (next > size)
+          return false;
+        pos = next;
+        return true;
+      }
+      bool byte (std::uint8_t& v) {
+        if (pos >= size)
+          return false;
+        v = static_cast<std::uint8_t> (data[pos++]);
+        return true;
+      }
+      bool uint32 (std::uint32_t& v) {
+        if (!align (4) || size - pos < 4)
+          return false;
+        std::memcpy (&v, data + pos, 4);
+        pos += 4;
+        return true;
+      }
+      bool chars (std::size_t n, std::string& v) {
+        if (size - pos < n + 1 || data[pos + n] != '\0')
+          return false;
+        v.assign (data + pos, n);
+        pos += n + 1;
+        return true;
+      }
+      bool string (std::string& v) {
+        std::uint32_t n;
+        return uint32 (n) && chars (n, v);
+      }
+      bool signature (std::string& v) {
+        std::uint8_t n;
+        return byte (n) && chars (n, v);
+      }
+    };
+
+    // 1 = complete message parsed and consumed, 0 = need more data, -1 = malformed
+    int unmarshal (std::string& buffer, Message& m) {
+      if (buffer.size () < 16)
+        return 0;
+      if (buffer[0] != hostEndian () || buffer[3] != 1)
+        return -1;
+      std::uint32_t bodySize, fieldsSize;
+      std::memcpy (&bodySize, &buffer[4], 4);
+      std::memcpy (&fieldsSize, &buffer[12], 4);
+      std::size_t headerSize = (16 + std::size_t (fieldsSize) + 7) / 8 * 8;
+      std::size_t total = headerSize + bodySize;
+      if (total > kMaxMessage)
+        return -1;
+      if (buffer.size () < total)
+        return 0;
+
+      m = Message ();
+      m.type = static_cast<MessageType> (buffer[1]);
+      m.flags = static_cast<std::uint8_t> (buffer[2]);
+      std::memcpy (&m.serial, &buffer[8], 4);
+
+      Cursor c { buffer.data (), 16 + std::size_t (fieldsSize), 16 };
+      while (c.pos < c.size) {
+        std::uint8_t code;
+        std::string type;
+        if (!c.align (8) || !c.byte (code) || !c.signature (type) || type.size () != 1)
+          return -1;
+        std::string value;
+        std::uint32_t number = 0;
+        bool ok = type == "u" ? c.uint32 (number)
+                  : type == "g" ? c.signature (value)
+                  : (type == "s" || type == "o") ? c.string (value)
+                  : false; // no other types in the fields defined so far
+        if (!ok)
+          return -1;
+        switch (code) {
+        case kFieldPath:
+          m.path = value;
+          break;
+        case kFieldInterface:
+          m.interface = value;
+          break;
+        case kFieldMember:
+          m.member = value;
+          break;
+        case kFieldErrorName:
+          m.errorName = value;
+          break;
+        case kFieldReplySerial:
+          m.replySerial = number;
+          break;
+        case kFieldDestination:
+          m.destination = value;
+          break;
+        case kFieldSender:
+          m.sender = value;
+          break;
+        case kFieldSignature:
+          m.signature = value;
+          break;
+        default:
+          break; // unknown fields are ignored
+        }
+      }
+      m.body.assign (buffer, headerSize, bodySize);
+      buffer.erase (0, total);
+      return 1;
+    }
+
+#if !defined(_WIN32)
+    std::string unescape (const std::string& v) {
+      std::string out;
+      for (std::size_t i = 0; i < v.size (); ++i) {
+        if (v[i] == '%' && i + 2 < v.size ()) {
+          out.push_back (static_cast<char> (std::strtol (v.substr (i + 1, 2).c_str (), nullptr,
+                                                         16)));
+          i += 2;
+        } else {
+          out.push_back (v[i]);
+        }
+      }
+      return out;
+    }
+
+    // unix:path=... / unix:abstract=... entry to a socket address, false for others
+    bool socketAddress (const std::string& entry, sockaddr_un& sa, socklen_t& length) {
+      if (entry.compare (0, 5, "unix:") != 0)
+        return false;
+      std::size_t pos = 5;
+      while (pos <= entry.size ()) {
+        std::size_t comma = entry.find (',', pos);
+        std::string pair = entry.substr (pos, comma - pos);
+        std::size_t eq = pair.find ('=');
+        if (eq != std::string::npos) {
+          std::string key = pair.substr (0, eq);
+          std::string value = unescape (pair.substr (eq + 1));
+          bool abstract = key == "abstract";
+          if ((key == "path" || abstract) && value.size () + 1 < sizeof (sa.sun_path)) {
+            std::memset (&sa, 0, sizeof (sa));
+            sa.sun_family = AF_UNIX;
+            std::memcpy (sa.sun_path + (abstract ? 1 : 0), value.data (), value.size ());
+            length = static_cast<socklen_t> (offsetof (sockaddr_un, sun_path) + value.size ()
+                                             + 1);
+            return true;
+          }
+        }
+        if (comma == std::string::npos)
+          break;
+        pos = comma + 1;
+      }
+      return false;
+    }
+
+    int remaining (std::chrono::steady_clock::time_point deadline) {
+      using namespace std::chrono;
+      auto left = duration_cast<milliseconds> (deadline - steady_clock::now ()).count ();
+      return left > 0 ? static_cast<int> (left) : 0;
+    }
+#endif
+
+  } // namespace
+
+  void BodyWriter::uint32 (std::uint32_t value) {
+    putUint32 (body_, value);
+  }
+
+  void BodyWriter::string (const std::string& value) {
+    putString (body_, value);
+  }
+
+  void BodyWriter::bytes (const std::string& value) {
+    putUint32 (body_, static_cast<std::uint32_t> (value.size ()));
+    body_.append (value);
+  }
+
+  bool BodyReader::uint32 (std::uint32_t& value) {
+    Cursor c { body_.data (), body_.size (), pos_ };
+    bool ok = c.uint32 (value);
+    pos_ = c.pos;
+    return ok;
+  }
+
+  bool BodyReader::boolean (bool& value) {
+    std::uint32_t v;
+    if (!uint32 (v) || v > 1)
+      return false;
+    value = v != 0;
+    return true;
+  }
+
+  bool BodyReader::string (std::string& value) {
+    Cursor c { body_.data (), body_.size (), pos_ };
+    bool ok = c.string (value);
+    pos_ = c.pos;
+    return ok;
+  }
+
+  bool BodyReader::bytes (std::string& value) {
+    Cursor c { body_.data (), body_.size (), pos_ };
+    std::uint32_t n;
+    if (!c.uint32 (n) || c.size - c.pos < n)
+      return false;
+    value.assign (c.data + c.pos, n);
+    pos_ = c.pos + n;
+    return true;
+  }
+
+#if !defined(_WIN32)
+
+  Connection::~Connection () {
+    close ();
+  }
+
+  int Connection::fail (const std::string& what) {
+    error_ = what;
+    close ();
+    return -1;
+  }
+
+  int Connection::connect (const std::string& address, int timeoutMs) {
+    close ();
+    std::string list = address;
+    if (list.empty ()) {
+      const char* env = std::getenv ("DBUS_SESSION_BUS_ADDRESS");
+      if (!env || !*env) {
+        error_ = "DBUS_SESSION_BUS_ADDRESS is not set";
+        return -1;
+      }
+      list = env;
+    }
+
+    std::size_t pos = 0;
+    while (fd_ < 0 && pos <= list.size ()) {
+      std::size_t semicolon = list.find (';', pos);
+      std::string entry = list.substr (pos, semicolon - pos);
+      pos = semicolon == std::string::npos ? list.size () + 1 : semicolon + 1;
+
+      sockaddr_un sa;
+      socklen_t length;
+      if (!socketAddress (entry, sa, length))
+        continue;
+      int fd = ::socket (AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+      if (fd < 0)
+        continue;
+      if (::connect (fd, reinterpret_cast<sockaddr*> (&sa), length) != 0) {
+        error_ = entry + ": " + std::strerror (errno);
+        ::close (fd);
+        continue;
+      }
+      fd_ = fd;
+    }
+    if (fd_ < 0) {
+      if (error_.empty ())
+        error_ = "no usable unix: entry in " + list;
+      return -1;
+    }
+
+    // a socket without auth and Hello is no connection, isConnected () must not say so
+    if (authenticate (timeoutMs) != 0) {
+      close ();
+      return -1;
+    }
+
+    Message hello, reply;
+    hello.destination = "org.freedesktop.DBus";
+    hello.path = "/org/freedesktop/DBus";
+    hello.interface = "org.freedesktop.DBus";
+    hello.member = "Hello";
+    if (call (hello, reply, timeoutMs) != 0) {
+      close ();
+      return -1;
+    }
+    if (!BodyReader (reply.body).string (uniqueName_))
+      return fail ("malformed Hello reply");
+    error_.clear ();
+    return 0;
+  }
+
+  void Connection::close () {
+    if (fd_ >= 0)
+      ::close (fd_);
+    fd_ = -1;
+    serial_ = 0;
+    uniqueName_.clear ();
+    buffer_.clear ();
+  }
+
+  int Connection::authenticate (int timeoutMs) {
+    auto deadline = std::chrono::steady_clock::now () + std::chrono::milliseconds (timeoutMs);
+    // the leading zero byte is the credentials byte; EXTERNAL takes the uid in hex ASCII
+    std::string uid = std::to_string (::getuid ());
+    std::string request ("\0AUTH EXTERNAL ", 15);
+    static const char hex[] = "0123456789abcdef";
+    for (char ch : uid) {
+      request.push_back (hex[static_cast<unsigned char> (ch) >> 4]);
+      request.push_back (hex[static_cast<unsigned char> (ch) & 0xf]);
+    }
+    request += "\r\n";
+    if (::send (fd_, request.data (), request.size (), MSG_NOSIGNAL)
+        != static_cast<ssize_t> (request.size ()))
+      return fail (std::string ("auth: ") + std::strerror (errno));
+
+    std::size_t eol;
+    while ((eol = buffer_.find ("\r\n")) == std::string::npos)
+      if (readSome (remaining (deadline)) != 0)
+        return -1;
+    std::string line = buffer_.substr (0, eol);
+    buffer_.erase (0, eol + 2);
+    if (line.compare (0, 3, "OK ") != 0)
+      return fail ("auth rejected: " + line);
+
+    static const char begin[] = "BEGIN\r\n";
+    if (::send (fd_, begin, sizeof (begin) - 1, MSG_NOSIGNAL)
+        != static_cast<ssize_t> (sizeof (begin) - 1))
+      return fail (std::string ("auth: ") + std::strerror (errno));
+    return 0;
+  }
+
+  int Connection::readSome (int timeoutMs) {
+    pollfd p { fd_, POLLIN, 0 };
+    int ready;
+    do
+      ready = ::poll (&p, 1, timeoutMs);
+    while (ready < 0 && errno == EINTR);
+    if (ready == 0) {
+      error_ = "timed out"; // a connected bus stays usable, connect () closes it
+      return -1;
+    }
+    if (ready < 0)
+      return fail (std::string ("poll: ") + std::strerror (errno));
+
+    char chunk[4096];
+    ssize_t n = ::recv (fd_, chunk, sizeof (chunk), 0);
+    if (n <= 0)
+      return fail (n == 0 ? "connection closed" : std::string ("recv: ") + std::strerror (errno));
+    buffer_.append (chunk, static_cast<std::size_t> (n));
+    return 0;
+  }
+
+  int Connection::send (Message& message) {
+    if (fd_ < 0)
+      return -1;
+    message.serial = ++serial_;
+    std::string data = marshal (message);
+    std::size_t sent = 0;
+    while (sent < data.size ()) {
+      ssize_t n = ::send (fd_, data.data () + sent, data.size () - sent, MSG_NOSIGNAL);
+      if (n < 0 && errno == EINTR)
+        continue;
+      if (n <= 0)
+        return fail (std::string ("send: ") + std::strerror (errno));
+      sent += static_cast<std::size_t> (n);
+    }
+    return 0;
+  }
+
+  int Connection::receive (Message& message, int timeoutMs) {
+    if (fd_ < 0)
+      return -1;
+    auto deadline = std::chrono::steady_clock::now () + std::chrono::milliseconds (timeoutMs);
+    for (;;) {
+      int parsed = unmarshal (buffer_, message);
+      if (parsed > 0)
+        return 0;
+      if (parsed < 0)
+        return fail ("malformed message");
+      if (readSome (remaining (deadline)) != 0)
+        return -1;
+    }
+  }
+
+  int Connection::call (Message& request, Message& reply, int timeoutMs) {
+    auto deadline = std::chrono::steady_clock::now () + std::chrono::milliseconds (timeoutMs);
+    request.type = MessageType::MethodCall;
+    if (send (request) != 0)
+      return -1;
+    for (;;) {
+      if (receive (reply, remaining (deadline)) != 0)
+        return -1;
+      if (reply.replySerial != request.serial)
+        continue; // signals such as NameAcquired
+      if (reply.type == MessageType::MethodReturn)
+        return 0;
+      if (reply.type == MessageType::Error) {
+        std::string text;
+        BodyReader (reply.body).string (text);
+        error_ = reply.errorName + (text.empty () ? "" : ": " + text);
+        return -1;
+      }
+    }
+  }
+
+#else // no session bus on Windows
+
+  Connection::~Connection () = default;
+
+  int Connection::fail (const std::string& what) {
+    error_ = what;
+    return -1;
+  }
+
+  int Connection::connect (const std::string&, int) {
+    return fail ("D-Bus is not available on this platform");
+  }
+
+  void Connection::close () {
+  }
+
+  int Connection::authenticate (int) {
+    return -1;
+  }
+
+  int Connection::readSome (int) {
+    return -1;
+  }
+
+  int Connection::send (Message&) {
+    return -1;
+  }
+
+  int Connection::receive (Message&, int) {
+    return -1;
+  }
+
+  int Connection::call (Message&, Message&, int) {
+    return -1;
+  }
+
+#endif
+
+} // namespace dotname::dbus
@@ -0,0 +1,117 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __DBUSCONNECTION_HPP
+#define __DBUSCONNECTION_HPP
+
+// Minimal D-Bus client over an AF_UNIX socket: EXTERNAL authentication, Hello, method
+// calls and replies in host byte order
+
+#include <cstdint>
+#include <string>
+
+namespace dotname::dbus {
+
+  enum class MessageType : std::uint8_t {
+    Invalid = 0,
+    MethodCall = 1,
+    MethodReturn = 2,
+    Error = 3,
+    Signal = 4,
+  };
+
+  // flags
+  constexpr std::uint8_t kNoReplyExpected = 0x1;
+
+  struct Message {
+    MessageType type = MessageType::MethodCall;
+    std::uint8_t flags = 0;
+    std::uint32_t serial = 0;
+    std::uint32_t replySerial = 0;
+    std::string path, interface, member, errorName, destination, sender;
+    std::string signature; // of the body
+    std::string body;      // marshalled arguments, see BodyWriter / BodyReader
+  };
+
+  // Appends arguments with D-Bus alignment; the body starts 8 byte aligned in the message
+  class BodyWriter {
+  public:
+    explicit BodyWriter (std::string& body) : body_ (body) {
+    }
+    void uint32 (std::uint32_t value);
+    void string (const std::string& value); // s and o
+    void bytes (const std::string& value);  // ay
+
+  private:
+    std::string& body_;
+  };
+
+  // Reads arguments in order, false when the body is too short or malformed
+  class BodyReader {
+  public:
+    explicit BodyReader (const std::string& body) : body_ (body) {
+    }
+    bool uint32 (std::uint32_t& value);
+    bool boolean (bool& value); // b, a uint32 of 0 or 1
+    bool string (std::string& value);
+    bool bytes (std::string& value);
+
+  private:
+    const std::string& body_;
+    std::size_t pos_ = 0;
+  };
+
+  class Connection {
+  public:
+    Connection () = default;
+    ~Connection ();
+
+    Connection (const Connection&) = delete;
+    Connection& operator= (const Connection&) = delete;
+
+    // Connects, authenticates and says Hello. An empty address reads
+    // DBUS_SESSION_BUS_ADDRESS; unix:path= and unix:abstract= entries are tried in order.
+    // 0 on success, -1 on failure
+    int connect (const std::string& address = {}, int timeoutMs = 2000);
+    void close ();
+    bool isConnected () const {
+      return fd_ >= 0;
+    }
+    // socket to poll () for incoming messages, -1 when closed
+    int fd () const {
+      return fd_;
+    }
+    // name assigned by the bus on Hello
+    const std::string& uniqueName () const {
+      return uniqueName_;
+    }
+
+    // assigns message.serial, 0 on success, -1 on failure (connection closed)
+    int send (Message& message);
+    // next incoming message, -1 on timeout, error or a malformed message; a timeout of 0
+    // only takes what is already buffered or readable
+    int receive (Message& message, int timeoutMs);
+    // send () and wait for the reply to it, other messages meanwhile are dropped;
+    // an Error reply is returned in reply with -1
+    int call (Message& request, Message& reply, int timeoutMs);
+
+    // the last failure, for logging
+    const std::string& error () const {
+      return error_;
+    }
+
+  private:
+    int fail (const std::string& what);
+    int authenticate (int timeoutMs);
+    int readSome (int timeoutMs);
+
+    int fd_ = -1;
+    std::uint32_t serial_ = 0;
+    std::string uniqueName_;
+    std::string buffer_; // received, not yet parsed
+    std::string error_;
+  };
+
+} // namespace dotname::dbus
+
+#endif // __DBUSCONNECTION_HPP
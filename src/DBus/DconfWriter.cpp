@@ -0,0 +1,67 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/DconfWriter.hpp>
+
+#include "DBusConnection.hpp"
+#include "GVariant.hpp"
+#include <Trace/Trace.hpp>
+
+namespace dotname {
+
+  DconfWriter::DconfWriter () : bus_ (std::make_unique<dbus::Connection> ()) {
+  }
+
+  DconfWriter::~DconfWriter () = default;
+
+  int DconfWriter::connect (const std::string& address) {
+    address_ = address;
+    if (bus_->connect (address) != 0) {
+      error_ = bus_->error ();
+      return -1;
+    }
+    return 0;
+  }
+
+  bool DconfWriter::isConnected () const {
+    return bus_->isConnected ();
+  }
+
+  int DconfWriter::write (const std::vector<std::pair<std::string, std::string>>& keys,
+                          int timeoutMs) {
+    TRACE_SPAN ("dconf Change");
+    std::vector<gvariant::Change> changes;
+    changes.reserve (keys.size ());
+    for (const auto& key : keys)
+      changes.emplace_back (key.first, key.second);
+
+    dbus::Message request, reply;
+    request.destination = "ca.desrt.dconf";
+    request.path = "/ca/desrt/dconf/Writer/user";
+    request.interface = "ca.desrt.dconf.Writer";
+    request.member = "Change";
+    request.signature = "ay";
+    dbus::BodyWriter (request.body).bytes (gvariant::serializeChangeset (changes));
+
+    // a kept connection may have been dropped by a restarted bus, reconnect once
+    for (int attempt = 0; attempt < 2; ++attempt) {
+      bool fresh = !bus_->isConnected ();
+      if (fresh && connect (address_) != 0)
+        return -1;
+      if (bus_->call (request, reply, timeoutMs) == 0)
+        return 0;
+      error_ = bus_->error ();
+      if (fresh || bus_->isConnected ())
+        return -1; // dconf answered with an error or timed out
+    }
+    return -1;
+  }
+
+  int DconfWriter::switchLightTheme (bool lightTheme) {
+    return write ({
+        { "/org/gnome/desktop/interface/color-scheme", lightTheme ? "default" : "prefer-dark" },
+        { "/org/gnome/desktop/interface/gtk-theme", lightTheme ? "Adwaita" : "Adwaita-dark" },
+    });
+  }
+
+} // namespace dotname
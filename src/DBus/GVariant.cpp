@@ -0,0 +1,173 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include "GVariant.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+namespace dotname::gvariant {
+
+  namespace {
+
+    // dict entries and the variants inside them are 8 byte aligned
+    constexpr std::size_t kAlign = 8;
+
+    std::size_t alignUp (std::size_t n) {
+      return (n + kAlign - 1) & ~(kAlign - 1);
+    }
+
+    // width of the framing offsets of a container of `size` bytes
+    std::size_t offsetSize (std::size_t size) {
+      if (size == 0)
+        return 0;
+      if (size <= 0xff)
+        return 1;
+      if (size <= 0xffff)
+        return 2;
+      if (size <= 0xffffffffu)
+        return 4;
+      return 8;
+    }
+
+    // smallest offset width where body plus `count` offsets still fits
+    std::size_t offsetSizeFor (std::size_t body, std::size_t count) {
+      for (std::size_t width : { 1, 2, 4 })
+        if (offsetSize (body + count * width) <= width)
+          return width;
+      return 8;
+    }
+
+    void appendOffset (std::string& out, std::uint64_t value, std::size_t width) {
+      // host order, the low bytes of the value
+      switch (width) {
+      case 1: {
+        auto v = static_cast<std::uint8_t> (value);
+        out.append (reinterpret_cast<const char*> (&v), 1);
+        break;
+      }
+      case 2: {
+        auto v = static_cast<std::uint16_t> (value);
+        out.append (reinterpret_cast<const char*> (&v), 2);
+        break;
+      }
+      case 4: {
+        auto v = static_cast<std::uint32_t> (value);
+        out.append (reinterpret_cast<const char*> (&v), 4);
+        break;
+      }
+      default:
+        out.append (reinterpret_cast<const char*> (&value), 8);
+      }
+    }
+
+    std::uint64_t readOffset (const char* p, std::size_t width) {
+      switch (width) {
+      case 1:
+        return static_cast<std::uint8_t> (*p);
+      case 2: {
+        std::uint16_t v;
+        std::memcpy (&v, p, 2);
+        return v;
+      }
+      case 4: {
+        std::uint32_t v;
+        std::memcpy (&v, p, 4);
+        return v;
+      }
+      default: {
+        std::uint64_t v;
+        std::memcpy (&v, p, 8);
+        return v;
+      }
+      }
+    }
+
+    // {smv}: key, padding, maybe variant, key end offset
+    std::string serializeEntry (const Change& change) {
+      std::string entry = change.first;
+      entry.push_back ('\0');
+      const std::size_t keyEnd = entry.size ();
+      entry.resize (alignUp (entry.size ()), '\0'); // also before Nothing
+      if (change.second) {
+        entry.append (*change.second);
+        entry.push_back ('\0'); // end of the string
+        entry.push_back ('\0'); // variant: value, 0, type
+        entry.push_back ('s');
+        entry.push_back ('\0'); // Just of a variable sized type
+      }
+      appendOffset (entry, keyEnd, offsetSizeFor (entry.size (), 1));
+      return entry;
+    }
+
+    int parseEntry (const char* p, std::size_t size, Change& change) {
+      std::size_t width = offsetSize (size);
+      if (size < width + 1)
+        return -1;
+      std::size_t end = size - width;
+      std::uint64_t keyEnd = readOffset (p + end, width);
+      if (keyEnd == 0 || keyEnd > end || p[keyEnd - 1] != '\0')
+        return -1;
+      change.first.assign (p, keyEnd - 1);
+      change.second.reset ();
+
+      std::size_t value = alignUp (keyEnd);
+      if (value >= end)
+        return 0; // Nothing
+      // Just: variant followed by a zero byte; variant: value, 0, type string
+      if (end - value < 4 || p[end - 1] != '\0' || p[end - 2] != 's' || p[end - 3] != '\0'
+          || p[end - 4] != '\0')
+        return -1;
+      change.second = std::string (p + value, end - 4 - value);
+      if (change.second->find ('\0') != std::string::npos)
+        return -1;
+      return 0;
+    }
+
+  } // namespace
+
+  std::string serializeChangeset (const std::vector<Change>& changes) {
+    std::string out;
+    std::vector<std::size_t> ends;
+    ends.reserve (changes.size ());
+    for (const auto& change : changes) {
+      out.resize (alignUp (out.size ()), '\0');
+      out.append (serializeEntry (change));
+      ends.push_back (out.size ());
+    }
+    std::size_t width = offsetSizeFor (out.size (), ends.size ());
+    for (std::size_t end : ends)
+      appendOffset (out, end, width);
+    return out;
+  }
+
+  int parseChangeset (const std::string& data, std::vector<Change>& changes) {
+    changes.clear ();
+    const std::size_t size = data.size ();
+    if (size == 0)
+      return 0;
+    const char* p = data.data ();
+    std::size_t width = offsetSize (size);
+    if (size < width)
+      return -1;
+    // the last framing offset is the end of the last element, the offsets follow it
+    std::uint64_t offsets = readOffset (p + size - width, width);
+    if (offsets > size || (size - offsets) % width != 0)
+      return -1;
+    std::size_t count = (size - offsets) / width;
+    std::size_t start = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+      std::uint64_t end = readOffset (p + offsets + i * width, width);
+      start = alignUp (start);
+      if (end < start || end > offsets)
+        return -1;
+      Change change;
+      if (parseEntry (p + start, end - start, change) != 0)
+        return -1;
+      changes.push_back (std::move (change));
+      start = end;
+    }
+    return 0;
+  }
+
+} // namespace dotname::gvariant
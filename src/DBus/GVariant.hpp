@@ -0,0 +1,26 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __GVARIANT_HPP
+#define __GVARIANT_HPP
+
+// GVariant serialisation of a dconf changeset (type a{smv}), string values only
+
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace dotname::gvariant {
+
+  // dconf key and its new value, std::nullopt resets the key
+  using Change = std::pair<std::string, std::optional<std::string>>;
+
+  std::string serializeChangeset (const std::vector<Change>& changes);
+
+  // 0 on success, -1 when data is not a{smv} or holds values other than strings
+  int parseChangeset (const std::string& data, std::vector<Change>& changes);
+
+} // namespace dotname::gvariant
+
+#endif // __GVARIANT_HPP
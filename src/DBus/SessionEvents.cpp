@@ -0,0 +1,122 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/SessionEvents.hpp>
+
+#include "DBusConnection.hpp"
+
+#include <cstdlib>
+
+namespace dotname {
+
+  namespace {
+
+    constexpr char kScreenSaverRule[]
+        = "type='signal',interface='org.gnome.ScreenSaver',member='ActiveChanged'";
+    // only logind itself may announce a suspend
+    constexpr char kLogindRule[]
+        = "type='signal',sender='org.freedesktop.login1',path='/org/freedesktop/login1',"
+          "interface='org.freedesktop.login1.Manager',member='PrepareForSleep'";
+
+    std::string systemBusAddress () {
+      const char* address = std::getenv ("DBUS_SYSTEM_BUS_ADDRESS");
+      return address && *address ? address : "unix:path=/var/run/dbus/system_bus_socket";
+    }
+
+  } // namespace
+
+  const char* sessionEventName (SessionEvent event) {
+    switch (event) {
+    case SessionEvent::Locked:
+      return "locked";
+    case SessionEvent::Unlocked:
+      return "unlocked";
+    case SessionEvent::Suspending:
+      return "suspending";
+    case SessionEvent::Resumed:
+      return "resumed";
+    }
+    return "unknown";
+  }
+
+  SessionEventListener::SessionEventListener ()
+      : session_ (std::make_unique<dbus::Connection> ()),
+        system_ (std::make_unique<dbus::Connection> ()) {
+  }
+
+  SessionEventListener::~SessionEventListener () = default;
+
+  int SessionEventListener::subscribe (dbus::Connection& bus, const std::string& address,
+                                       const char* rule, int timeoutMs) {
+    if (bus.connect (address, timeoutMs) != 0) {
+      error_ = bus.error ();
+      return -1;
+    }
+    dbus::Message request, reply;
+    request.destination = "org.freedesktop.DBus";
+    request.path = "/org/freedesktop/DBus";
+    request.interface = "org.freedesktop.DBus";
+    request.member = "AddMatch";
+    request.signature = "s";
+    dbus::BodyWriter (request.body).string (rule);
+    if (bus.call (request, reply, timeoutMs) != 0) {
+      error_ = bus.error ();
+      bus.close ();
+      return -1;
+    }
+    return 0;
+  }
+
+  int SessionEventListener::connect (const std::string& sessionAddress,
+                                     const std::string& systemAddress, int timeoutMs) {
+    int session = subscribe (*session_, sessionAddress, kScreenSaverRule, timeoutMs);
+    std::string sessionError = error_;
+    int system = subscribe (*system_,
+                            systemAddress.empty () ? systemBusAddress () : systemAddress,
+                            kLogindRule, timeoutMs);
+    if (session != 0 && system != 0) {
+      error_ = "session bus: " + sessionError + ", system bus: " + error_;
+      return -1;
+    }
+    return 0;
+  }
+
+  bool SessionEventListener::listensToScreenSaver () const {
+    return session_->isConnected ();
+  }
+
+  bool SessionEventListener::listensToLogind () const {
+    return system_->isConnected ();
+  }
+
+  std::vector<int> SessionEventListener::fds () const {
+    std::vector<int> fds;
+    for (const auto* bus : { session_.get (), system_.get () })
+      if (bus->isConnected ())
+        fds.push_back (bus->fd ());
+    return fds;
+  }
+
+  void SessionEventListener::drain (dbus::Connection& bus, std::vector<SessionEvent>& events) {
+    dbus::Message message;
+    while (bus.isConnected () && bus.receive (message, 0) == 0) {
+      bool value;
+      if (message.type != dbus::MessageType::Signal || message.signature != "b"
+          || !dbus::BodyReader (message.body).boolean (value))
+        continue; // NameAcquired and the like
+      if (message.interface == "org.gnome.ScreenSaver" && message.member == "ActiveChanged")
+        events.push_back (value ? SessionEvent::Locked : SessionEvent::Unlocked);
+      else if (message.interface == "org.freedesktop.login1.Manager"
+               && message.member == "PrepareForSleep")
+        events.push_back (value ? SessionEvent::Suspending : SessionEvent::Resumed);
+    }
+  }
+
+  std::size_t SessionEventListener::drain (std::vector<SessionEvent>& events) {
+    std::size_t before = events.size ();
+    drain (*session_, events);
+    drain (*system_, events);
+    return events.size () - before;
+  }
+
+} // namespace dotname
@@ -0,0 +1,353 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/EventLoop.hpp>
+#include <Logger/Logger.hpp>
+
+#include <algorithm>
+#include <exception>
+
+#if defined(__linux__)
+  #include <cerrno>
+  #include <csignal>
+  #include <cstring>
+  #include <filesystem>
+  #include <pthread.h>
+  #include <sys/epoll.h>
+  #include <sys/signalfd.h>
+  #include <sys/syscall.h>
+  #include <sys/timerfd.h>
+  #include <sys/wait.h>
+  #include <unistd.h>
+#endif
+
+namespace dotname {
+
+  std::coroutine_handle<>
+  Task::promise_type::FinalAwaiter::await_suspend (std::coroutine_handle<promise_type> h) noexcept {
+    promise_type& promise = h.promise ();
+    if (promise.continuation)
+      return promise.continuation;
+    if (promise.loop)
+      promise.loop->retire (h); // destroys the frame
+    return std::noop_coroutine ();
+  }
+
+  void Task::promise_type::unhandled_exception () {
+    try {
+      throw;
+    } catch (const std::exception& e) {
+      LOG_E_STREAM << "Task failed: " << e.what () << std::endl;
+    } catch (...) {
+      LOG_E_STREAM << "Task failed" << std::endl;
+    }
+    result = -1;
+  }
+
+  Task& Task::operator= (Task&& other) noexcept {
+    if (this != &other) {
+      if (handle_)
+        handle_.destroy ();
+      handle_ = other.handle_;
+      other.handle_ = nullptr;
+    }
+    return *this;
+  }
+
+  Task::~Task () {
+    if (handle_)
+      handle_.destroy ();
+  }
+
+  void EventLoop::spawn (Task task) {
+    auto handle = task.handle_;
+    task.handle_ = nullptr;
+    if (!handle)
+      return;
+    handle.promise ().loop = this;
+    tasks_.push_back (handle);
+    post (handle);
+  }
+
+  void EventLoop::retire (std::coroutine_handle<Task::promise_type> handle) {
+    if (!stopped_)
+      rc_ = handle.promise ().result;
+    tasks_.erase (std::find (tasks_.begin (), tasks_.end (), handle));
+    handle.destroy ();
+  }
+
+  void EventLoop::stop (int rc) {
+    stopped_ = true;
+    rc_ = rc;
+  }
+
+  bool EventLoop::SleepWait::await_ready () noexcept {
+    if (timer && timer->woken_) {
+      timer->woken_ = false;
+      result = 1;
+      return true;
+    }
+    return at <= std::chrono::system_clock::now ();
+  }
+
+  void EventLoop::SleepWait::await_suspend (std::coroutine_handle<> caller) {
+    handle = caller;
+    node = loop->timers_.emplace (at, this);
+    if (timer)
+      timer->sleeper_ = this;
+  }
+
+  void EventLoop::cancel (SleepWait& sleep) {
+    timers_.erase (sleep.node);
+    if (sleep.timer)
+      sleep.timer->sleeper_ = nullptr;
+  }
+
+  void LoopTimer::wake () {
+    if (!sleeper_) {
+      woken_ = true;
+      return;
+    }
+    EventLoop::SleepWait* sleep = sleeper_;
+    loop_.cancel (*sleep);
+    sleep->result = 1;
+    loop_.post (sleep->handle);
+  }
+
+#if defined(__linux__)
+  namespace {
+
+    constexpr int kMaxEvents = 64;
+
+    sigset_t sigsetOf (const std::vector<int>& signals) {
+      sigset_t set;
+      sigemptyset (&set);
+      for (int signo : signals)
+        sigaddset (&set, signo);
+      return set;
+    }
+
+  } // namespace
+
+  SignalSet::SignalSet (std::initializer_list<int> signals) : signals_ (signals) {
+    // the mask is per thread, threads started earlier would still take the signals
+    std::error_code ec;
+    std::ptrdiff_t threads = 0;
+    for (auto it = std::filesystem::directory_iterator ("/proc/self/task", ec);
+         !ec && it != std::filesystem::directory_iterator (); it.increment (ec))
+      ++threads;
+    if (threads > 1) {
+      LOG_E_STREAM << "Signals not blocked, " << threads << " threads already running" << std::endl;
+      return;
+    }
+    sigset_t set = sigsetOf (signals_);
+    int rc = pthread_sigmask (SIG_BLOCK, &set, nullptr);
+    if (rc != 0 || (fd_ = signalfd (-1, &set, SFD_NONBLOCK | SFD_CLOEXEC)) < 0) {
+      LOG_E_STREAM << "signalfd: " << std::strerror (rc != 0 ? rc : errno) << std::endl;
+      fd_ = -1;
+    }
+  }
+
+  SignalSet::~SignalSet () {
+    if (fd_ < 0)
+      return;
+    ::close (fd_);
+    sigset_t set = sigsetOf (signals_);
+    pthread_sigmask (SIG_UNBLOCK, &set, nullptr);
+  }
+
+  EventLoop::EventLoop () {
+    epoll_ = epoll_create1 (EPOLL_CLOEXEC);
+    timerFd_ = timerfd_create (CLOCK_REALTIME, TFD_NONBLOCK | TFD_CLOEXEC);
+    epoll_event ev {};
+    ev.events = EPOLLIN;
+    ev.data.ptr = nullptr; // the timerfd, every other registration points to its FdWait
+    if (epoll_ < 0 || timerFd_ < 0 || epoll_ctl (epoll_, EPOLL_CTL_ADD, timerFd_, &ev) != 0)
+      LOG_E_STREAM << "epoll/timerfd: " << std::strerror (errno) << std::endl;
+  }
+
+  EventLoop::~EventLoop () {
+    for (auto handle : tasks_)
+      handle.destroy ();
+    if (timerFd_ >= 0)
+      ::close (timerFd_);
+    if (epoll_ >= 0)
+      ::close (epoll_);
+  }
+
+  EventLoop::FdWait EventLoop::wait (int fd, std::uint32_t events) {
+    return { this, fd, events };
+  }
+
+  bool EventLoop::FdWait::await_suspend (std::coroutine_handle<> caller) {
+    handle = caller;
+    epoll_event ev {};
+    ev.events = events | EPOLLONESHOT;
+    ev.data.ptr = this;
+    // re-arm the oneshot registration of an earlier wait, register the fd on the first;
+    // a closed fd left epoll on its own
+    if (epoll_ctl (loop->epoll_, EPOLL_CTL_MOD, fd, &ev) == 0
+        || (errno == ENOENT && epoll_ctl (loop->epoll_, EPOLL_CTL_ADD, fd, &ev) == 0))
+      return true;
+    result = -errno;
+    return false;
+  }
+
+  EventLoop::SignalWait EventLoop::signal (const SignalSet& signals) {
+    return { { this, signals.fd (), EPOLLIN } };
+  }
+
+  int EventLoop::SignalWait::await_resume () const noexcept {
+    signalfd_siginfo info;
+    if (result < 0 || ::read (fd, &info, sizeof (info)) != sizeof (info))
+      return -1;
+    return static_cast<int> (info.ssi_signo);
+  }
+
+  EventLoop::ChildWait::ChildWait (EventLoop* loop, int pid)
+      : FdWait { loop, -1, EPOLLIN }, pid (pid) {
+  #if defined(SYS_pidfd_open)
+    fd = static_cast<int> (::syscall (SYS_pidfd_open, pid, 0));
+  #endif
+  }
+
+  EventLoop::ChildWait::~ChildWait () {
+    if (fd >= 0)
+      ::close (fd);
+  }
+
+  int EventLoop::ChildWait::await_resume () noexcept {
+    if (fd < 0 || result < 0)
+      return -1;
+    int status;
+    return ::waitpid (pid, &status, 0) == pid ? status : -1;
+  }
+
+  void EventLoop::armTimer () {
+    using namespace std::chrono;
+    const system_clock::time_point next
+        = timers_.empty () ? system_clock::time_point () : timers_.begin ()->first;
+    if (next == armedAt_)
+      return;
+    // a zero expiration disarms, so a cut short sleep does not wake the loop later
+    const auto ns = duration_cast<nanoseconds> (next.time_since_epoch ()).count ();
+    itimerspec spec {};
+    spec.it_value.tv_sec = static_cast<time_t> (ns / 1000000000);
+    spec.it_value.tv_nsec = static_cast<long> (ns % 1000000000);
+    if (ns > 0 && spec.it_value.tv_sec == 0 && spec.it_value.tv_nsec == 0)
+      spec.it_value.tv_nsec = 1;
+    if (timerfd_settime (timerFd_, TFD_TIMER_ABSTIME, &spec, nullptr) != 0)
+      LOG_W_STREAM << "timerfd_settime: " << std::strerror (errno) << std::endl;
+    armedAt_ = next;
+  }
+
+  void EventLoop::expireTimers () {
+    std::uint64_t expirations;
+    if (::read (timerFd_, &expirations, sizeof (expirations)) < 0 && errno != EAGAIN)
+      LOG_W_STREAM << "timerfd read: " << std::strerror (errno) << std::endl;
+    armedAt_ = std::chrono::system_clock::time_point ();
+    const auto now = std::chrono::system_clock::now ();
+    while (!timers_.empty () && timers_.begin ()->first <= now) {
+      SleepWait* sleep = timers_.begin ()->second;
+      cancel (*sleep);
+      sleep->result = 0;
+      post (sleep->handle);
+    }
+  }
+
+  int EventLoop::run () {
+    if (epoll_ < 0 || timerFd_ < 0) {
+      LOG_E_STREAM << "Event loop without epoll" << std::endl;
+      return -1;
+    }
+    stopped_ = false;
+    epoll_event events[kMaxEvents];
+    while (!stopped_ && !tasks_.empty ()) {
+      if (!ready_.empty ()) {
+        // resumes may post more, those run in the next round
+        resuming_.swap (ready_);
+        for (auto handle : resuming_) {
+          ++stats_.resumes;
+          handle.resume ();
+        }
+        resuming_.clear ();
+        continue;
+      }
+
+      armTimer ();
+      int n = epoll_wait (epoll_, events, kMaxEvents, -1);
+      if (n < 0) {
+        if (errno == EINTR)
+          continue;
+        LOG_E_STREAM << "epoll_wait: " << std::strerror (errno) << std::endl;
+        return -1;
+      }
+      ++stats_.wakeups;
+      stats_.events += static_cast<std::uint64_t> (n);
+      for (int i = 0; i < n; ++i) {
+        if (!events[i].data.ptr) {
+          expireTimers ();
+          continue;
+        }
+        auto* wait = static_cast<FdWait*> (events[i].data.ptr);
+        wait->result = static_cast<int> (events[i].events);
+        post (wait->handle);
+      }
+    }
+    return rc_;
+  }
+#else
+  SignalSet::SignalSet (std::initializer_list<int> signals) : signals_ (signals) {
+  }
+
+  SignalSet::~SignalSet () {
+  }
+
+  EventLoop::EventLoop () {
+  }
+
+  EventLoop::~EventLoop () {
+    for (auto handle : tasks_)
+      handle.destroy ();
+  }
+
+  EventLoop::FdWait EventLoop::wait (int fd, std::uint32_t events) {
+    return { this, fd, events };
+  }
+
+  bool EventLoop::FdWait::await_suspend (std::coroutine_handle<>) {
+    result = -1;
+    return false;
+  }
+
+  EventLoop::SignalWait EventLoop::signal (const SignalSet& signals) {
+    return { { this, signals.fd (), 1 } };
+  }
+
+  int EventLoop::SignalWait::await_resume () const noexcept {
+    return -1;
+  }
+
+  EventLoop::ChildWait::ChildWait (EventLoop* loop, int pid) : FdWait { loop, -1, 1 }, pid (pid) {
+  }
+
+  EventLoop::ChildWait::~ChildWait () {
+  }
+
+  int EventLoop::ChildWait::await_resume () noexcept {
+    return -1;
+  }
+
+  void EventLoop::armTimer () {
+  }
+
+  void EventLoop::expireTimers () {
+  }
+
+  int EventLoop::run () {
+    LOG_E_STREAM << "The event loop is only available on Linux" << std::endl;
+    return -1;
+  }
+#endif
+
+} // namespace dotname
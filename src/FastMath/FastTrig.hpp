@@ -0,0 +1,81 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __FASTTRIG_HPP
+#define __FASTTRIG_HPP
+
+// Approximate sind / cosd / atan2d / acosd / revolution for the FastMath engine, errors
+// measured in FastMathTester / FastMathBench
+
+#include <cmath>
+#include <cstdint>
+
+namespace dotname::fastmath {
+
+  constexpr double kPi = 3.14159265358979323846;
+  constexpr double kDegRad = kPi / 180.0;
+  constexpr double kRadDeg = 180.0 / kPi;
+
+  // floor () for |x| < 2^63, branchless
+  inline double floorFast (double x) {
+    double t = static_cast<double> (static_cast<std::int64_t> (x));
+    return t - static_cast<double> (t > x);
+  }
+
+  inline double revolution (double x) {
+    return x - 360.0 * floorFast (x * (1.0 / 360.0));
+  }
+
+  inline double rev180 (double x) {
+    return x - 360.0 * floorFast (x * (1.0 / 360.0) + 0.5);
+  }
+
+  inline void sinCosDeg (double x, double& s, double& c) {
+    double qf = floorFast (x * (1.0 / 90.0) + 0.5);
+    double r = (x - 90.0 * qf) * kDegRad; // |r| <= PI / 4
+    auto q = static_cast<std::int64_t> (qf);
+    double z = r * r;
+    double sr = r * (1.0 + z * (-1.0 / 6.0 + z * (1.0 / 120.0 + z * (-1.0 / 5040.0))));
+    double cr = 1.0 + z * (-0.5 + z * (1.0 / 24.0 + z * (-1.0 / 720.0 + z * (1.0 / 40320.0))));
+
+    // quadrant swap and signs without branches
+    double swap = static_cast<double> (q & 1);
+    double ss = sr + swap * (cr - sr);
+    double cc = cr + swap * (sr - cr);
+    s = ss * static_cast<double> (1 - (q & 2));
+    c = cc * static_cast<double> (1 - ((q + 1) & 2));
+  }
+
+  inline double sinDeg (double x) {
+    double s, c;
+    sinCosDeg (x, s, c);
+    return s;
+  }
+
+  inline double cosDeg (double x) {
+    double s, c;
+    sinCosDeg (x, s, c);
+    return c;
+  }
+
+  inline double atan2Deg (double y, double x) {
+    double ax = std::fabs (x), ay = std::fabs (y);
+    double mx = ax > ay ? ax : ay;
+    double mn = ax > ay ? ay : ax;
+    double t = mx > 0.0 ? mn / mx : 0.0;
+    double z = t * t;
+    double a = t
+               * (0.99997726 + z * (-0.33262347 + z * (0.19354346 + z * (-0.11643287
+                   + z * (0.05265332 + z * (-0.01172120))))));
+    a = ay > ax ? kPi / 2.0 - a : a;
+    a = x < 0.0 ? kPi - a : a;
+    return (y < 0.0 ? -a : a) * kRadDeg;
+  }
+
+  inline double acosDeg (double x) {
+    return atan2Deg (std::sqrt ((1.0 - x) * (1.0 + x)), x);
+  }
+
+} // namespace dotname::fastmath
+
+#endif // __FASTTRIG_HPP
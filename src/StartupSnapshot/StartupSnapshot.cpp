@@ -0,0 +1,181 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/StartupSnapshot.hpp>
+#include <Logger/Logger.hpp>
+#include <Trace/Trace.hpp>
+
+#include <cstring>
+
+#ifdef _WIN32
+  #include <fstream>
+#else
+  #include <fcntl.h>
+  #include <unistd.h>
+#endif
+
+namespace dotname {
+
+  namespace {
+
+    struct StartupSnapshotRecord {
+      char magic[8]; // "FSSNAP"
+      std::uint32_t version;
+      std::uint32_t size;
+      std::int64_t configMtime; // ticks of std::filesystem::file_time_type
+      std::uint64_t configSize;
+      std::int32_t year, month, day;
+      std::int32_t rc;
+      double rise, set, lightAt, darkAt;
+      double lat, lon;
+      std::int32_t utcOffsetMinutes, riseOffsetMinutes, setOffsetMinutes, themeTimeoutMs;
+      std::int32_t zoneDerived;
+      char themeBackends[128]; // names, each '\0' terminated, an empty name ends the list
+      char timeZone[64];       // '\0' terminated
+    };
+
+    // identity of config.json as the record saw it; false when it is missing
+    bool configKey (const std::filesystem::path& config, std::int64_t& mtime,
+                    std::uint64_t& size) {
+      std::error_code ec;
+      auto time = std::filesystem::last_write_time (config, ec);
+      if (ec)
+        return false;
+      auto bytes = std::filesystem::file_size (config, ec);
+      if (ec)
+        return false;
+      mtime = static_cast<std::int64_t> (time.time_since_epoch ().count ());
+      size = static_cast<std::uint64_t> (bytes);
+      return true;
+    }
+
+    bool readRecord (const std::filesystem::path& file, StartupSnapshotRecord& record) {
+#ifdef _WIN32
+      std::ifstream in (file, std::ios::binary);
+      return in.read (reinterpret_cast<char*> (&record), sizeof (record))
+             && in.gcount () == sizeof (record);
+#else
+      int fd = ::open (file.c_str (), O_RDONLY | O_CLOEXEC);
+      if (fd < 0)
+        return false;
+      ssize_t n = ::pread (fd, &record, sizeof (record), 0);
+      ::close (fd);
+      return n == static_cast<ssize_t> (sizeof (record));
+#endif
+    }
+
+  } // namespace
+
+  int loadStartupSnapshot (const std::filesystem::path& file,
+                           const std::filesystem::path& config, int year, int month, int day,
+                           StartupSnapshot& snapshot) {
+    TRACE_SPAN ("loadStartupSnapshot");
+    StartupSnapshotRecord record;
+    std::int64_t mtime;
+    std::uint64_t size;
+    if (!readRecord (file, record) || std::memcmp (record.magic, "FSSNAP", 7) != 0
+        || record.version != kStartupSnapshotVersion || record.size != sizeof (record)
+        || !configKey (config, mtime, size) || record.configMtime != mtime
+        || record.configSize != size || record.year != year || record.month != month
+        || record.day != day)
+      return -1;
+
+    snapshot.lat = record.lat;
+    snapshot.lon = record.lon;
+    snapshot.utcOffsetMinutes = record.utcOffsetMinutes;
+    record.timeZone[sizeof (record.timeZone) - 1] = '\0';
+    snapshot.timeZone = record.timeZone;
+    snapshot.zoneDerived = record.zoneDerived != 0;
+    snapshot.riseOffsetMinutes = record.riseOffsetMinutes;
+    snapshot.setOffsetMinutes = record.setOffsetMinutes;
+    snapshot.themeTimeoutMs = record.themeTimeoutMs;
+    snapshot.themeBackends.clear ();
+    record.themeBackends[sizeof (record.themeBackends) - 1] = '\0';
+    for (const char* name = record.themeBackends; *name; name += std::strlen (name) + 1)
+      snapshot.themeBackends.emplace_back (name);
+    snapshot.year = record.year;
+    snapshot.month = record.month;
+    snapshot.day = record.day;
+    snapshot.state.rc = record.rc;
+    snapshot.state.rise = record.rise;
+    snapshot.state.set = record.set;
+    snapshot.state.lightAt = record.lightAt;
+    snapshot.state.darkAt = record.darkAt;
+    return 0;
+  }
+
+  int saveStartupSnapshot (const std::filesystem::path& file,
+                           const std::filesystem::path& config, const StartupSnapshot& snapshot) {
+    TRACE_SPAN ("saveStartupSnapshot");
+    StartupSnapshotRecord record;
+    std::memset (&record, 0, sizeof (record));
+    std::memcpy (record.magic, "FSSNAP", 7);
+    record.version = kStartupSnapshotVersion;
+    record.size = sizeof (record);
+    if (!configKey (config, record.configMtime, record.configSize)) {
+      LOG_D_STREAM << "No startup snapshot without " << config << std::endl;
+      return -1;
+    }
+    record.year = snapshot.year;
+    record.month = snapshot.month;
+    record.day = snapshot.day;
+    record.rc = snapshot.state.rc;
+    record.rise = snapshot.state.rise;
+    record.set = snapshot.state.set;
+    record.lightAt = snapshot.state.lightAt;
+    record.darkAt = snapshot.state.darkAt;
+    record.lat = snapshot.lat;
+    record.lon = snapshot.lon;
+    record.utcOffsetMinutes = snapshot.utcOffsetMinutes;
+    if (snapshot.timeZone.size () >= sizeof (record.timeZone)) {
+      LOG_D_STREAM << "Time zone name does not fit a startup snapshot" << std::endl;
+      return -1;
+    }
+    std::memcpy (record.timeZone, snapshot.timeZone.data (), snapshot.timeZone.size ());
+    record.zoneDerived = snapshot.zoneDerived;
+    record.riseOffsetMinutes = snapshot.riseOffsetMinutes;
+    record.setOffsetMinutes = snapshot.setOffsetMinutes;
+    record.themeTimeoutMs = snapshot.themeTimeoutMs;
+    std::size_t at = 0;
+    for (const auto& name : snapshot.themeBackends) {
+      // room for this name, its '\0' and the terminating empty name
+      if (name.empty () || at + name.size () + 2 > sizeof (record.themeBackends)) {
+        LOG_D_STREAM << "Theme backends do not fit a startup snapshot" << std::endl;
+        return -1;
+      }
+      std::memcpy (record.themeBackends + at, name.data (), name.size ());
+      at += name.size () + 1;
+    }
+
+    // a cache, no fsync; the rename only keeps a concurrent start from reading half of it
+    std::filesystem::path temp = file;
+    temp += ".tmp";
+#ifdef _WIN32
+    {
+      std::ofstream out (temp, std::ios::binary | std::ios::trunc);
+      if (!out.write (reinterpret_cast<const char*> (&record), sizeof (record))) {
+        LOG_W_STREAM << "Failed to write " << temp << std::endl;
+        return -1;
+      }
+    }
+#else
+    int fd = ::open (temp.c_str (), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    ssize_t n = fd < 0 ? -1 : ::write (fd, &record, sizeof (record));
+    if (fd >= 0)
+      ::close (fd);
+    if (n != static_cast<ssize_t> (sizeof (record))) {
+      LOG_W_STREAM << "Failed to write " << temp << std::endl;
+      ::unlink (temp.c_str ());
+      return -1;
+    }
+#endif
+    std::error_code ec;
+    std::filesystem::rename (temp, file, ec);
+    if (ec) {
+      LOG_W_STREAM << "Failed to write " << file << ": " << ec.message () << std::endl;
+      return -1;
+    }
+    return 0;
+  }
+
+} // namespace dotname
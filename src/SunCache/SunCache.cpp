@@ -0,0 +1,179 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/SunCache.hpp>
+#include <Utils/Utils.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+extern "C" {
+#include "SunrisetC/sunriset.h"
+}
+
+namespace dotname {
+
+  namespace {
+
+    struct Key {
+      std::int32_t lat; // quantum cells
+      std::int32_t lon;
+      std::int32_t day; // days since 2000 Jan 0
+      float altit;
+      std::int32_t upperLimb;
+
+      bool operator== (const Key& o) const {
+        return lat == o.lat && lon == o.lon && day == o.day && altit == o.altit
+               && upperLimb == o.upperLimb;
+      }
+    };
+
+    struct KeyHash {
+      std::size_t operator() (const Key& k) const {
+        std::uint32_t altBits;
+        std::memcpy (&altBits, &k.altit, sizeof (altBits));
+        std::uint64_t h = (static_cast<std::uint64_t> (static_cast<std::uint32_t> (k.lat)) << 32)
+                          ^ static_cast<std::uint32_t> (k.lon);
+        h ^= (static_cast<std::uint64_t> (static_cast<std::uint32_t> (k.day)) << 21)
+             ^ (static_cast<std::uint64_t> (altBits) << 7)
+             ^ static_cast<std::uint64_t> (k.upperLimb);
+        // splitmix64 finalizer
+        h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+        return static_cast<std::size_t> (h ^ (h >> 31));
+      }
+    };
+
+  } // namespace
+
+  struct SunCache::Shard {
+    struct Slot {
+      Key key;
+      SunCacheValue value;
+      bool referenced;
+    };
+
+    std::mutex m;
+    std::unordered_map<Key, std::size_t, KeyHash> index;
+    std::vector<Slot> slots;
+    std::size_t capacity = 0;
+    std::size_t hand = 0;
+    std::uint64_t hits = 0, misses = 0, evictions = 0;
+
+    bool find (const Key& key, SunCacheValue& out) {
+      auto it = index.find (key);
+      if (it == index.end ()) {
+        ++misses;
+        return false;
+      }
+      ++hits;
+      Slot& s = slots[it->second];
+      s.referenced = true;
+      out = s.value;
+      return true;
+    }
+
+    void insert (const Key& key, const SunCacheValue& value) {
+      if (capacity == 0 || index.count (key))
+        return; // another thread filled it meanwhile
+      if (slots.size () < capacity) {
+        index.emplace (key, slots.size ());
+        slots.push_back ({ key, value, false });
+        return;
+      }
+      // CLOCK: clear reference bits until an unreferenced slot comes round
+      while (slots[hand].referenced) {
+        slots[hand].referenced = false;
+        hand = (hand + 1) % slots.size ();
+      }
+      Slot& victim = slots[hand];
+      index.erase (victim.key);
+      ++evictions;
+      victim = { key, value, false };
+      index.emplace (key, hand);
+      hand = (hand + 1) % slots.size ();
+    }
+  };
+
+  std::size_t SunCache::entryBytes () {
+    // slot + hash node (key, index, next pointer, cached hash) + bucket pointer
+    return sizeof (Shard::Slot) + sizeof (Key) + 3 * sizeof (std::size_t) + sizeof (void*);
+  }
+
+  SunCache::SunCache (std::size_t memoryCapBytes, std::size_t shards, double quantumDegrees)
+      : shards_ (std::make_unique<Shard[]> (shards ? shards : 1)),
+        shardCount_ (shards ? shards : 1),
+        quantum_ (quantumDegrees > 0.0 ? quantumDegrees : 0.01) {
+    std::size_t perShard = memoryCapBytes / entryBytes () / shardCount_;
+    for (std::size_t i = 0; i < shardCount_; ++i) {
+      shards_[i].capacity = perShard;
+      shards_[i].slots.reserve (perShard);
+      shards_[i].index.reserve (perShard);
+    }
+  }
+
+  SunCache::SunCache (SunCache&&) noexcept = default;
+  SunCache& SunCache::operator= (SunCache&&) noexcept = default;
+  SunCache::~SunCache () = default;
+
+  SunCacheValue SunCache::get (double lat, double lon, int year, int month, int day,
+                               SunAltitude altitude) {
+    Key key{ static_cast<std::int32_t> (std::floor (lat / quantum_)),
+             static_cast<std::int32_t> (std::floor (lon / quantum_)),
+             static_cast<std::int32_t> (days_since_2000_Jan_0 (year, month, day)),
+             static_cast<float> (altitude.altit), altitude.upperLimb };
+    Shard& shard = shards_[KeyHash{}(key) % shardCount_];
+
+    SunCacheValue value;
+    {
+      std::lock_guard<std::mutex> lock (shard.m);
+      if (shard.find (key, value))
+        return value;
+    }
+
+    // compute outside the lock, at the centre of the quantum cell; of its part within
+    // -90 .. 90, so the cells at the poles do not step over them into the other season
+    double cellLat = (std::max (key.lat * quantum_, -90.0)
+                      + std::min ((key.lat + 1.0) * quantum_, 90.0)) / 2.0;
+    double cellLon = (key.lon + 0.5) * quantum_;
+    value.rc = __sunriset__ (year, month, day, cellLon, cellLat, altitude.altit,
+                             altitude.upperLimb, &value.rise, &value.set);
+    value.riseTimeUT = DotNameUtils::TimeUtils::to24Time (value.rise);
+    value.setTimeUT = DotNameUtils::TimeUtils::to24Time (value.set);
+
+    std::lock_guard<std::mutex> lock (shard.m);
+    shard.insert (key, value);
+    return value;
+  }
+
+  SunCacheStats SunCache::stats () const {
+    SunCacheStats s;
+    for (std::size_t i = 0; i < shardCount_; ++i) {
+      Shard& shard = shards_[i];
+      std::lock_guard<std::mutex> lock (shard.m);
+      s.hits += shard.hits;
+      s.misses += shard.misses;
+      s.evictions += shard.evictions;
+      s.entries += shard.slots.size ();
+      s.capacity += shard.capacity;
+    }
+    s.memoryBytes = s.entries * entryBytes ();
+    return s;
+  }
+
+  void SunCache::clear () {
+    for (std::size_t i = 0; i < shardCount_; ++i) {
+      Shard& shard = shards_[i];
+      std::lock_guard<std::mutex> lock (shard.m);
+      shard.index.clear ();
+      shard.slots.clear ();
+      shard.hand = 0;
+      shard.hits = shard.misses = shard.evictions = 0;
+    }
+  }
+
+} // namespace dotname
@@ -0,0 +1,96 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include "EphemerisStepper.hpp"
+
+#include <cmath>
+
+extern "C" {
+#include "SunrisetC/sunriset.h"
+}
+
+namespace dotname::ephemeris {
+
+  namespace {
+
+    // daily rates from sunpos () and sun_RA_dec ()
+    constexpr double kRateM = 0.9856002585;
+    constexpr double kRateW = 4.70935E-5;
+    constexpr double kRateObl = -3.563E-7;
+    constexpr double kRateEcc = -1.151E-9;
+
+    struct Rotation {
+      double s, c;
+    };
+
+    const Rotation kRotM{ sind (kRateM), cosd (kRateM) };
+    const Rotation kRotW{ sind (kRateW), cosd (kRateW) };
+    const Rotation kRotObl{ sind (kRateObl), cosd (kRateObl) };
+
+    inline void rotate (double& s, double& c, const Rotation& r) {
+      double ns = s * r.c + c * r.s;
+      c = c * r.c - s * r.s;
+      s = ns;
+    }
+
+  } // namespace
+
+  void EphemerisStepper::anchor (double d) {
+    d_ = d;
+    double M = revolution (356.0470 + kRateM * d);
+    double w = 282.9404 + kRateW * d;
+    double obl = 23.4393 + kRateObl * d;
+    e_ecc_ = 0.016709 + kRateEcc * d;
+    sinM_ = sind (M);
+    cosM_ = cosd (M);
+    sinW_ = sind (w);
+    cosW_ = cosd (w);
+    sinObl_ = sind (obl);
+    cosObl_ = cosd (obl);
+    update ();
+  }
+
+  void EphemerisStepper::step () {
+    d_ += 1.0;
+    e_ecc_ += kRateEcc;
+    rotate (sinM_, cosM_, kRotM);
+    rotate (sinW_, cosW_, kRotW);
+    rotate (sinObl_, cosObl_, kRotObl);
+    update ();
+  }
+
+  void EphemerisStepper::update () {
+    const double e = e_ecc_;
+
+    /* E = M + e * RADEG * sind (M) * (1.0 + e * cosd (M)), rotate by E - M */
+    double delta = e * sinM_ * (1.0 + e * cosM_); // radians, |delta| < 0.035
+    double d2 = delta * delta;
+    double sinD = delta * (1.0 - d2 / 6.0 * (1.0 - d2 / 20.0 * (1.0 - d2 / 42.0)));
+    double cosD = 1.0 - d2 / 2.0 * (1.0 - d2 / 12.0 * (1.0 - d2 / 30.0));
+    double sinE = sinM_ * cosD + cosM_ * sinD;
+    double cosE = cosM_ * cosD - sinM_ * sinD;
+
+    /* true anomaly v and radius vector */
+    double x = cosE - e;
+    double y = std::sqrt (1.0 - e * e) * sinE;
+    double r = std::sqrt (x * x + y * y);
+
+    /* true solar longitude = v + w */
+    double sinV = y / r, cosV = x / r;
+    double sinLon = sinV * cosW_ + cosV * sinW_;
+    double cosLon = cosV * cosW_ - sinV * sinW_;
+
+    /* ecliptic -> equatorial */
+    double xe = r * cosLon;
+    double ys = r * sinLon;
+    double ye = ys * cosObl_;
+    double ze = ys * sinObl_;
+
+    e_.sRA = atan2d (ye, xe);
+    e_.sinDec = ze / r;
+    e_.cosDec = std::sqrt (xe * xe + ye * ye) / r;
+    e_.sr = r;
+    e_.gmst0 = GMST0 (d_);
+  }
+
+} // namespace dotname::ephemeris
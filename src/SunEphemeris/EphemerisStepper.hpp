@@ -0,0 +1,46 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __EPHEMERISSTEPPER_HPP
+#define __EPHEMERISSTEPPER_HPP
+
+#include "SunEphemeris.hpp"
+
+namespace dotname::ephemeris {
+
+  // Steps the orbital elements of sunpos () / sun_RA_dec () one day at a time.
+  //
+  // Mean anomaly, longitude of perihelion and obliquity advance linearly with d, so their
+  // sine/cosine pairs are rotated by a constant angle instead of recomputed. Eccentric
+  // anomaly differs from the mean anomaly by less than 2 degrees and is rotated with a
+  // short Taylor series. What remains per day is one atan2 (RA) and a few sqrt.
+  // anchor () recomputes everything with real trig and bounds the drift.
+  class EphemerisStepper {
+  public:
+    void anchor (double d);
+    void step ();
+
+    double day () const {
+      return d_;
+    }
+    const SunEphemeris& current () const {
+      return e_;
+    }
+
+  private:
+    void update ();
+
+    double d_ = 0.0;
+    double e_ecc_ = 0.0;  // eccentricity
+    double sinM_ = 0.0;   // mean anomaly
+    double cosM_ = 1.0;
+    double sinW_ = 0.0;   // longitude of perihelion
+    double cosW_ = 1.0;
+    double sinObl_ = 0.0; // obliquity of ecliptic
+    double cosObl_ = 1.0;
+    SunEphemeris e_{};
+  };
+
+} // namespace dotname::ephemeris
+
+#endif // __EPHEMERISSTEPPER_HPP
@@ -0,0 +1,79 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include "SunEphemeris.hpp"
+
+#include <cmath>
+#include <vector>
+
+extern "C" {
+#include "SunrisetC/sunriset.h"
+}
+
+namespace dotname::ephemeris {
+
+  namespace {
+
+    // One node per integer d. d = day + 0.5 - lon / 360 lies in [day, day + 1] and the
+    // cubic needs one more node on each side of that.
+    const long kFirstDay = days_since_2000_Jan_0 (1801, 1, 1) - 1;
+    const long kLastDay = days_since_2000_Jan_0 (2099, 12, 31) + 2;
+
+    struct Table {
+      std::vector<SunEphemeris> nodes;
+
+      Table () {
+        nodes.reserve (static_cast<std::size_t> (kLastDay - kFirstDay + 1));
+        for (long day = kFirstDay; day <= kLastDay; ++day)
+          nodes.push_back (compute (static_cast<double> (day)));
+      }
+    };
+
+    const Table& table () {
+      static const Table t;
+      return t;
+    }
+
+  } // namespace
+
+  bool tableCovers (double d) {
+    return d >= kFirstDay + 1 && d < kLastDay - 1;
+  }
+
+  SunEphemeris lookup (double d) {
+    if (!tableCovers (d))
+      return compute (d);
+
+    const auto& nodes = table ().nodes;
+    double fl = std::floor (d);
+    double f = d - fl;
+    std::size_t i = static_cast<std::size_t> (static_cast<long> (fl) - kFirstDay);
+    const SunEphemeris& p0 = nodes[i - 1];
+    const SunEphemeris& p1 = nodes[i];
+    const SunEphemeris& p2 = nodes[i + 1];
+    const SunEphemeris& p3 = nodes[i + 2];
+
+    // 4 point Lagrange weights on nodes -1, 0, 1, 2; linear interpolation is off by
+    // almost a second at mid latitudes, the cubic stays in milliseconds
+    double w0 = -f * (f - 1.0) * (f - 2.0) / 6.0;
+    double w1 = (f + 1.0) * (f - 1.0) * (f - 2.0) / 2.0;
+    double w2 = -(f + 1.0) * f * (f - 2.0) / 2.0;
+    double w3 = (f + 1.0) * f * (f - 1.0) / 6.0;
+    auto cubic = [&] (double a, double b, double c, double e) {
+      return w0 * a + w1 * b + w2 * c + w3 * e;
+    };
+    // RA and GMST0 wrap at 360, interpolate the offsets from node 0
+    auto wrapped = [&] (double a, double b, double c, double e) {
+      return revolution (b + cubic (rev180 (a - b), 0.0, rev180 (c - b), rev180 (e - b)));
+    };
+
+    SunEphemeris e;
+    e.sRA = wrapped (p0.sRA, p1.sRA, p2.sRA, p3.sRA);
+    e.gmst0 = wrapped (p0.gmst0, p1.gmst0, p2.gmst0, p3.gmst0);
+    e.sinDec = cubic (p0.sinDec, p1.sinDec, p2.sinDec, p3.sinDec);
+    e.cosDec = cubic (p0.cosDec, p1.cosDec, p2.cosDec, p3.cosDec);
+    e.sr = cubic (p0.sr, p1.sr, p2.sr, p3.sr);
+    return e;
+  }
+
+} // namespace dotname::ephemeris
@@ -0,0 +1,87 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include "SunEphemeris.hpp"
+#include "FastMath/FastTrig.hpp"
+
+#include <cmath>
+
+namespace dotname::ephemeris {
+
+  namespace fm = fastmath;
+
+  SunEphemeris computeFast (double d) {
+    /* sunpos () */
+    double M = fm::revolution (356.0470 + 0.9856002585 * d);
+    double w = 282.9404 + 4.70935E-5 * d;
+    double ecc = 0.016709 - 1.151E-9 * d;
+
+    double sM, cM;
+    fm::sinCosDeg (M, sM, cM);
+    double E = M + ecc * fm::kRadDeg * sM * (1.0 + ecc * cM);
+    double sE, cE;
+    fm::sinCosDeg (E, sE, cE);
+    double x = cE - ecc;
+    double y = std::sqrt (1.0 - ecc * ecc) * sE;
+    double r = std::sqrt (x * x + y * y);
+    double lon = fm::atan2Deg (y, x) + w;
+
+    /* sun_RA_dec () */
+    double sLon, cLon;
+    fm::sinCosDeg (lon, sLon, cLon);
+    double sObl, cObl;
+    fm::sinCosDeg (23.4393 - 3.563E-7 * d, sObl, cObl);
+    double xe = r * cLon;
+    double ye = r * sLon * cObl;
+    double ze = r * sLon * sObl;
+
+    // sin/cos of the declination straight from the rectangular coordinates, skips the
+    // atan2d + sind + cosd round trip of compute ()
+    SunEphemeris e;
+    double rxy = std::sqrt (xe * xe + ye * ye);
+    e.sRA = fm::atan2Deg (ye, xe);
+    e.sinDec = ze / r;
+    e.cosDec = rxy / r;
+    e.sr = r;
+    e.gmst0 = fm::revolution ((180.0 + 356.0470 + 282.9404) + (0.9856002585 + 4.70935E-5) * d);
+    return e;
+  }
+
+  int riseSetFast (const SunEphemeris& e, double lon, double sinLat, double cosLat,
+                   double altit, int upperLimb, double* rise, double* set) {
+    int rc = 0;
+    double t;
+
+    double sidtime = fm::revolution (e.gmst0 + 180.0 + lon);
+    double tsouth = 12.0 - fm::rev180 (sidtime - e.sRA) / 15.0;
+
+    if (upperLimb)
+      altit -= 0.2666 / e.sr;
+
+    double cost = (fm::sinDeg (altit) - sinLat * e.sinDec) / (cosLat * e.cosDec);
+    if (cost >= 1.0)
+      rc = -1, t = 0.0; /* Sun always below altit */
+    else if (cost <= -1.0)
+      rc = +1, t = 12.0; /* Sun always above altit */
+    else
+      t = fm::acosDeg (cost) / 15.0; /* The diurnal arc, hours */
+
+    *rise = tsouth - t;
+    *set = tsouth + t;
+    return rc;
+  }
+
+  double dayLengthFast (const SunEphemeris& e, double sinLat, double cosLat, double altit,
+                        int upperLimb) {
+    if (upperLimb)
+      altit -= 0.2666 / e.sr;
+
+    double cost = (fm::sinDeg (altit) - sinLat * e.sinDec) / (cosLat * e.cosDec);
+    if (cost >= 1.0)
+      return 0.0; /* Sun always below altit */
+    if (cost <= -1.0)
+      return 24.0; /* Sun always above altit */
+    return (2.0 / 15.0) * fm::acosDeg (cost);
+  }
+
+} // namespace dotname::ephemeris
@@ -0,0 +1,45 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/SunAltitudes.hpp>
+#include "SunEphemeris.hpp"
+
+#include <cmath>
+
+extern "C" {
+#include "SunrisetC/sunriset.h"
+}
+
+namespace dotname {
+
+  void sunCrossings (int year, int month, int day, double lon, double lat,
+                     const SunAltitude* altitudes, std::size_t count, SunCrossing* out,
+                     SunEngine engine) {
+    double d = ephemeris::localNoonDay (days_since_2000_Jan_0 (year, month, day), lon);
+    bool fast = engine == SunEngine::FastMath;
+    ephemeris::SunEphemeris e = engine == SunEngine::EphemerisTable ? ephemeris::lookup (d)
+                                : fast                              ? ephemeris::computeFast (d)
+                                                                    : ephemeris::compute (d);
+    double sinLat = sind (lat);
+    double cosLat = cosd (lat);
+    auto riseSet = fast ? ephemeris::riseSetFast : ephemeris::riseSet;
+
+    for (std::size_t i = 0; i < count; ++i) {
+      SunCrossing& c = out[i];
+      c.rc = riseSet (e, lon, sinLat, cosLat, altitudes[i].altit, altitudes[i].upperLimb,
+                      &c.rise, &c.set);
+      // diurnal arc is symmetric around the transit, rc keeps the polar cases apart
+      c.dayLength = c.rc == 0 ? c.set - c.rise : (c.rc > 0 ? 24.0 : 0.0);
+    }
+  }
+
+  std::vector<SunCrossing> sunCrossings (int year, int month, int day, double lon, double lat,
+                                         const std::vector<SunAltitude>& altitudes,
+                                         SunEngine engine) {
+    std::vector<SunCrossing> out (altitudes.size ());
+    sunCrossings (year, month, day, lon, lat, altitudes.data (), altitudes.size (), out.data (),
+                  engine);
+    return out;
+  }
+
+} // namespace dotname
@@ -0,0 +1,63 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/SunEngine.hpp>
+#include "FastMath/FastTrig.hpp"
+#include "SunEphemeris.hpp"
+
+#include <cmath>
+
+extern "C" {
+#include "SunrisetC/sunriset.h"
+}
+
+namespace dotname {
+
+  const char* sunEngineName (SunEngine engine) {
+    switch (engine) {
+    case SunEngine::EphemerisTable:
+      return "EphemerisTable";
+    case SunEngine::FastMath:
+      return "FastMath";
+    default:
+      return "Reference";
+    }
+  }
+
+  int sunriset (SunEngine engine, int year, int month, int day, double lon, double lat,
+                double altit, int upperLimb, double* rise, double* set) {
+    switch (engine) {
+    case SunEngine::EphemerisTable: {
+      double d = ephemeris::localNoonDay (days_since_2000_Jan_0 (year, month, day), lon);
+      return ephemeris::riseSet (ephemeris::lookup (d), lon, sind (lat), cosd (lat), altit,
+                                 upperLimb, rise, set);
+    }
+    case SunEngine::FastMath: {
+      double d = ephemeris::localNoonDay (days_since_2000_Jan_0 (year, month, day), lon);
+      return ephemeris::riseSetFast (ephemeris::computeFast (d), lon, fastmath::sinDeg (lat),
+                                     fastmath::cosDeg (lat), altit, upperLimb, rise, set);
+    }
+    default:
+      return __sunriset__ (year, month, day, lon, lat, altit, upperLimb, rise, set);
+    }
+  }
+
+  double daylen (SunEngine engine, int year, int month, int day, double lon, double lat,
+                 double altit, int upperLimb) {
+    switch (engine) {
+    case SunEngine::EphemerisTable: {
+      double d = ephemeris::localNoonDay (days_since_2000_Jan_0 (year, month, day), lon);
+      return ephemeris::dayLength (ephemeris::lookup (d), sind (lat), cosd (lat), altit,
+                                   upperLimb);
+    }
+    case SunEngine::FastMath: {
+      double d = ephemeris::localNoonDay (days_since_2000_Jan_0 (year, month, day), lon);
+      return ephemeris::dayLengthFast (ephemeris::computeFast (d), fastmath::sinDeg (lat),
+                                       fastmath::cosDeg (lat), altit, upperLimb);
+    }
+    default:
+      return __daylen__ (year, month, day, lon, lat, altit, upperLimb);
+    }
+  }
+
+} // namespace dotname
@@ -0,0 +1,67 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include "SunEphemeris.hpp"
+
+#include <cmath>
+
+extern "C" {
+#include "SunrisetC/sunriset.h"
+}
+
+namespace dotname::ephemeris {
+
+  double localNoonDay (int dayNumber, double lon) {
+    return dayNumber + 0.5 - lon / 360.0;
+  }
+
+  SunEphemeris compute (double d) {
+    SunEphemeris e;
+    double sdec;
+    sun_RA_dec (d, &e.sRA, &sdec, &e.sr);
+    e.sinDec = sind (sdec);
+    e.cosDec = cosd (sdec);
+    e.gmst0 = GMST0 (d);
+    return e;
+  }
+
+  int riseSet (const SunEphemeris& e, double lon, double sinLat, double cosLat, double altit,
+               int upperLimb, double* rise, double* set) {
+    int rc = 0;
+    double t;
+
+    /* Compute local sideral time and time when Sun is at south - in hours UT */
+    double sidtime = revolution (e.gmst0 + 180.0 + lon);
+    double tsouth = 12.0 - rev180 (sidtime - e.sRA) / 15.0;
+
+    /* Do correction to upper limb, if necessary */
+    if (upperLimb)
+      altit -= 0.2666 / e.sr;
+
+    double cost = (sind (altit) - sinLat * e.sinDec) / (cosLat * e.cosDec);
+    if (cost >= 1.0)
+      rc = -1, t = 0.0; /* Sun always below altit */
+    else if (cost <= -1.0)
+      rc = +1, t = 12.0; /* Sun always above altit */
+    else
+      t = acosd (cost) / 15.0; /* The diurnal arc, hours */
+
+    *rise = tsouth - t;
+    *set = tsouth + t;
+    return rc;
+  }
+
+  double dayLength (const SunEphemeris& e, double sinLat, double cosLat, double altit,
+                    int upperLimb) {
+    if (upperLimb)
+      altit -= 0.2666 / e.sr;
+
+    double cost = (sind (altit) - sinLat * e.sinDec) / (cosLat * e.cosDec);
+    if (cost >= 1.0)
+      return 0.0; /* Sun always below altit */
+    if (cost <= -1.0)
+      return 24.0; /* Sun always above altit */
+    return (2.0 / 15.0) * acosd (cost);
+  }
+
+} // namespace dotname::ephemeris
@@ -0,0 +1,47 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __SUNEPHEMERIS_HPP
+#define __SUNEPHEMERIS_HPP
+
+// The part of __sunriset__ / __daylen__ that depends on d (days since 2000 Jan 0.0) only
+
+namespace dotname::ephemeris {
+
+  struct SunEphemeris {
+    double sRA;    // Sun's Right Ascension, degrees
+    double sinDec; // sine of Sun's declination
+    double cosDec; // cosine of Sun's declination
+    double sr;     // Solar distance, astronomical units
+    double gmst0;  // GMST0, degrees
+  };
+
+  // d of 12h local mean solar time, as __sunriset__ computes it
+  double localNoonDay (int dayNumber, double lon);
+
+  // Same trig path as __sunriset__ (sun_RA_dec + GMST0)
+  SunEphemeris compute (double d);
+
+  // compute (), riseSet () and dayLength () on the fastmath kernels (FastMath/FastTrig.hpp)
+  SunEphemeris computeFast (double d);
+  int riseSetFast (const SunEphemeris& e, double lon, double sinLat, double cosLat,
+                   double altit, int upperLimb, double* rise, double* set);
+  double dayLengthFast (const SunEphemeris& e, double sinLat, double cosLat, double altit,
+                        int upperLimb);
+
+  // Interpolated from the precomputed per-day table, falls back to compute () outside
+  // 1801-2099. The table is built on first use.
+  SunEphemeris lookup (double d);
+  bool tableCovers (double d);
+
+  // Rise/set for a given ephemeris, return code as __sunriset__
+  int riseSet (const SunEphemeris& e, double lon, double sinLat, double cosLat, double altit,
+               int upperLimb, double* rise, double* set);
+
+  // Day length for a given ephemeris, same result as __daylen__
+  double dayLength (const SunEphemeris& e, double sinLat, double cosLat, double altit,
+                    int upperLimb);
+
+} // namespace dotname::ephemeris
+
+#endif // __SUNEPHEMERIS_HPP
@@ -0,0 +1,132 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/SunEventRange.hpp>
+#include "EphemerisStepper.hpp"
+
+#include <cmath>
+
+extern "C" {
+#include "SunrisetC/sunriset.h"
+}
+
+namespace dotname {
+
+  struct SunEventRange::Impl {
+    double lon;
+    double sinLat, cosLat;
+    double sinAlt, cosAlt; // altitude without the upper limb correction
+    int upperLimb;
+    int fromDay, toDay;
+    int anchorInterval;
+
+    int sinceAnchor = 0;
+    bool done = true;
+    SunEvent event{};
+    ephemeris::EphemerisStepper stepper;
+
+    void start () {
+      done = fromDay > toDay;
+      if (!done) {
+        stepper.anchor (ephemeris::localNoonDay (fromDay, lon));
+        sinceAnchor = 0;
+        event.dayNumber = fromDay;
+        evaluate ();
+      }
+    }
+
+    void advance () {
+      if (done)
+        return;
+      if (event.dayNumber >= toDay) {
+        done = true;
+        return;
+      }
+      ++event.dayNumber;
+      if (++sinceAnchor >= anchorInterval) {
+        stepper.anchor (ephemeris::localNoonDay (event.dayNumber, lon));
+        sinceAnchor = 0;
+      } else {
+        stepper.step ();
+      }
+      evaluate ();
+    }
+
+    // ephemeris::riseSet () with sind (altit) replaced by a rotation, the upper limb
+    // correction is a few arc minutes
+    void evaluate () {
+      const auto& e = stepper.current ();
+      double sidtime = revolution (e.gmst0 + 180.0 + lon);
+      double tsouth = 12.0 - rev180 (sidtime - e.sRA) / 15.0;
+
+      double sinA = sinAlt;
+      if (upperLimb) {
+        double r = 0.2666 / e.sr * DEGRAD;
+        double r2 = r * r;
+        sinA = sinAlt * (1.0 - r2 / 2.0) - cosAlt * r * (1.0 - r2 / 6.0);
+      }
+
+      double t;
+      double cost = (sinA - sinLat * e.sinDec) / (cosLat * e.cosDec);
+      if (cost >= 1.0)
+        event.rc = -1, t = 0.0;
+      else if (cost <= -1.0)
+        event.rc = +1, t = 12.0;
+      else
+        event.rc = 0, t = acosd (cost) / 15.0;
+
+      event.rise = tsouth - t;
+      event.set = tsouth + t;
+    }
+  };
+
+  SunEventRange::SunEventRange (double lat, double lon, int fromDay, int toDay,
+                                SunAltitude altitude, int anchorInterval)
+      : impl_ (std::make_unique<Impl> ()) {
+    impl_->lon = lon;
+    impl_->sinLat = sind (lat);
+    impl_->cosLat = cosd (lat);
+    impl_->sinAlt = sind (altitude.altit);
+    impl_->cosAlt = cosd (altitude.altit);
+    impl_->upperLimb = altitude.upperLimb;
+    impl_->fromDay = fromDay;
+    impl_->toDay = toDay;
+    impl_->anchorInterval = anchorInterval > 0 ? anchorInterval : 1;
+  }
+
+  SunEventRange::SunEventRange (SunEventRange&&) noexcept = default;
+  SunEventRange& SunEventRange::operator= (SunEventRange&&) noexcept = default;
+  SunEventRange::~SunEventRange () = default;
+
+  SunEventRange::iterator SunEventRange::begin () {
+    impl_->start ();
+    return iterator (this);
+  }
+
+  SunEventRange::iterator SunEventRange::end () {
+    return iterator (nullptr);
+  }
+
+  std::size_t SunEventRange::size () const {
+    return impl_->fromDay > impl_->toDay
+               ? 0
+               : static_cast<std::size_t> (impl_->toDay - impl_->fromDay) + 1;
+  }
+
+  SunEventRange::iterator::reference SunEventRange::iterator::operator* () const {
+    return range_->impl_->event;
+  }
+
+  SunEventRange::iterator& SunEventRange::iterator::operator++ () {
+    range_->impl_->advance ();
+    return *this;
+  }
+
+  // every iterator of a live range shares its cursor, only "at end" tells them apart
+  bool SunEventRange::iterator::operator== (const iterator& other) const {
+    bool atEnd = !range_ || range_->impl_->done;
+    bool otherAtEnd = !other.range_ || other.range_->impl_->done;
+    return atEnd == otherAtEnd;
+  }
+
+} // namespace dotname
@@ -0,0 +1,144 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/SunGrid.hpp>
+#include "SunEphemeris/SunEphemeris.hpp"
+#include "ThreadPool/WorkStealingPool.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+extern "C" {
+#include "SunrisetC/sunriset.h"
+}
+
+namespace dotname {
+
+  namespace {
+
+    // columns per tile, rows follow from the output budget below
+    constexpr std::size_t kTileColumns = 64;
+    // SunCrossing per tile, 4096 x 32 bytes = 128 KiB of output, well within L2
+    constexpr std::size_t kTileCrossings = 4096;
+
+    std::size_t steps (double from, double to, double resolution) {
+      if (!(resolution > 0.0) || to < from)
+        return 0;
+      return static_cast<std::size_t> (std::floor ((to - from) / resolution + 1e-9)) + 1;
+    }
+
+  } // namespace
+
+  std::size_t SunGridSpec::rows () const {
+    return steps (latMin, latMax, resolution);
+  }
+
+  std::size_t SunGridSpec::columns () const {
+    return steps (lonMin, lonMax, resolution);
+  }
+
+  std::size_t SunGridSpec::days () const {
+    return toDay < fromDay ? 0 : static_cast<std::size_t> (toDay - fromDay) + 1;
+  }
+
+  std::size_t SunGridSpec::size () const {
+    return days () * rows () * columns () * altitudes.size ();
+  }
+
+  std::size_t SunGridSpec::index (int dayNumber, std::size_t row, std::size_t column,
+                                  std::size_t altitude) const {
+    std::size_t day = static_cast<std::size_t> (dayNumber - fromDay);
+    return ((day * rows () + row) * columns () + column) * altitudes.size () + altitude;
+  }
+
+  struct SunGridEngine::Impl {
+    WorkStealingPool pool;
+    std::vector<SunCrossing> arena;
+    // per row, shared by every tile
+    std::vector<double> sinLat, cosLat;
+    // per worker, one ephemeris per tile column
+    std::vector<std::vector<ephemeris::SunEphemeris>> columns;
+
+    explicit Impl (unsigned threads) : pool (threads), columns (pool.size ()) {
+    }
+
+    void run (const SunGridSpec& spec, SunCrossing* out) {
+      std::size_t rows = spec.rows (), cols = spec.columns ();
+      std::size_t days = spec.days (), alts = spec.altitudes.size ();
+      if (rows == 0 || cols == 0 || days == 0 || alts == 0)
+        return;
+
+      sinLat.resize (rows);
+      cosLat.resize (rows);
+      for (std::size_t r = 0; r < rows; ++r) {
+        double lat = spec.latMin + spec.resolution * static_cast<double> (r);
+        sinLat[r] = sind (lat);
+        cosLat[r] = cosd (lat);
+      }
+
+      std::size_t tileCols = std::min (cols, kTileColumns);
+      std::size_t tileRows = std::max<std::size_t> (1, kTileCrossings / (tileCols * alts));
+      std::size_t colTiles = (cols + tileCols - 1) / tileCols;
+      std::size_t rowTiles = (rows + tileRows - 1) / tileRows;
+      for (auto& c : columns)
+        c.resize (tileCols);
+
+      bool fast = spec.engine == SunEngine::FastMath;
+      auto riseSet = fast ? ephemeris::riseSetFast : ephemeris::riseSet;
+
+      pool.parallelFor (days * rowTiles * colTiles, [&] (std::size_t tile, unsigned worker) {
+        std::size_t day = tile / (rowTiles * colTiles);
+        std::size_t r0 = (tile / colTiles % rowTiles) * tileRows;
+        std::size_t c0 = tile % colTiles * tileCols;
+        std::size_t r1 = std::min (rows, r0 + tileRows);
+        std::size_t c1 = std::min (cols, c0 + tileCols);
+        int dayNumber = spec.fromDay + static_cast<int> (day);
+
+        auto& eph = columns[worker];
+        for (std::size_t c = c0; c < c1; ++c) {
+          double lon = spec.lonMin + spec.resolution * static_cast<double> (c);
+          double d = ephemeris::localNoonDay (dayNumber, lon);
+          eph[c - c0] = spec.engine == SunEngine::EphemerisTable ? ephemeris::lookup (d)
+                        : fast                                   ? ephemeris::computeFast (d)
+                                                                 : ephemeris::compute (d);
+        }
+
+        for (std::size_t r = r0; r < r1; ++r) {
+          SunCrossing* row = out + spec.index (dayNumber, r, c0, 0);
+          for (std::size_t c = c0; c < c1; ++c) {
+            double lon = spec.lonMin + spec.resolution * static_cast<double> (c);
+            for (std::size_t a = 0; a < alts; ++a) {
+              SunCrossing& x = *row++;
+              x.rc = riseSet (eph[c - c0], lon, sinLat[r], cosLat[r], spec.altitudes[a].altit,
+                              spec.altitudes[a].upperLimb, &x.rise, &x.set);
+              x.dayLength = x.rc == 0 ? x.set - x.rise : (x.rc > 0 ? 24.0 : 0.0);
+            }
+          }
+        }
+      });
+    }
+  };
+
+  SunGridEngine::SunGridEngine (unsigned threads) : impl_ (std::make_unique<Impl> (threads)) {
+  }
+
+  SunGridEngine::SunGridEngine (SunGridEngine&&) noexcept = default;
+  SunGridEngine& SunGridEngine::operator= (SunGridEngine&&) noexcept = default;
+  SunGridEngine::~SunGridEngine () = default;
+
+  unsigned SunGridEngine::threads () const {
+    return impl_->pool.size ();
+  }
+
+  void SunGridEngine::compute (const SunGridSpec& spec, SunCrossing* out) {
+    impl_->run (spec, out);
+  }
+
+  const SunCrossing* SunGridEngine::compute (const SunGridSpec& spec) {
+    if (impl_->arena.size () < spec.size ())
+      impl_->arena.resize (spec.size ());
+    impl_->run (spec, impl_->arena.data ());
+    return impl_->arena.data ();
+  }
+
+} // namespace dotname
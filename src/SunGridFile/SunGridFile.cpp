@@ -0,0 +1,175 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/SunGridFile.hpp>
+#include <Assets/AssetContext.hpp>
+#include <Logger/Logger.hpp>
+#include "SunGridFormat.hpp"
+
+#include <cstring>
+#include <utility>
+
+#ifdef _WIN32
+  #include <fstream>
+#else
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+extern "C" {
+#include "SunrisetC/sunriset.h"
+}
+
+namespace dotname {
+
+  std::filesystem::path sunGridFilePath () {
+    return AssetContext::getAssetsPath () / "sungrid.bin";
+  }
+
+  SunGridFile::SunGridFile (const std::filesystem::path& file) {
+    open (file);
+  }
+
+  SunGridFile::SunGridFile (SunGridFile&& other) noexcept
+      : data_ (std::exchange (other.data_, nullptr)), size_ (std::exchange (other.size_, 0)),
+        header_ (std::exchange (other.header_, nullptr)) {
+  }
+
+  SunGridFile& SunGridFile::operator= (SunGridFile&& other) noexcept {
+    if (this != &other) {
+      close ();
+      data_ = std::exchange (other.data_, nullptr);
+      size_ = std::exchange (other.size_, 0);
+      header_ = std::exchange (other.header_, nullptr);
+    }
+    return *this;
+  }
+
+  SunGridFile::~SunGridFile () {
+    close ();
+  }
+
+  int SunGridFile::open (const std::filesystem::path& file) {
+    close ();
+
+#ifdef _WIN32
+    // no mmap here, read the file into memory once
+    std::ifstream in (file, std::ios::binary | std::ios::ate);
+    if (!in.is_open ()) {
+      LOG_E_STREAM << "Failed to open sun grid file: " << file << std::endl;
+      return -1;
+    }
+    size_ = static_cast<std::size_t> (in.tellg ());
+    auto* buffer = new char[size_];
+    in.seekg (0);
+    in.read (buffer, static_cast<std::streamsize> (size_));
+    data_ = buffer;
+#else
+    int fd = ::open (file.c_str (), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+      LOG_E_STREAM << "Failed to open sun grid file: " << file << std::endl;
+      return -1;
+    }
+    struct stat st{};
+    if (fstat (fd, &st) != 0 || st.st_size < static_cast<off_t> (sizeof (SunGridFileHeader))) {
+      LOG_E_STREAM << "Sun grid file too short: " << file << std::endl;
+      ::close (fd);
+      return -1;
+    }
+    size_ = static_cast<std::size_t> (st.st_size);
+    void* p = mmap (nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+    ::close (fd);
+    if (p == MAP_FAILED) {
+      LOG_E_STREAM << "Failed to map sun grid file: " << file << std::endl;
+      size_ = 0;
+      return -1;
+    }
+    data_ = p;
+#endif
+
+    const auto* h = static_cast<const SunGridFileHeader*> (data_);
+    std::uint64_t cells = static_cast<std::uint64_t> (h->days) * h->rows * h->columns;
+    bool valid = size_ >= sizeof (SunGridFileHeader)
+                 && std::memcmp (h->magic, sungrid::kMagic, sizeof (h->magic)) == 0
+                 && h->version == kSunGridFileVersion
+                 && h->headerSize == sizeof (SunGridFileHeader) && h->fileSize == size_
+                 && h->days == sungrid::kDays && h->rows >= 2 && h->columns >= 2
+                 && h->latStep > 0.0f && h->lonStep > 0.0f
+                 && h->nodesOffset + cells * sizeof (sungrid::Node) <= size_
+                 && h->cellsOffset + cells <= size_ && h->nodesOffset % alignof (sungrid::Node) == 0;
+    if (!valid) {
+      LOG_E_STREAM << "Invalid or incompatible sun grid file: " << file << std::endl;
+      close ();
+      return -1;
+    }
+    header_ = h;
+    return 0;
+  }
+
+  void SunGridFile::close () {
+    if (data_) {
+#ifdef _WIN32
+      delete[] static_cast<const char*> (data_);
+#else
+      munmap (const_cast<void*> (data_), size_);
+#endif
+    }
+    data_ = nullptr;
+    size_ = 0;
+    header_ = nullptr;
+  }
+
+  int SunGridFile::sunriset (int year, int month, int day, double lon, double lat,
+                             double* rise, double* set) const {
+    const SunGridFileHeader& h = *header_;
+    auto exact = [&] {
+      return __sunriset__ (year, month, day, lon, lat, h.altit, h.upperLimb, rise, set);
+    };
+
+    double fr = (lat - h.latMin) / h.latStep;
+    double fc = (lon - h.lonMin) / h.lonStep;
+    if (!(fr >= 0.0 && fr <= h.rows - 1) || !(fc >= 0.0 && fc <= h.columns - 1))
+      return exact ();
+
+    std::size_t r = std::min (static_cast<std::size_t> (fr), std::size_t (h.rows - 2));
+    std::size_t c = std::min (static_cast<std::size_t> (fc), std::size_t (h.columns - 2));
+    double fd = sungrid::solarSlot (year, month, day, h.referenceYear);
+    std::size_t d = std::min (static_cast<std::size_t> (fd), std::size_t (h.days - 2));
+    std::size_t plane = std::size_t (h.rows) * h.columns;
+    std::size_t i = (d * h.rows + r) * h.columns + c;
+
+    // both days of the cell have to agree on the return code
+    const auto* base = static_cast<const char*> (data_);
+    const auto* cells = reinterpret_cast<const std::int8_t*> (base + h.cellsOffset);
+    std::int8_t rc = cells[i];
+    if (rc == kSunGridExact || cells[i + plane] != rc)
+      return exact ();
+
+    // trilinear over day, lat, lon
+    const auto* n = reinterpret_cast<const sungrid::Node*> (base + h.nodesOffset) + i;
+    double z = fd - static_cast<double> (d);
+    double y = fr - static_cast<double> (r), x = fc - static_cast<double> (c);
+    double w[8];
+    std::size_t at[8];
+    for (int k = 0; k < 8; ++k) {
+      w[k] = ((k & 4) ? z : 1.0 - z) * ((k & 2) ? y : 1.0 - y) * ((k & 1) ? x : 1.0 - x);
+      at[k] = ((k & 4) ? plane : 0) + ((k & 2) ? h.columns : 0) + ((k & 1) ? 1 : 0);
+    }
+    double codeRise = 0.0, codeSet = 0.0;
+    for (int k = 0; k < 8; ++k) {
+      codeRise += w[k] * n[at[k]].rise;
+      codeSet += w[k] * n[at[k]].set;
+    }
+
+    // local mean time -> UT, wrapped like __sunriset__ wraps the transit
+    double r0 = sungrid::decode (codeRise) - lon / 15.0;
+    double s0 = sungrid::decode (codeSet) - lon / 15.0;
+    double shift = sungrid::wrapShift (0.5 * (r0 + s0));
+    *rise = r0 + shift;
+    *set = s0 + shift;
+    return rc;
+  }
+
+} // namespace dotname
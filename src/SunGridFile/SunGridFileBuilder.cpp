@@ -0,0 +1,243 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/SunGrid.hpp>
+#include <SunrisetWorker/SunGridFile.hpp>
+#include <SunrisetWorker/SunrisetBatch.hpp>
+#include <Logger/Logger.hpp>
+#include "SunGridFormat.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <vector>
+
+extern "C" {
+#include "SunrisetC/sunriset.h"
+}
+
+namespace dotname {
+
+  namespace {
+
+    bool divides (double step, double span) {
+      double n = span / step;
+      return step > 0.0 && std::fabs (n - std::round (n)) < 1e-9;
+    }
+
+    bool isLeap (int year) {
+      return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+    }
+
+    // rise/set as local mean time for one SunGridEngine run
+    struct Lmt {
+      std::vector<double> rise, set;
+      std::vector<std::int8_t> rc;
+    };
+
+    Lmt computeLmt (SunGridEngine& engine, const SunGridSpec& grid) {
+      const SunCrossing* x = engine.compute (grid);
+      Lmt out;
+      out.rise.resize (grid.size ());
+      out.set.resize (grid.size ());
+      out.rc.resize (grid.size ());
+      std::size_t cols = grid.columns ();
+      for (std::size_t i = 0; i < grid.size (); ++i) {
+        double lon = grid.lonMin + grid.resolution * static_cast<double> (i % cols);
+        out.rise[i] = x[i].rise + lon / 15.0;
+        out.set[i] = x[i].set + lon / 15.0;
+        out.rc[i] = static_cast<std::int8_t> (x[i].rc);
+      }
+      return out;
+    }
+
+    double clockDiffSeconds (double a, double b) {
+      double d = std::fmod (std::fabs (a - b), 24.0);
+      return std::min (d, 24.0 - d) * 3600.0;
+    }
+
+  } // namespace
+
+  int buildSunGridFile (const std::filesystem::path& file, const SunGridFileSpec& spec,
+                        unsigned threads) {
+    if (!divides (spec.latStep, 180.0) || !divides (spec.lonStep, 360.0)
+        || !isLeap (spec.referenceYear) || spec.validFromYear > spec.validToYear) {
+      LOG_E_STREAM << "Invalid sun grid spec: steps must divide 180/360 degrees and the "
+                      "reference year must be a leap year"
+                   << std::endl;
+      return -1;
+    }
+
+    SunGridEngine engine (threads);
+
+    // nodes
+    SunGridSpec grid;
+    grid.latMin = -90.0;
+    grid.latMax = 90.0;
+    grid.lonMin = -180.0;
+    grid.lonMax = 180.0;
+    grid.resolution = spec.latStep;
+    grid.fromDay = dayNumber (spec.referenceYear, 1, 1) - static_cast<int> (sungrid::kPadDays);
+    grid.toDay = grid.fromDay + static_cast<int> (sungrid::kDays) - 1;
+    grid.altitudes = { spec.altitude };
+    std::size_t rows = static_cast<std::size_t> (std::round (180.0 / spec.latStep)) + 1;
+    std::size_t cols = static_cast<std::size_t> (std::round (360.0 / spec.lonStep)) + 1;
+    std::size_t plane = rows * cols;
+    std::size_t cells = sungrid::kDays * plane;
+
+    std::vector<double> nodeRise (cells), nodeSet (cells);
+    std::vector<std::int8_t> nodeRc (cells);
+    std::vector<double> midRise (cells), midSet (cells);
+    std::vector<std::int8_t> midRc (cells);
+    for (std::size_t c = 0; c < cols; ++c) {
+      // one meridian of nodes, then the cell centres east of it; SunGridSpec has a single
+      // resolution and the grid is much coarser in longitude
+      for (int half = 0; half < 2; ++half) {
+        if (half && c + 1 == cols)
+          break;
+        SunGridSpec g = grid;
+        g.lonMin = g.lonMax = -180.0 + spec.lonStep * (static_cast<double> (c) + 0.5 * half);
+        if (half) {
+          g.latMin += 0.5 * spec.latStep;
+          g.latMax -= 0.5 * spec.latStep;
+        }
+        Lmt lmt = computeLmt (engine, g);
+        std::size_t gRows = g.rows ();
+        for (std::size_t d = 0; d < sungrid::kDays; ++d)
+          for (std::size_t r = 0; r < gRows; ++r) {
+            std::size_t from = d * gRows + r, to = d * plane + r * cols + c;
+            (half ? midRise : nodeRise)[to] = lmt.rise[from];
+            (half ? midSet : nodeSet)[to] = lmt.set[from];
+            (half ? midRc : nodeRc)[to] = lmt.rc[from];
+          }
+      }
+    }
+
+    SunGridFileHeader h{};
+    std::memcpy (h.magic, sungrid::kMagic, sizeof (h.magic));
+    h.version = kSunGridFileVersion;
+    h.headerSize = sizeof (SunGridFileHeader);
+    h.rows = static_cast<std::uint32_t> (rows);
+    h.columns = static_cast<std::uint32_t> (cols);
+    h.days = sungrid::kDays;
+    h.latMin = -90.0f;
+    h.latStep = static_cast<float> (spec.latStep);
+    h.lonMin = -180.0f;
+    h.lonStep = static_cast<float> (spec.lonStep);
+    h.altit = static_cast<float> (spec.altitude.altit);
+    h.upperLimb = spec.altitude.upperLimb;
+    h.referenceYear = spec.referenceYear;
+    h.validFromYear = spec.validFromYear;
+    h.validToYear = spec.validToYear;
+    h.toleranceSeconds = static_cast<float> (spec.toleranceSeconds);
+    h.nodesOffset = sizeof (SunGridFileHeader);
+    h.cellsOffset = h.nodesOffset + cells * sizeof (sungrid::Node);
+    h.fileSize = h.cellsOffset + cells;
+
+    std::vector<sungrid::Node> nodes (cells);
+    for (std::size_t i = 0; i < cells; ++i)
+      nodes[i] = { sungrid::encode (nodeRise[i]), sungrid::encode (nodeSet[i]) };
+
+    // a cell interpolates when its nodes and centre share the return code and the centre,
+    // where bilinear interpolation is at its worst, is within the tolerance
+    std::vector<std::int8_t> cell (cells, kSunGridExact);
+    for (std::size_t d = 0; d < sungrid::kDays; ++d)
+      for (std::size_t r = 0; r + 1 < rows; ++r)
+        for (std::size_t c = 0; c + 1 < cols; ++c) {
+          std::size_t i = d * plane + r * cols + c;
+          std::size_t q[4] = { i, i + 1, i + cols, i + cols + 1 };
+          std::int8_t rc = nodeRc[i];
+          bool same = midRc[i] == rc;
+          double rise = 0.0, set = 0.0;
+          for (std::size_t k : q) {
+            same = same && nodeRc[k] == rc;
+            rise += 0.25 * sungrid::decode (nodes[k].rise);
+            set += 0.25 * sungrid::decode (nodes[k].set);
+          }
+          if (same && std::fabs (rise - midRise[i]) * 3600.0 <= spec.toleranceSeconds
+              && std::fabs (set - midSet[i]) * 3600.0 <= spec.toleranceSeconds)
+            cell[i] = rc;
+        }
+
+    // other years move the polar boundary by a fraction of a degree, widen the exact
+    // region by one cell in latitude and one day each way
+    std::vector<std::int8_t> widened = cell;
+    for (std::size_t d = 0; d < sungrid::kDays; ++d)
+      for (std::size_t r = 0; r + 1 < rows; ++r)
+        for (std::size_t c = 0; c + 1 < cols; ++c) {
+          std::size_t i = d * plane + r * cols + c;
+          if (cell[i] != kSunGridExact)
+            continue;
+          std::size_t lastDay = std::min (d + 1, std::size_t (sungrid::kDays - 1));
+          for (std::size_t dd = d ? d - 1 : 0; dd <= lastDay; ++dd)
+            for (std::size_t rr = r ? r - 1 : 0; rr <= std::min (r + 1, rows - 2); ++rr)
+              widened[dd * plane + rr * cols + c] = kSunGridExact;
+        }
+
+    {
+      std::ofstream out (file, std::ios::binary | std::ios::trunc);
+      if (!out.is_open ()) {
+        LOG_E_STREAM << "Failed to open sun grid file for writing: " << file << std::endl;
+        return -1;
+      }
+      out.write (reinterpret_cast<const char*> (&h), sizeof (h));
+      out.write (reinterpret_cast<const char*> (nodes.data ()),
+                 static_cast<std::streamsize> (nodes.size () * sizeof (sungrid::Node)));
+      out.write (reinterpret_cast<const char*> (widened.data ()),
+                 static_cast<std::streamsize> (widened.size ()));
+      if (!out) {
+        LOG_E_STREAM << "Failed to write sun grid file: " << file << std::endl;
+        return -1;
+      }
+    }
+
+    // measure the bound through the reader over the validity years
+    double worst = 0.0;
+    std::size_t mismatches = 0;
+    {
+      SunGridFile reader;
+      if (reader.open (file) != 0)
+        return -1;
+      std::mt19937 rng (1);
+      std::uniform_int_distribution<int> year (spec.validFromYear, spec.validToYear);
+      std::uniform_int_distribution<int> month (1, 12), day (1, 28);
+      std::uniform_real_distribution<double> lat (-90.0, 90.0), lon (-180.0, 180.0);
+      for (std::size_t i = 0; i < spec.validationSamples; ++i) {
+        int y = year (rng), m = month (rng), d = day (rng);
+        double la = lat (rng), lo = lon (rng), r0, s0, r1, s1;
+        int rc0 = __sunriset__ (y, m, d, lo, la, spec.altitude.altit, spec.altitude.upperLimb,
+                                &r0, &s0);
+        int rc1 = reader.sunriset (y, m, d, lo, la, &r1, &s1);
+        if (rc0 != rc1) {
+          ++mismatches;
+          continue;
+        }
+        worst = std::max ({ worst, clockDiffSeconds (r0, r1), clockDiffSeconds (s0, s1) });
+      }
+    }
+
+    h.maxErrorSeconds = static_cast<float> (worst);
+    std::fstream patch (file, std::ios::binary | std::ios::in | std::ios::out);
+    patch.write (reinterpret_cast<const char*> (&h), sizeof (h));
+    if (!patch) {
+      LOG_E_STREAM << "Failed to write sun grid file header: " << file << std::endl;
+      return -1;
+    }
+
+    std::size_t exact = 0;
+    for (std::size_t d = 0; d < sungrid::kDays; ++d)
+      for (std::size_t r = 0; r + 1 < rows; ++r)
+        for (std::size_t c = 0; c + 1 < cols; ++c)
+          exact += widened[d * plane + r * cols + c] == kSunGridExact;
+    std::size_t used = sungrid::kDays * (rows - 1) * (cols - 1);
+    LOG_I_STREAM << "Sun grid written: " << file << " (" << rows << " x " << cols << " x "
+                 << sungrid::kDays << ", " << h.fileSize / 1024 << " KiB, "
+                 << 100.0 * static_cast<double> (exact) / static_cast<double> (used)
+                 << " % exact cells, max error " << worst << " s, " << mismatches
+                 << " return code mismatches)" << std::endl;
+    return 0;
+  }
+
+} // namespace dotname
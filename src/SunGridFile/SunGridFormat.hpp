@@ -0,0 +1,76 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __SUNGRIDFORMAT_HPP
+#define __SUNGRIDFORMAT_HPP
+
+// On-disk encoding shared by the SunGridFile builder and reader
+
+#include <SunrisetWorker/SunGridFile.hpp>
+#include <SunrisetWorker/SunrisetBatch.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace dotname::sungrid {
+
+  struct Node {
+    std::uint16_t rise;
+    std::uint16_t set;
+  };
+
+  // no padding, the header is written and mapped as is (little endian)
+  static_assert (sizeof (SunGridFileHeader) == 96, "SunGridFileHeader layout changed");
+
+  constexpr char kMagic[8] = { 'S', 'U', 'N', 'G', 'R', 'I', 'D', '\0' };
+  // the 366 dates of a leap year plus two days of the neighbouring years on each side
+  constexpr std::uint32_t kDays = 370;
+  constexpr std::uint32_t kPadDays = 2;
+  constexpr double kTropicalYear = 365.2422;
+
+  // local mean times stay within [-1, 25) hours, 26 h / 65535 = 1.43 s per step
+  constexpr double kBias = 1.0;
+  constexpr double kRange = 26.0;
+  constexpr double kScale = 65535.0 / kRange;
+
+  inline std::uint16_t encode (double lmtHours) {
+    double v = std::round ((lmtHours + kBias) * kScale);
+    return static_cast<std::uint16_t> (std::clamp (v, 0.0, 65535.0));
+  }
+
+  // also valid for a weighted mean of codes, as long as the weights sum to 1
+  inline double decode (double v) {
+    return v * (kRange / 65535.0) - kBias;
+  }
+
+  // slot of a calendar date in the reference (leap) year, so Feb 29 has its own slot
+  inline std::uint32_t slotOfDate (int month, int day) {
+    static constexpr std::uint32_t start[12]
+        = { 0, 31, 60, 91, 121, 152, 182, 213, 244, 274, 305, 335 };
+    month = std::clamp (month, 1, 12);
+    day = std::clamp (day, 1, 31);
+    return kPadDays
+           + std::min<std::uint32_t> (start[month - 1] + static_cast<std::uint32_t> (day - 1),
+                                      365);
+  }
+
+  // The same date in another year is up to about a day off in the solar cycle (leap
+  // years). Returns the fractional slot with the same Sun position as the query date.
+  inline double solarSlot (int year, int month, int day, int referenceYear) {
+    int delta = dayNumber (year, month, day) - dayNumber (referenceYear, month, day);
+    double shift = delta - (year - referenceYear) * kTropicalYear;
+    return std::clamp (slotOfDate (month, day) + shift, 0.0, kDays - 1.0);
+  }
+
+  // __sunriset__ wraps the transit into (0, 24] UT through rev180 (), do the same to a
+  // transit derived from local mean time
+  inline double wrapShift (double tsouth) {
+    double x = (12.0 - tsouth) * 15.0;
+    double wrapped = x - 360.0 * std::floor (x / 360.0 + 0.5);
+    return (x - wrapped) / 15.0;
+  }
+
+} // namespace dotname::sungrid
+
+#endif // __SUNGRIDFORMAT_HPP
@@ -0,0 +1,193 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/SunRamp.hpp>
+#include <SunrisetWorker/SunrisetBatch.hpp>
+#include "SunEphemeris/SunEphemeris.hpp"
+#include "SunState/SunClock.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace dotname {
+
+  using namespace sunclock;
+
+  namespace {
+
+    constexpr double kPi = 3.14159265358979323846;
+    constexpr double kDegRad = kPi / 180.0;
+
+    // degrees to [-180, 180)
+    double wrap180 (double x) {
+      return x - 360.0 * std::floor (x / 360.0 + 0.5);
+    }
+
+    bool pointBefore (Clock::time_point t, const SunRampPoint& p) {
+      return t < p.at;
+    }
+
+  } // namespace
+
+  SunRamp::SunRamp (double lat, double lon, int utcOffsetMinutes, const SunRampSpec& spec)
+      : lat_ (lat), lon_ (lon), sinLat_ (std::sin (lat * kDegRad)),
+        cosLat_ (std::cos (lat * kDegRad)), utcOffsetMinutes_ (utcOffsetMinutes), spec_ (spec) {
+    if (spec_.sampleSeconds <= 0)
+      spec_.sampleSeconds = 60;
+    if (spec_.highElevation <= spec_.lowElevation)
+      spec_.highElevation = spec_.lowElevation + 1e-6;
+  }
+
+  long SunRamp::localDay (Clock::time_point t) const {
+    return localDayOf (ticks (t), utcOffsetMinutes_);
+  }
+
+  // RA, declination and culmination of the date, as __sunriset__ evaluates them at
+  // local noon; the elevation of the whole date is one cos away from them
+  void SunRamp::curve (long localDay) {
+    if (curve_.valid && curve_.day == localDay)
+      return;
+    ephemeris::SunEphemeris e
+        = ephemeris::compute (ephemeris::localNoonDay (dayNumberOf (localDay), lon_));
+    curve_.day = localDay;
+    curve_.valid = true;
+    curve_.sinDec = e.sinDec;
+    curve_.cosDec = e.cosDec;
+    curve_.tsouth = 12.0 - wrap180 (e.gmst0 + 180.0 + lon_ - e.sRA) / 15.0;
+  }
+
+  double SunRamp::elevation (std::int64_t t) const {
+    // hours UT from 0h UT of the curve's date
+    double hours = (static_cast<double> (t) / kTicksPerSecond - curve_.day * 86400.0) / 3600.0;
+    double hourAngle = 15.0 * (hours - curve_.tsouth) * kDegRad;
+    double s = sinLat_ * curve_.sinDec + cosLat_ * curve_.cosDec * std::cos (hourAngle);
+    return std::asin (std::clamp (s, -1.0, 1.0)) / kDegRad;
+  }
+
+  double SunRamp::elevationAt (Clock::time_point t) {
+    curve (localDay (t));
+    return elevation (ticks (t));
+  }
+
+  double SunRamp::output (double elevation) const {
+    double f = (elevation - spec_.lowElevation) / (spec_.highElevation - spec_.lowElevation);
+    f = std::clamp (f, 0.0, 1.0);
+    return spec_.nightValue + f * (spec_.dayValue - spec_.nightValue);
+  }
+
+  double SunRamp::valueAt (Clock::time_point t) {
+    return output (elevationAt (t));
+  }
+
+  double SunRamp::quantize (double value) const {
+    if (spec_.step <= 0.0)
+      return value;
+    double step = spec_.dayValue >= spec_.nightValue ? spec_.step : -spec_.step;
+    double q = spec_.nightValue + std::round ((value - spec_.nightValue) / step) * step;
+    return std::clamp (q, std::min (spec_.nightValue, spec_.dayValue),
+                       std::max (spec_.nightValue, spec_.dayValue));
+  }
+
+  void SunRamp::build (long localDay, std::vector<SunRampPoint>& out, double& startValue) {
+    out.clear ();
+    curve (localDay); // one ephemeris for the whole date, the end sample included
+    const double from = localDay * 86400.0 - utcOffsetMinutes_ * 60.0; // local midnight
+    const int samples = 86400 / spec_.sampleSeconds;
+    auto valueOf = [&] (double seconds) {
+      return output (elevation (static_cast<std::int64_t> (std::llround (seconds
+                                                                          * kTicksPerSecond))));
+    };
+
+    double previous = valueOf (from);
+    double level = quantize (previous);
+    startValue = level;
+    for (int i = 1; i <= samples; ++i) {
+      double seconds = from + static_cast<double> (i) * spec_.sampleSeconds;
+      double value = valueOf (seconds);
+      double next = quantize (value);
+      if (next != level) {
+        // where the line between the samples crosses halfway between the two levels
+        double f = value != previous ? (0.5 * (level + next) - previous) / (value - previous)
+                                     : 1.0;
+        double at = seconds - spec_.sampleSeconds * (1.0 - std::clamp (f, 0.0, 1.0));
+        out.push_back (
+            { timePoint (static_cast<std::int64_t> (std::llround (at * kTicksPerSecond))), next });
+        level = next;
+      }
+      previous = value;
+    }
+  }
+
+  const std::vector<SunRampPoint>& SunRamp::plan (long localDay, double* startValue) {
+    double start;
+    build (localDay, scratch_, start);
+    if (startValue)
+      *startValue = start;
+    return scratch_;
+  }
+
+  std::size_t SunRamp::fire (Clock::time_point now, const Callback& onValue) {
+    const std::int64_t t = ticks (now);
+    const long today = localDay (now);
+    if (!planned_ || today != planDay_) {
+      planDay_ = today;
+      planned_ = true;
+      build (today, plan_, startValue_);
+      cursor_ = 0;
+    }
+
+    // every point due since the last call collapses into the latest one
+    auto due = static_cast<std::size_t> (
+        std::upper_bound (plan_.begin (), plan_.end (), now, pointBefore) - plan_.begin ());
+    if (due > cursor_)
+      pending_ += due - cursor_;
+    cursor_ = due;
+    const double target = due ? plan_[due - 1].value : startValue_;
+
+    if (started_ && target == written_) {
+      stats_.coalesced += pending_; // changed and changed back before a write
+      pending_ = 0;
+      held_ = false;
+      return 0;
+    }
+    const auto minInterval = std::chrono::duration_cast<Clock::duration> (spec_.minInterval);
+    if (started_ && t - writtenAt_ < minInterval.count ()) {
+      held_ = true;
+      ++stats_.rateLimited;
+      return 0;
+    }
+    onValue (target);
+    if (pending_ > 1)
+      stats_.coalesced += pending_ - 1;
+    pending_ = 0;
+    written_ = target;
+    writtenAt_ = t;
+    started_ = true;
+    held_ = false;
+    ++stats_.writes;
+    return 1;
+  }
+
+  Clock::time_point SunRamp::nextAt () const {
+    const auto earliest
+        = timePoint (writtenAt_)
+          + std::chrono::duration_cast<Clock::duration> (spec_.minInterval);
+    if (held_)
+      return earliest;
+    Clock::time_point next
+        = cursor_ < plan_.size ()
+              ? plan_[cursor_].at
+              : timePoint (midnightOf (planDay_ + 1, utcOffsetMinutes_));
+    return std::max (next, earliest);
+  }
+
+  void SunRamp::run (const Callback& onValue) {
+    runTimer (
+        m_, wake_, stop_, [this] { return nextAt (); }, [&] { fire (Clock::now (), onValue); });
+  }
+
+  void SunRamp::stop () {
+    stopTimer (m_, wake_, stop_);
+  }
+
+} // namespace dotname
@@ -0,0 +1,470 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/SunScheduler.hpp>
+#include <SunrisetWorker/SunrisetBatch.hpp>
+#include "SunState/SunClock.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <ctime>
+#include <limits>
+
+extern "C" {
+#include "SunrisetC/sunriset.h"
+}
+
+namespace dotname {
+
+  using namespace sunclock;
+
+  namespace {
+
+    constexpr std::uint32_t kNotQueued = std::numeric_limits<std::uint32_t>::max ();
+    constexpr std::int64_t kNever = std::numeric_limits<std::int64_t>::max ();
+  } // namespace
+
+  int systemZoneOffset (Clock::time_point t) {
+    std::time_t time = Clock::to_time_t (t);
+    std::tm tm {};
+#ifdef _WIN32
+    localtime_s (&tm, &time);
+    return static_cast<int> ((_mkgmtime (&tm) - time) / 60);
+#else
+    localtime_r (&time, &tm);
+    return static_cast<int> (tm.tm_gmtoff / 60);
+#endif
+  }
+
+  SunScheduler::SunScheduler (Callback onTransition, SunZone zone)
+      : onTransition_ (std::move (onTransition)), zone_ (std::move (zone)), zoneChangeAt_ (kNever) {
+  }
+
+  // Events of the local dates localDay and localDay + 1 that fall into
+  // [max (windowStart_, from), windowEnd_), in time order
+  void SunScheduler::windowEvents (Schedule& s, long localDay, const double* rise,
+                                   const double* set, const int* rc, std::int64_t from) {
+    const SunStateParams& p = s.params;
+    const double utc = p.utcOffsetMinutes / 60.0;
+    const std::int64_t lo = std::max (windowStart_, from);
+    s.count = 0;
+    s.next = 0;
+    auto emit = [&] (double seconds, bool toLight) {
+      std::int64_t at = static_cast<std::int64_t> (std::llround (seconds * kTicksPerSecond));
+      if (at >= lo && at < windowEnd_)
+        s.events[s.count++] = { at, toLight };
+    };
+
+    for (int i = 0; i < 2; ++i) {
+      double midnight = (localDay + i) * 86400.0 - p.utcOffsetMinutes * 60.0;
+      if (rc[i] != 0) {
+        emit (midnight, rc[i] > 0); // polar day / night for the whole date
+        continue;
+      }
+      SunState state {};
+      state.lightAt = normalize (normalize (rise[i] + utc) + p.riseOffsetMinutes / 60.0);
+      state.darkAt = normalize (normalize (set[i] + utc) + p.setOffsetMinutes / 60.0);
+      emit (midnight, SunStateEngine::isDayAt (state, 0.0));
+      if (state.lightAt == state.darkAt)
+        continue; // no light window at all, the midnight state holds
+      // the later of the two wins a tie with midnight, as isDayAt ()
+      if (state.lightAt < state.darkAt) {
+        emit (midnight + state.lightAt * 3600.0, true);
+        emit (midnight + state.darkAt * 3600.0, false);
+      } else {
+        emit (midnight + state.darkAt * 3600.0, false);
+        emit (midnight + state.lightAt * 3600.0, true);
+      }
+    }
+  }
+
+  SunScheduleId SunScheduler::add (const SunStateParams& params, Clock::time_point now) {
+    std::lock_guard<std::mutex> lock (m_);
+    return addSchedule (params, ticks (now), false);
+  }
+
+  SunScheduleId SunScheduler::addLocal (const SunStateParams& params, Clock::time_point now) {
+    std::lock_guard<std::mutex> lock (m_);
+    return addSchedule (params, ticks (now), true);
+  }
+
+  SunScheduleId SunScheduler::addSchedule (const SunStateParams& params, std::int64_t t,
+                                           bool local) {
+    if (active_ == 0) {
+      windowStart_ = floorDiv (t, kDay) * kDay;
+      windowEnd_ = windowStart_ + kDay;
+    }
+
+    SunScheduleId id;
+    if (!free_.empty ()) {
+      id = free_.back ();
+      free_.pop_back ();
+    } else {
+      id = static_cast<SunScheduleId> (schedules_.size ());
+      schedules_.emplace_back ();
+    }
+    Schedule& s = schedules_[id];
+    s.params = params;
+    s.active = true;
+    s.local = local;
+    s.heapPos = kNotQueued;
+    if (local)
+      s.params.utcOffsetMinutes = zone_ (timePoint (t));
+    s.isDay = SunStateEngine (s.params).stateAt (timePoint (t)).isDay;
+    ++active_;
+
+    std::vector<SunScheduleEvent> none; // the state was just taken
+    retime (id, t, none);
+    if (local) {
+      local_.push_back (id);
+      if (local_.size () == 1)
+        zoneChangeAt_ = nextZoneChange (t);
+    }
+
+    wake_.notify_one ();
+    return id;
+  }
+
+  // Events of one schedule from `from` on, requeued in O(log n); a state the schedule is
+  // in at `from` other than the last fired one is due at `from`
+  void SunScheduler::retime (SunScheduleId id, std::int64_t from,
+                             std::vector<SunScheduleEvent>& due) {
+    Schedule& s = schedules_[id];
+    const SunStateParams& p = s.params;
+    long localDay = localDayOf (windowStart_, p.utcOffsetMinutes);
+    double rise[2], set[2];
+    int rc[2];
+    for (int i = 0; i < 2; ++i)
+      rc[i] = __sunriset__ (2000, 1, dayNumberOf (localDay + i), p.lon, p.lat, p.altitude.altit,
+                            p.altitude.upperLimb, &rise[i], &set[i]);
+    windowEvents (s, localDay, rise, set, rc, from);
+    bool isDay = SunStateEngine (p).stateAt (timePoint (from)).isDay;
+    if (isDay != s.isDay) {
+      s.isDay = isDay;
+      due.push_back ({ id, isDay, timePoint (from) });
+    }
+    heapUpdate (id);
+  }
+
+  // local schedules whose offset differs at `at` are recomputed from there on
+  void SunScheduler::retimeLocal (std::int64_t at, std::vector<SunScheduleEvent>& due) {
+    const int offset = zone_ (timePoint (at));
+    for (SunScheduleId id : local_) {
+      Schedule& s = schedules_[id];
+      if (s.params.utcOffsetMinutes == offset)
+        continue;
+      s.params.utcOffsetMinutes = offset;
+      retime (id, at, due);
+      ++stats_.retimed;
+    }
+    zoneChangeAt_ = nextZoneChange (at);
+  }
+
+  // First instant after `from` and up to the window end where the zone's offset differs
+  // from the one at `from`: hourly probes, then bisection down to a tick
+  std::int64_t SunScheduler::nextZoneChange (std::int64_t from) const {
+    if (local_.empty ())
+      return kNever;
+    const int offset = zone_ (timePoint (from));
+    for (std::int64_t lo = from; lo < windowEnd_;) {
+      std::int64_t hi = std::min (lo + kHour, windowEnd_);
+      if (zone_ (timePoint (hi)) != offset) {
+        while (hi - lo > 1) {
+          std::int64_t mid = lo + (hi - lo) / 2;
+          (zone_ (timePoint (mid)) == offset ? lo : hi) = mid;
+        }
+        return hi;
+      }
+      lo = hi;
+    }
+    return kNever;
+  }
+
+  bool SunScheduler::remove (SunScheduleId id) {
+    std::lock_guard<std::mutex> lock (m_);
+    if (id >= schedules_.size () || !schedules_[id].active)
+      return false;
+    Schedule& s = schedules_[id];
+    if (s.heapPos != kNotQueued)
+      heapErase (s.heapPos);
+    s.active = false;
+    free_.push_back (id);
+    --active_;
+    if (s.local) {
+      local_.erase (std::find (local_.begin (), local_.end (), id));
+      if (local_.empty ())
+        zoneChangeAt_ = kNever;
+    }
+    wake_.notify_one ();
+    return true;
+  }
+
+  std::size_t SunScheduler::size () const {
+    std::lock_guard<std::mutex> lock (m_);
+    return active_;
+  }
+
+  bool SunScheduler::isDay (SunScheduleId id) const {
+    std::lock_guard<std::mutex> lock (m_);
+    return id < schedules_.size () && schedules_[id].active && schedules_[id].isDay;
+  }
+
+  std::int64_t SunScheduler::wakeAt () const {
+    std::int64_t at = std::min (windowEnd_, zoneChangeAt_);
+    return heap_.empty () ? at : std::min (heap_[0].key, at);
+  }
+
+  Clock::time_point SunScheduler::nextWake () const {
+    std::lock_guard<std::mutex> lock (m_);
+    if (active_ == 0)
+      return Clock::time_point::max ();
+    return timePoint (wakeAt ());
+  }
+
+  SunSchedulerStats SunScheduler::stats () const {
+    std::lock_guard<std::mutex> lock (m_);
+    return stats_;
+  }
+
+  void SunScheduler::recompute (std::int64_t windowStart, std::int64_t from) {
+    windowStart_ = windowStart;
+    windowEnd_ = windowStart + kDay;
+
+    // two local dates per schedule, one sunrisetBatch () per distinct altitude
+    std::vector<SunScheduleId> ids;
+    ids.reserve (active_);
+    for (SunScheduleId id = 0; id < schedules_.size (); ++id)
+      if (schedules_[id].active)
+        ids.push_back (id);
+    std::stable_sort (ids.begin (), ids.end (), [this] (SunScheduleId a, SunScheduleId b) {
+      const SunAltitude& x = schedules_[a].params.altitude;
+      const SunAltitude& y = schedules_[b].params.altitude;
+      return x.altit < y.altit || (x.altit == y.altit && x.upperLimb < y.upperLimb);
+    });
+
+    const std::size_t n = ids.size ();
+    std::vector<int> days (2 * n), rc (2 * n);
+    std::vector<double> lat (2 * n), lon (2 * n), rise (2 * n), set (2 * n);
+    std::vector<long> localDays (n);
+    const int offset = local_.empty () ? 0 : zone_ (timePoint (from));
+    for (std::size_t i = 0; i < n; ++i) {
+      if (schedules_[ids[i]].local)
+        schedules_[ids[i]].params.utcOffsetMinutes = offset;
+      const SunStateParams& p = schedules_[ids[i]].params;
+      localDays[i] = localDayOf (windowStart_, p.utcOffsetMinutes);
+      for (std::size_t j = 0; j < 2; ++j) {
+        days[2 * i + j] = dayNumberOf (localDays[i] + static_cast<long> (j));
+        lat[2 * i + j] = p.lat;
+        lon[2 * i + j] = p.lon;
+      }
+    }
+    for (std::size_t begin = 0, end; begin < n; begin = end) {
+      const SunAltitude& a = schedules_[ids[begin]].params.altitude;
+      for (end = begin + 1; end < n; ++end) {
+        const SunAltitude& b = schedules_[ids[end]].params.altitude;
+        if (b.altit != a.altit || b.upperLimb != a.upperLimb)
+          break;
+      }
+      std::size_t at = 2 * begin, count = 2 * (end - begin);
+      sunrisetBatch (&days[at], &lat[at], &lon[at], count, a.altit, a.upperLimb, &rise[at],
+                     &set[at], &rc[at]);
+    }
+
+    heap_.clear ();
+    for (std::size_t i = 0; i < n; ++i) {
+      Schedule& s = schedules_[ids[i]];
+      windowEvents (s, localDays[i], &rise[2 * i], &set[2 * i], &rc[2 * i], from);
+      s.heapPos = kNotQueued;
+      if (s.count) {
+        s.heapPos = static_cast<std::uint32_t> (heap_.size ());
+        heap_.push_back ({ s.events[0].at, ids[i] });
+      }
+    }
+    heapRebuild ();
+    zoneChangeAt_ = nextZoneChange (from);
+  }
+
+  void SunScheduler::resync (std::int64_t now, std::vector<SunScheduleEvent>& due) {
+    const int offset = local_.empty () ? 0 : zone_ (timePoint (now));
+    for (SunScheduleId id = 0; id < schedules_.size (); ++id) {
+      Schedule& s = schedules_[id];
+      if (!s.active)
+        continue;
+      if (s.local)
+        s.params.utcOffsetMinutes = offset;
+      bool isDay = SunStateEngine (s.params).stateAt (timePoint (now)).isDay;
+      if (isDay != s.isDay) {
+        s.isDay = isDay;
+        due.push_back ({ id, isDay, timePoint (now) });
+      }
+    }
+    recompute (floorDiv (now, kDay) * kDay, now);
+    ++stats_.resyncs;
+  }
+
+  // every event, zone change and window end up to t in time order
+  void SunScheduler::drain (std::int64_t t, std::vector<SunScheduleEvent>& due) {
+    for (;;) {
+      const std::int64_t top = heap_.empty () ? kNever : heap_[0].key;
+      if (zoneChangeAt_ <= t && zoneChangeAt_ <= top) {
+        retimeLocal (zoneChangeAt_, due);
+        continue;
+      }
+      if (top <= t) {
+        SunScheduleId id = heap_[0].id;
+        Schedule& s = schedules_[id];
+        const Event& e = s.events[s.next++];
+        if (e.toLight != s.isDay) { // midnight events mostly confirm the state
+          s.isDay = e.toLight;
+          due.push_back ({ id, e.toLight, timePoint (e.at) });
+        }
+        if (s.next < s.count) {
+          heap_[0].key = s.events[s.next].at;
+          siftDown (0);
+        } else {
+          heapErase (0);
+        }
+        continue;
+      }
+      if (active_ == 0 || windowEnd_ > t)
+        break;
+      // the window is drained, next day for everyone, or catch up after a long sleep
+      if (t - windowEnd_ >= kDay) {
+        resync (t, due);
+      } else {
+        recompute (windowEnd_, windowEnd_);
+        ++stats_.windows;
+      }
+    }
+  }
+
+  std::size_t SunScheduler::fire (Clock::time_point now) {
+    std::vector<SunScheduleEvent> due;
+    {
+      std::lock_guard<std::mutex> lock (m_);
+      drain (ticks (now), due);
+    }
+    for (const auto& event : due)
+      onTransition_ (event);
+    return due.size ();
+  }
+
+  std::size_t SunScheduler::clockChanged (Clock::time_point now) {
+    std::vector<SunScheduleEvent> due;
+    {
+      std::lock_guard<std::mutex> lock (m_);
+      if (active_)
+        resync (ticks (now), due);
+      wake_.notify_one ();
+    }
+    for (const auto& event : due)
+      onTransition_ (event);
+    return due.size ();
+  }
+
+  std::size_t SunScheduler::zoneChanged (Clock::time_point now) {
+    std::vector<SunScheduleEvent> due;
+    {
+      std::lock_guard<std::mutex> lock (m_);
+      const std::int64_t t = ticks (now);
+      drain (t, due);
+      if (!local_.empty ())
+        retimeLocal (t, due);
+      wake_.notify_one ();
+    }
+    for (const auto& event : due)
+      onTransition_ (event);
+    return due.size ();
+  }
+
+  void SunScheduler::run () {
+    runTimer (
+        m_, wake_, stop_,
+        [this] { return active_ ? timePoint (wakeAt ()) : Clock::time_point::max (); },
+        [this] { fire (Clock::now ()); });
+  }
+
+  void SunScheduler::stop () {
+    stopTimer (m_, wake_, stop_);
+  }
+
+  // indexed 4-ary min-heap on HeapEntry::key, Schedule::heapPos tracks every entry
+
+  void SunScheduler::place (std::uint32_t pos, const HeapEntry& entry) {
+    heap_[pos] = entry;
+    schedules_[entry.id].heapPos = pos;
+  }
+
+  void SunScheduler::siftUp (std::uint32_t pos) {
+    HeapEntry entry = heap_[pos];
+    while (pos > 0) {
+      std::uint32_t parent = (pos - 1) / 4;
+      if (heap_[parent].key <= entry.key)
+        break;
+      place (pos, heap_[parent]);
+      pos = parent;
+    }
+    place (pos, entry);
+  }
+
+  void SunScheduler::siftDown (std::uint32_t pos) {
+    HeapEntry entry = heap_[pos];
+    const auto size = static_cast<std::uint32_t> (heap_.size ());
+    for (;;) {
+      std::uint32_t first = 4 * pos + 1;
+      if (first >= size)
+        break;
+      std::uint32_t last = std::min (first + 4, size);
+      std::uint32_t best = first;
+      for (std::uint32_t c = first + 1; c < last; ++c)
+        if (heap_[c].key < heap_[best].key)
+          best = c;
+      if (entry.key <= heap_[best].key)
+        break;
+      place (pos, heap_[best]);
+      pos = best;
+    }
+    place (pos, entry);
+  }
+
+  void SunScheduler::heapPush (SunScheduleId id) {
+    heap_.push_back ({ schedules_[id].events[schedules_[id].next].at, id });
+    siftUp (static_cast<std::uint32_t> (heap_.size () - 1));
+  }
+
+  void SunScheduler::heapUpdate (SunScheduleId id) {
+    const Schedule& s = schedules_[id];
+    if (s.next >= s.count) {
+      if (s.heapPos != kNotQueued)
+        heapErase (s.heapPos);
+    } else if (s.heapPos == kNotQueued) {
+      heapPush (id);
+    } else {
+      heap_[s.heapPos].key = s.events[s.next].at;
+      siftUp (s.heapPos);
+      siftDown (s.heapPos);
+    }
+  }
+
+  void SunScheduler::heapErase (std::uint32_t pos) {
+    schedules_[heap_[pos].id].heapPos = kNotQueued;
+    HeapEntry last = heap_.back ();
+    heap_.pop_back ();
+    if (pos == heap_.size ())
+      return;
+    place (pos, last);
+    // the moved entry may belong above or below its new place
+    if (pos > 0 && heap_[(pos - 1) / 4].key > last.key)
+      siftUp (pos);
+    else
+      siftDown (pos);
+  }
+
+  void SunScheduler::heapRebuild () {
+    if (heap_.size () < 2)
+      return;
+    for (auto pos = static_cast<std::uint32_t> ((heap_.size () - 2) / 4 + 1); pos-- > 0;)
+      siftDown (pos);
+  }
+
+} // namespace dotname
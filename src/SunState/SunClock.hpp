@@ -0,0 +1,95 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __SUNCLOCK_HPP
+#define __SUNCLOCK_HPP
+
+// system_clock arithmetic on raw ticks and the timer loop shared by SunScheduler,
+// SunTimeline and SunRamp. Local dates are days since 1970-01-01 at a fixed UTC offset.
+
+#include <SunrisetWorker/SunrisetBatch.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+namespace dotname::sunclock {
+
+  using Clock = std::chrono::system_clock;
+
+  constexpr std::int64_t kDay
+      = std::chrono::duration_cast<Clock::duration> (std::chrono::hours (24)).count ();
+  constexpr std::int64_t kHour = kDay / 24;
+  constexpr double kTicksPerSecond
+      = static_cast<double> (Clock::period::den) / static_cast<double> (Clock::period::num);
+
+  inline std::int64_t ticks (Clock::time_point t) {
+    return t.time_since_epoch ().count ();
+  }
+
+  inline Clock::time_point timePoint (std::int64_t t) {
+    return Clock::time_point (Clock::duration (t));
+  }
+
+  inline std::int64_t floorDiv (std::int64_t a, std::int64_t b) {
+    return a / b - (a % b != 0 && (a < 0) != (b < 0));
+  }
+
+  // hours to [0, 24)
+  inline double normalize (double hours) {
+    return hours - 24.0 * std::floor (hours / 24.0);
+  }
+
+  inline std::int64_t offsetTicks (int utcOffsetMinutes) {
+    return static_cast<std::int64_t> (utcOffsetMinutes) * 60
+           * static_cast<std::int64_t> (kTicksPerSecond);
+  }
+
+  // local date of ticks t
+  inline long localDayOf (std::int64_t t, int utcOffsetMinutes) {
+    return static_cast<long> (floorDiv (t + offsetTicks (utcOffsetMinutes), kDay));
+  }
+
+  // ticks of the local midnight that starts localDay
+  inline std::int64_t midnightOf (long localDay, int utcOffsetMinutes) {
+    return localDay * kDay - offsetTicks (utcOffsetMinutes);
+  }
+
+  // days since 1970-01-01 -> days since 2000 Jan 0, as __sunriset__ takes them
+  inline int dayNumberOf (long epochDay) {
+    static const int epoch = dayNumber (1970, 1, 1);
+    return static_cast<int> (epochDay) + epoch;
+  }
+
+  // The run () loop: fire () without `m` held, then sleep on `wake` until nextAt () (taken
+  // with `m` held, time_point::max () sleeps until notified) and again, until stopTimer ();
+  // a stopTimer () before the loop starts makes it return at once
+  template <class NextAt, class Fire>
+  void runTimer (std::mutex& m, std::condition_variable& wake, bool& stop, NextAt nextAt,
+                 Fire fire) {
+    std::unique_lock<std::mutex> lock (m);
+    while (!stop) {
+      lock.unlock ();
+      fire ();
+      lock.lock ();
+      if (stop)
+        break;
+      const Clock::time_point at = nextAt ();
+      if (at == Clock::time_point::max ())
+        wake.wait (lock);
+      else
+        wake.wait_until (lock, at);
+    }
+  }
+
+  inline void stopTimer (std::mutex& m, std::condition_variable& wake, bool& stop) {
+    std::lock_guard<std::mutex> lock (m);
+    stop = true;
+    wake.notify_all ();
+  }
+
+} // namespace dotname::sunclock
+
+#endif // __SUNCLOCK_HPP
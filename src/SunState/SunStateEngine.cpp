@@ -0,0 +1,130 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/SunState.hpp>
+#include "SunState/SunClock.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+extern "C" {
+#include "SunrisetC/sunriset.h"
+}
+
+namespace dotname {
+
+  using sunclock::normalize;
+
+  namespace {
+
+    // days since 1970-01-01 -> proleptic Gregorian date (H. Hinnant's algorithm)
+    void civilFromDays (long z, int& y, int& m, int& d) {
+      z += 719468;
+      long era = (z >= 0 ? z : z - 146096) / 146097;
+      long doe = z - era * 146097;
+      long yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+      long doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+      long mp = (5 * doy + 2) / 153;
+      d = static_cast<int> (doy - (153 * mp + 2) / 5 + 1);
+      m = static_cast<int> (mp < 10 ? mp + 3 : mp - 9);
+      y = static_cast<int> (yoe + era * 400 + (m <= 2));
+    }
+
+  } // namespace
+
+  SunStateEngine::SunStateEngine (const SunStateParams& params) : params_ (params) {
+  }
+
+  SunState SunStateEngine::compute (int year, int month, int day, double localHours) const {
+    SunState s;
+    double rise, set;
+    s.rc = __sunriset__ (year, month, day, params_.lon, params_.lat, params_.altitude.altit,
+                         params_.altitude.upperLimb, &rise, &set);
+
+    double utc = params_.utcOffsetMinutes / 60.0;
+    s.rise = normalize (rise + utc);
+    s.set = normalize (set + utc);
+    s.lightAt = normalize (s.rise + params_.riseOffsetMinutes / 60.0);
+    s.darkAt = normalize (s.set + params_.setOffsetMinutes / 60.0);
+    s.isDay = isDayAt (s, localHours);
+    return s;
+  }
+
+  bool SunStateEngine::isDayAt (const SunState& state, double localHours) {
+    if (state.rc > 0)
+      return true; // midnight sun
+    if (state.rc < 0)
+      return false; // polar night
+    if (state.lightAt <= state.darkAt)
+      return state.lightAt <= localHours && localHours < state.darkAt;
+    // the light window wraps over local midnight (large UTC or user offsets)
+    return localHours >= state.lightAt || localHours < state.darkAt;
+  }
+
+  void SunStateEngine::localDay (std::chrono::system_clock::time_point t, long& day,
+                                 double& hours) const {
+    // local wall clock as seconds since the epoch, split into day and time of day
+    double local = std::chrono::duration<double> (t.time_since_epoch ()).count ()
+                   + params_.utcOffsetMinutes * 60.0;
+    day = static_cast<long> (std::floor (local / 86400.0));
+    hours = (local - day * 86400.0) / 3600.0;
+  }
+
+  SunState SunStateEngine::stateAt (std::chrono::system_clock::time_point t) const {
+    long day;
+    double hours;
+    localDay (t, day, hours);
+    int y, m, d;
+    civilFromDays (day, y, m, d);
+    return compute (y, m, d, hours);
+  }
+
+  std::chrono::system_clock::time_point
+  SunStateEngine::nextMidnight (std::chrono::system_clock::time_point t) const {
+    using namespace std::chrono;
+    long day;
+    double hours;
+    localDay (t, day, hours);
+    return system_clock::time_point (seconds ((day + 1) * 86400L - params_.utcOffsetMinutes * 60L));
+  }
+
+  SunTransition SunStateEngine::nextTransition (std::chrono::system_clock::time_point now,
+                                                int searchDays) const {
+    using namespace std::chrono;
+    long today;
+    double nowHours;
+    localDay (now, today, nowHours);
+
+    auto stateOf = [this] (long day, double hours) {
+      int y, m, d;
+      civilFromDays (day, y, m, d);
+      return compute (y, m, d, hours);
+    };
+    auto instant = [&] (long day, double hours) {
+      double seconds = day * 86400.0 + hours * 3600.0 - params_.utcOffsetMinutes * 60.0;
+      return system_clock::time_point (
+          duration_cast<system_clock::duration> (duration<double> (seconds)));
+    };
+
+    bool isDay = stateOf (today, nowHours).isDay;
+    for (long day = today; day <= today + searchDays; ++day) {
+      SunState s = stateOf (day, 0.0);
+      // a new date can start in the other state, e.g. the first day of a polar night or
+      // a date whose darkAt already passed at 00:00
+      if (day > today && s.isDay != isDay)
+        return { true, s.isDay, instant (day, 0.0) };
+      if (s.rc != 0)
+        continue; // polar day/night, no trigger on this date
+      // the triggers in the order of the day, later than now on the first day
+      double first = std::min (s.lightAt, s.darkAt), second = std::max (s.lightAt, s.darkAt);
+      for (double hours : { first, second }) {
+        if (day == today && hours <= nowHours)
+          continue;
+        if (isDayAt (s, hours) != isDay)
+          return { true, !isDay, instant (day, hours) };
+      }
+    }
+    return { false, !isDay, now };
+  }
+
+} // namespace dotname
@@ -0,0 +1,159 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/SunTimeline.hpp>
+#include <SunrisetWorker/SunrisetBatch.hpp>
+#include "SunState/SunClock.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace dotname {
+
+  using namespace sunclock;
+
+  namespace {
+
+    bool earlier (const SunPlanEntry& a, const SunPlanEntry& b) {
+      return a.at < b.at || (a.at == b.at && a.action < b.action);
+    }
+
+    bool same (const SunPlanEntry& a, const SunPlanEntry& b) {
+      return a.at == b.at && a.action == b.action;
+    }
+
+  } // namespace
+
+  SunTimeline::SunTimeline (double lat, double lon, int utcOffsetMinutes,
+                            const std::vector<SunRule>& rules)
+      : lat_ (lat), lon_ (lon), utcOffsetMinutes_ (utcOffsetMinutes), rules_ (rules) {
+    for (const auto& rule : rules_) {
+      auto action = std::find (actions_.begin (), actions_.end (), rule.action);
+      if (action == actions_.end ())
+        action = actions_.insert (actions_.end (), rule.action);
+      ruleAction_.push_back (static_cast<std::uint32_t> (action - actions_.begin ()));
+
+      auto altitude = std::find_if (altitudes_.begin (), altitudes_.end (), [&] (const auto& a) {
+        return a.altit == rule.altitude.altit && a.upperLimb == rule.altitude.upperLimb;
+      });
+      if (altitude == altitudes_.end ())
+        altitude = altitudes_.insert (altitudes_.end (), rule.altitude);
+      ruleAltitude_.push_back (static_cast<std::uint32_t> (altitude - altitudes_.begin ()));
+    }
+    crossings_.resize (altitudes_.size ());
+    plan_.reserve (rules_.size ());
+    scratch_.reserve (rules_.size ());
+  }
+
+  long SunTimeline::localDay (Clock::time_point t) const {
+    return localDayOf (ticks (t), utcOffsetMinutes_);
+  }
+
+  void SunTimeline::build (long localDay, std::vector<SunPlanEntry>& out) {
+    out.clear ();
+    if (altitudes_.empty ())
+      return;
+    // __sunriset__ takes a day number as the day of 2000 Jan
+    sunCrossings (2000, 1, dayNumberOf (localDay), lon_, lat_, altitudes_.data (),
+                  altitudes_.size (), crossings_.data ());
+
+    const double utc = utcOffsetMinutes_ / 60.0;
+    for (std::size_t i = 0; i < rules_.size (); ++i) {
+      const SunCrossing& c = crossings_[ruleAltitude_[i]];
+      if (c.rc != 0)
+        continue; // not crossed on this date
+      double hours = normalize ((rules_[i].rising ? c.rise : c.set) + utc);
+      double seconds = localDay * 86400.0 + hours * 3600.0 - utcOffsetMinutes_ * 60.0
+                       + rules_[i].offsetMinutes * 60.0;
+      auto at = static_cast<std::int64_t> (std::llround (seconds * kTicksPerSecond));
+      out.push_back ({ timePoint (at), ruleAction_[i] });
+    }
+    std::sort (out.begin (), out.end (), earlier);
+    out.erase (std::unique (out.begin (), out.end (), same), out.end ());
+  }
+
+  const std::vector<SunPlanEntry>& SunTimeline::plan (long localDay) {
+    build (localDay, scratch_);
+    return scratch_;
+  }
+
+  bool SunTimeline::latest (Clock::time_point t, SunPlanEntry& entry) {
+    long day = localDay (t);
+    for (long d = day; d >= day - 1; --d) {
+      build (d, scratch_);
+      auto it = std::upper_bound (scratch_.begin (), scratch_.end (), t,
+                                  [] (Clock::time_point at, const SunPlanEntry& e) {
+                                    return at < e.at;
+                                  });
+      if (it != scratch_.begin ()) {
+        entry = *(it - 1);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // plan_ of localDay, cursor_ at its first entry later than `after`
+  void SunTimeline::position (long localDay, std::int64_t after) {
+    planDay_ = localDay;
+    build (localDay, plan_);
+    cursor_ = static_cast<std::size_t> (
+        std::upper_bound (plan_.begin (), plan_.end (), timePoint (after),
+                          [] (Clock::time_point at, const SunPlanEntry& e) { return at < e.at; })
+        - plan_.begin ());
+  }
+
+  std::size_t SunTimeline::fire (Clock::time_point now, const Callback& onAction) {
+    const std::int64_t t = ticks (now);
+    const long today = localDay (now);
+    if (!started_ || t < last_) {
+      // first call, or the clock went back: nothing is due before now
+      started_ = true;
+      last_ = t;
+      position (today, t);
+      return 0;
+    }
+    if (today > planDay_ + 1) {
+      // suspended over a whole date: only where the timeline stands now matters
+      last_ = t;
+      position (today, t);
+      SunPlanEntry entry;
+      if (!latest (now, entry))
+        return 0;
+      onAction (entry);
+      return 1;
+    }
+
+    std::size_t fired = 0;
+    std::int64_t after = last_;
+    for (;;) {
+      for (; cursor_ < plan_.size () && ticks (plan_[cursor_].at) <= t; ++cursor_, ++fired) {
+        after = ticks (plan_[cursor_].at);
+        onAction (plan_[cursor_]);
+      }
+      if (cursor_ < plan_.size () || ticks (nextAt ()) > t)
+        break;
+      position (planDay_ + 1, after);
+    }
+    last_ = t;
+    return fired;
+  }
+
+  Clock::time_point SunTimeline::nextAt () const {
+    if (cursor_ < plan_.size ())
+      return plan_[cursor_].at;
+    // midnight that starts the date after planDay_
+    return timePoint (midnightOf (planDay_ + 1, utcOffsetMinutes_));
+  }
+
+  void SunTimeline::run (const Callback& onAction) {
+    runTimer (
+        m_, wake_, stop_, [this] { return nextAt (); },
+        [&] { fire (Clock::now (), onAction); });
+  }
+
+  void SunTimeline::stop () {
+    stopTimer (m_, wake_, stop_);
+  }
+
+} // namespace dotname
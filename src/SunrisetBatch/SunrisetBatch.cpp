@@ -0,0 +1,101 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/SunrisetBatch.hpp>
+#include "SunrisetBatchIsa.hpp"
+
+extern "C" {
+#include "SunrisetC/sunriset.h"
+}
+
+namespace dotname {
+
+  namespace {
+
+    SimdIsa detectOnce () {
+#ifdef SUNRISET_BATCH_X86
+      __builtin_cpu_init ();
+      if (__builtin_cpu_supports ("avx512f"))
+        return SimdIsa::Avx512;
+      if (__builtin_cpu_supports ("avx2") && __builtin_cpu_supports ("fma"))
+        return SimdIsa::Avx2;
+      if (__builtin_cpu_supports ("sse2"))
+        return SimdIsa::Sse2;
+#endif
+      return SimdIsa::Scalar;
+    }
+
+    // Reference path, plain __sunriset__ per point
+    template <typename T> void sunrisetScalar (const batch::BatchArgs<T>& a) {
+      for (std::size_t i = 0; i < a.count; ++i) {
+        double rise, set;
+        // days_since_2000_Jan_0 (2000, 1, n) == n, the day number passes straight through
+        a.rc[i] = __sunriset__ (2000, 1, a.days[i], a.lon[i], a.lat[i], a.altit, a.upperLimb,
+                                &rise, &set);
+        a.rise[i] = static_cast<T> (rise);
+        a.set[i] = static_cast<T> (set);
+      }
+    }
+
+    template <typename T> void dispatch (const batch::BatchArgs<T>& args, SimdIsa isa) {
+      SimdIsa best = detectSimdIsa ();
+      if (isa > best)
+        isa = best;
+
+      switch (isa) {
+#ifdef SUNRISET_BATCH_X86
+      case SimdIsa::Avx512:
+        batch::sunrisetAvx512 (args);
+        break;
+      case SimdIsa::Avx2:
+        batch::sunrisetAvx2 (args);
+        break;
+      case SimdIsa::Sse2:
+        batch::sunrisetSse2 (args);
+        break;
+#endif
+      default:
+        sunrisetScalar (args);
+        break;
+      }
+    }
+
+  } // namespace
+
+  SimdIsa detectSimdIsa () {
+    static const SimdIsa isa = detectOnce ();
+    return isa;
+  }
+
+  const char* simdIsaName (SimdIsa isa) {
+    switch (isa) {
+    case SimdIsa::Sse2:
+      return "SSE2";
+    case SimdIsa::Avx2:
+      return "AVX2";
+    case SimdIsa::Avx512:
+      return "AVX-512";
+    default:
+      return "Scalar";
+    }
+  }
+
+  int dayNumber (int year, int month, int day) {
+    return static_cast<int> (days_since_2000_Jan_0 (year, month, day));
+  }
+
+  void sunrisetBatch (const int* days, const double* lat, const double* lon, std::size_t count,
+                      double altit, int upperLimb, double* rise, double* set, int* rc,
+                      SimdIsa isa) {
+    dispatch (batch::BatchArgs<double>{ days, lat, lon, count, altit, upperLimb, rise, set, rc },
+              isa);
+  }
+
+  void sunrisetBatch (const int* days, const float* lat, const float* lon, std::size_t count,
+                      double altit, int upperLimb, float* rise, float* set, int* rc,
+                      SimdIsa isa) {
+    dispatch (batch::BatchArgs<float>{ days, lat, lon, count, altit, upperLimb, rise, set, rc },
+              isa);
+  }
+
+} // namespace dotname
@@ -0,0 +1,197 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include "SunrisetBatchIsa.hpp"
+
+#ifdef SUNRISET_BATCH_X86
+
+  #include <cstddef>
+  #include <cstdint>
+  #include <immintrin.h>
+
+  #if defined(__clang__)
+    #pragma clang attribute push(__attribute__ ((target ("avx2,fma"))), apply_to = function)
+  #else
+    #pragma GCC push_options
+    #pragma GCC target("avx2,fma")
+  #endif
+
+  #include "SunrisetBatchKernel.hpp"
+
+namespace dotname::batch {
+  namespace {
+
+    struct VecD {
+      using T = double;
+      static constexpr std::size_t width = 4;
+      struct M {
+        __m256d m;
+        unsigned bits () const {
+          return static_cast<unsigned> (_mm256_movemask_pd (m));
+        }
+        M operator| (M o) const {
+          return { _mm256_or_pd (m, o.m) };
+        }
+      };
+      __m256d v;
+
+      static VecD broadcast (double x) {
+        return { _mm256_set1_pd (x) };
+      }
+      static VecD load (const double* p) {
+        return { _mm256_loadu_pd (p) };
+      }
+      static VecD loadDays (const int* p) {
+        return { _mm256_cvtepi32_pd (_mm_loadu_si128 (reinterpret_cast<const __m128i*> (p))) };
+      }
+      void store (double* p) const {
+        _mm256_storeu_pd (p, v);
+      }
+    };
+
+    inline VecD operator+ (VecD a, VecD b) {
+      return { _mm256_add_pd (a.v, b.v) };
+    }
+    inline VecD operator- (VecD a, VecD b) {
+      return { _mm256_sub_pd (a.v, b.v) };
+    }
+    inline VecD operator* (VecD a, VecD b) {
+      return { _mm256_mul_pd (a.v, b.v) };
+    }
+    inline VecD operator/ (VecD a, VecD b) {
+      return { _mm256_div_pd (a.v, b.v) };
+    }
+    inline VecD operator- (VecD a) {
+      return { _mm256_xor_pd (a.v, _mm256_set1_pd (-0.0)) };
+    }
+    inline VecD::M operator== (VecD a, VecD b) {
+      return { _mm256_cmp_pd (a.v, b.v, _CMP_EQ_OQ) };
+    }
+    inline VecD::M operator< (VecD a, VecD b) {
+      return { _mm256_cmp_pd (a.v, b.v, _CMP_LT_OQ) };
+    }
+    inline VecD::M operator> (VecD a, VecD b) {
+      return { _mm256_cmp_pd (a.v, b.v, _CMP_GT_OQ) };
+    }
+    inline VecD::M operator<= (VecD a, VecD b) {
+      return { _mm256_cmp_pd (a.v, b.v, _CMP_LE_OQ) };
+    }
+    inline VecD::M operator>= (VecD a, VecD b) {
+      return { _mm256_cmp_pd (a.v, b.v, _CMP_GE_OQ) };
+    }
+    inline VecD vsqrt (VecD a) {
+      return { _mm256_sqrt_pd (a.v) };
+    }
+    inline VecD vabs (VecD a) {
+      return { _mm256_andnot_pd (_mm256_set1_pd (-0.0), a.v) };
+    }
+    inline VecD vmin (VecD a, VecD b) {
+      return { _mm256_min_pd (a.v, b.v) };
+    }
+    inline VecD vmax (VecD a, VecD b) {
+      return { _mm256_max_pd (a.v, b.v) };
+    }
+    inline VecD vselect (VecD::M m, VecD a, VecD b) {
+      return { _mm256_blendv_pd (b.v, a.v, m.m) };
+    }
+    inline VecD vfloor (VecD a) {
+      return { _mm256_floor_pd (a.v) };
+    }
+
+    struct VecF {
+      using T = float;
+      static constexpr std::size_t width = 8;
+      struct M {
+        __m256 m;
+        unsigned bits () const {
+          return static_cast<unsigned> (_mm256_movemask_ps (m));
+        }
+        M operator| (M o) const {
+          return { _mm256_or_ps (m, o.m) };
+        }
+      };
+      __m256 v;
+
+      static VecF broadcast (double x) {
+        return { _mm256_set1_ps (static_cast<float> (x)) };
+      }
+      static VecF load (const float* p) {
+        return { _mm256_loadu_ps (p) };
+      }
+      static VecF loadDays (const int* p) {
+        __m256i d = _mm256_loadu_si256 (reinterpret_cast<const __m256i*> (p));
+        return { _mm256_cvtepi32_ps (d) };
+      }
+      void store (float* p) const {
+        _mm256_storeu_ps (p, v);
+      }
+    };
+
+    inline VecF operator+ (VecF a, VecF b) {
+      return { _mm256_add_ps (a.v, b.v) };
+    }
+    inline VecF operator- (VecF a, VecF b) {
+      return { _mm256_sub_ps (a.v, b.v) };
+    }
+    inline VecF operator* (VecF a, VecF b) {
+      return { _mm256_mul_ps (a.v, b.v) };
+    }
+    inline VecF operator/ (VecF a, VecF b) {
+      return { _mm256_div_ps (a.v, b.v) };
+    }
+    inline VecF operator- (VecF a) {
+      return { _mm256_xor_ps (a.v, _mm256_set1_ps (-0.0f)) };
+    }
+    inline VecF::M operator== (VecF a, VecF b) {
+      return { _mm256_cmp_ps (a.v, b.v, _CMP_EQ_OQ) };
+    }
+    inline VecF::M operator< (VecF a, VecF b) {
+      return { _mm256_cmp_ps (a.v, b.v, _CMP_LT_OQ) };
+    }
+    inline VecF::M operator> (VecF a, VecF b) {
+      return { _mm256_cmp_ps (a.v, b.v, _CMP_GT_OQ) };
+    }
+    inline VecF::M operator<= (VecF a, VecF b) {
+      return { _mm256_cmp_ps (a.v, b.v, _CMP_LE_OQ) };
+    }
+    inline VecF::M operator>= (VecF a, VecF b) {
+      return { _mm256_cmp_ps (a.v, b.v, _CMP_GE_OQ) };
+    }
+    inline VecF vsqrt (VecF a) {
+      return { _mm256_sqrt_ps (a.v) };
+    }
+    inline VecF vabs (VecF a) {
+      return { _mm256_andnot_ps (_mm256_set1_ps (-0.0f), a.v) };
+    }
+    inline VecF vmin (VecF a, VecF b) {
+      return { _mm256_min_ps (a.v, b.v) };
+    }
+    inline VecF vmax (VecF a, VecF b) {
+      return { _mm256_max_ps (a.v, b.v) };
+    }
+    inline VecF vselect (VecF::M m, VecF a, VecF b) {
+      return { _mm256_blendv_ps (b.v, a.v, m.m) };
+    }
+    inline VecF vfloor (VecF a) {
+      return { _mm256_floor_ps (a.v) };
+    }
+
+  } // namespace
+
+  void sunrisetAvx2 (const BatchArgs<double>& args) {
+    kernel::sunrisetBatch<VecD> (args);
+  }
+
+  void sunrisetAvx2 (const BatchArgs<float>& args) {
+    kernel::sunrisetBatch<VecF> (args);
+  }
+
+} // namespace dotname::batch
+
+  #if defined(__clang__)
+    #pragma clang attribute pop
+  #else
+    #pragma GCC pop_options
+  #endif
+
+#endif // SUNRISET_BATCH_X86
@@ -0,0 +1,204 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include "SunrisetBatchIsa.hpp"
+
+#ifdef SUNRISET_BATCH_X86
+
+  #include <cstddef>
+  #include <cstdint>
+  #include <immintrin.h>
+
+  #if defined(__clang__)
+    #pragma clang attribute push(__attribute__ ((target ("avx512f"))), apply_to = function)
+  #else
+    #pragma GCC push_options
+    #pragma GCC target("avx512f")
+    // GCC 12 warns about _mm512_undefined_* inside its own intrinsics (PR105593)
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wuninitialized"
+    #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+  #endif
+
+  #include "SunrisetBatchKernel.hpp"
+
+namespace dotname::batch {
+  namespace {
+
+    struct VecD {
+      using T = double;
+      static constexpr std::size_t width = 8;
+      struct M {
+        __mmask8 m;
+        unsigned bits () const {
+          return static_cast<unsigned> (m);
+        }
+        M operator| (M o) const {
+          return { static_cast<__mmask8> (m | o.m) };
+        }
+      };
+      __m512d v;
+
+      static VecD broadcast (double x) {
+        return { _mm512_set1_pd (x) };
+      }
+      static VecD load (const double* p) {
+        return { _mm512_loadu_pd (p) };
+      }
+      static VecD loadDays (const int* p) {
+        return { _mm512_cvtepi32_pd (_mm256_loadu_si256 (reinterpret_cast<const __m256i*> (p))) };
+      }
+      void store (double* p) const {
+        _mm512_storeu_pd (p, v);
+      }
+    };
+
+    inline VecD operator+ (VecD a, VecD b) {
+      return { _mm512_add_pd (a.v, b.v) };
+    }
+    inline VecD operator- (VecD a, VecD b) {
+      return { _mm512_sub_pd (a.v, b.v) };
+    }
+    inline VecD operator* (VecD a, VecD b) {
+      return { _mm512_mul_pd (a.v, b.v) };
+    }
+    inline VecD operator/ (VecD a, VecD b) {
+      return { _mm512_div_pd (a.v, b.v) };
+    }
+    // xor_pd needs AVX512DQ, flip the sign through the integer domain instead
+    inline VecD operator- (VecD a) {
+      __m512i sign = _mm512_set1_epi64 (static_cast<long long> (0x8000000000000000ULL));
+      return { _mm512_castsi512_pd (_mm512_xor_si512 (_mm512_castpd_si512 (a.v), sign)) };
+    }
+    inline VecD::M operator== (VecD a, VecD b) {
+      return { _mm512_cmp_pd_mask (a.v, b.v, _CMP_EQ_OQ) };
+    }
+    inline VecD::M operator< (VecD a, VecD b) {
+      return { _mm512_cmp_pd_mask (a.v, b.v, _CMP_LT_OQ) };
+    }
+    inline VecD::M operator> (VecD a, VecD b) {
+      return { _mm512_cmp_pd_mask (a.v, b.v, _CMP_GT_OQ) };
+    }
+    inline VecD::M operator<= (VecD a, VecD b) {
+      return { _mm512_cmp_pd_mask (a.v, b.v, _CMP_LE_OQ) };
+    }
+    inline VecD::M operator>= (VecD a, VecD b) {
+      return { _mm512_cmp_pd_mask (a.v, b.v, _CMP_GE_OQ) };
+    }
+    inline VecD vsqrt (VecD a) {
+      return { _mm512_sqrt_pd (a.v) };
+    }
+    inline VecD vabs (VecD a) {
+      return { _mm512_abs_pd (a.v) };
+    }
+    inline VecD vmin (VecD a, VecD b) {
+      return { _mm512_min_pd (a.v, b.v) };
+    }
+    inline VecD vmax (VecD a, VecD b) {
+      return { _mm512_max_pd (a.v, b.v) };
+    }
+    inline VecD vselect (VecD::M m, VecD a, VecD b) {
+      return { _mm512_mask_blend_pd (m.m, b.v, a.v) };
+    }
+    inline VecD vfloor (VecD a) {
+      return { _mm512_roundscale_pd (a.v, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC) };
+    }
+
+    struct VecF {
+      using T = float;
+      static constexpr std::size_t width = 16;
+      struct M {
+        __mmask16 m;
+        unsigned bits () const {
+          return static_cast<unsigned> (m);
+        }
+        M operator| (M o) const {
+          return { static_cast<__mmask16> (m | o.m) };
+        }
+      };
+      __m512 v;
+
+      static VecF broadcast (double x) {
+        return { _mm512_set1_ps (static_cast<float> (x)) };
+      }
+      static VecF load (const float* p) {
+        return { _mm512_loadu_ps (p) };
+      }
+      static VecF loadDays (const int* p) {
+        return { _mm512_cvtepi32_ps (_mm512_loadu_si512 (p)) };
+      }
+      void store (float* p) const {
+        _mm512_storeu_ps (p, v);
+      }
+    };
+
+    inline VecF operator+ (VecF a, VecF b) {
+      return { _mm512_add_ps (a.v, b.v) };
+    }
+    inline VecF operator- (VecF a, VecF b) {
+      return { _mm512_sub_ps (a.v, b.v) };
+    }
+    inline VecF operator* (VecF a, VecF b) {
+      return { _mm512_mul_ps (a.v, b.v) };
+    }
+    inline VecF operator/ (VecF a, VecF b) {
+      return { _mm512_div_ps (a.v, b.v) };
+    }
+    inline VecF operator- (VecF a) {
+      __m512i sign = _mm512_set1_epi32 (static_cast<int> (0x80000000U));
+      return { _mm512_castsi512_ps (_mm512_xor_si512 (_mm512_castps_si512 (a.v), sign)) };
+    }
+    inline VecF::M operator== (VecF a, VecF b) {
+      return { _mm512_cmp_ps_mask (a.v, b.v, _CMP_EQ_OQ) };
+    }
+    inline VecF::M operator< (VecF a, VecF b) {
+      return { _mm512_cmp_ps_mask (a.v, b.v, _CMP_LT_OQ) };
+    }
+    inline VecF::M operator> (VecF a, VecF b) {
+      return { _mm512_cmp_ps_mask (a.v, b.v, _CMP_GT_OQ) };
+    }
+    inline VecF::M operator<= (VecF a, VecF b) {
+      return { _mm512_cmp_ps_mask (a.v, b.v, _CMP_LE_OQ) };
+    }
+    inline VecF::M operator>= (VecF a, VecF b) {
+      return { _mm512_cmp_ps_mask (a.v, b.v, _CMP_GE_OQ) };
+    }
+    inline VecF vsqrt (VecF a) {
+      return { _mm512_sqrt_ps (a.v) };
+    }
+    inline VecF vabs (VecF a) {
+      return { _mm512_abs_ps (a.v) };
+    }
+    inline VecF vmin (VecF a, VecF b) {
+      return { _mm512_min_ps (a.v, b.v) };
+    }
+    inline VecF vmax (VecF a, VecF b) {
+      return { _mm512_max_ps (a.v, b.v) };
+    }
+    inline VecF vselect (VecF::M m, VecF a, VecF b) {
+      return { _mm512_mask_blend_ps (m.m, b.v, a.v) };
+    }
+    inline VecF vfloor (VecF a) {
+      return { _mm512_roundscale_ps (a.v, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC) };
+    }
+
+  } // namespace
+
+  void sunrisetAvx512 (const BatchArgs<double>& args) {
+    kernel::sunrisetBatch<VecD> (args);
+  }
+
+  void sunrisetAvx512 (const BatchArgs<float>& args) {
+    kernel::sunrisetBatch<VecF> (args);
+  }
+
+} // namespace dotname::batch
+
+  #if defined(__clang__)
+    #pragma clang attribute pop
+  #else
+    #pragma GCC diagnostic pop
+    #pragma GCC pop_options
+  #endif
+
+#endif // SUNRISET_BATCH_X86
@@ -0,0 +1,38 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __SUNRISETBATCHISA_HPP
+#define __SUNRISETBATCHISA_HPP
+
+#include <cstddef>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+  #define SUNRISET_BATCH_X86 1
+#endif
+
+namespace dotname::batch {
+
+  template <typename T> struct BatchArgs {
+    const int* days;
+    const T* lat;
+    const T* lon;
+    std::size_t count;
+    double altit;
+    int upperLimb;
+    T* rise;
+    T* set;
+    int* rc;
+  };
+
+#ifdef SUNRISET_BATCH_X86
+  void sunrisetSse2 (const BatchArgs<double>& args);
+  void sunrisetSse2 (const BatchArgs<float>& args);
+  void sunrisetAvx2 (const BatchArgs<double>& args);
+  void sunrisetAvx2 (const BatchArgs<float>& args);
+  void sunrisetAvx512 (const BatchArgs<double>& args);
+  void sunrisetAvx512 (const BatchArgs<float>& args);
+#endif
+
+} // namespace dotname::batch
+
+#endif // __SUNRISETBATCHISA_HPP
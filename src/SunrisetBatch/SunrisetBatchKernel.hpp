@@ -0,0 +1,202 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __SUNRISETBATCHKERNEL_HPP
+#define __SUNRISETBATCHKERNEL_HPP
+
+// Generic __sunriset__ kernel over a SIMD vector wrapper, included after the target
+// pragma of an ISA translation unit
+
+#include "SunrisetBatchIsa.hpp"
+
+namespace dotname::batch::kernel {
+
+  // Horner scheme: ((acc * x + c) * x + c) ...
+  template <typename V> inline V horner (V, V acc) {
+    return acc;
+  }
+
+  template <typename V, typename... C> inline V horner (V x, V acc, double c, C... rest) {
+    return horner (x, acc * x + V::broadcast (c), rest...);
+  }
+
+  template <typename V> inline V rev360 (V x) {
+    return x - V::broadcast (360.0) * vfloor (x * V::broadcast (1.0 / 360.0));
+  }
+
+  template <typename V> inline V rev180 (V x) {
+    return x - V::broadcast (360.0) * vfloor (x * V::broadcast (1.0 / 360.0) + V::broadcast (0.5));
+  }
+
+  template <typename V> inline void sincosd (V x, V& s, V& c) {
+    using M = typename V::M;
+    V q = vfloor (x * V::broadcast (1.0 / 90.0) + V::broadcast (0.5));
+    V r = (x - q * V::broadcast (90.0)) * V::broadcast (3.14159265358979323846 / 180.0);
+    V z = r * r;
+
+    V ps = horner (z, V::broadcast (1.58962301576546568060E-10), -2.50507477628578072866E-8,
+                   2.75573136213857245213E-6, -1.98412698295895385996E-4,
+                   8.33333333332211858878E-3, -1.66666666666666307295E-1);
+    V pc = horner (z, V::broadcast (-1.13585365213876817300E-11), 2.08757008419747316778E-9,
+                   -2.75573141792967388112E-7, 2.48015872888517045348E-5,
+                   -1.38888888888730564116E-3, 4.16666666666665929218E-2);
+    V sr = r + r * z * ps;
+    V cr = V::broadcast (1.0) - V::broadcast (0.5) * z + z * z * pc;
+
+    // quadrant 0..3
+    V qm = q - V::broadcast (4.0) * vfloor (q * V::broadcast (0.25));
+    M q1 = qm == V::broadcast (1.0);
+    M q2 = qm == V::broadcast (2.0);
+    M q3 = qm == V::broadcast (3.0);
+    M swap = q1 | q3;
+
+    s = vselect (swap, cr, sr);
+    c = vselect (swap, sr, cr);
+    s = vselect (q2 | q3, -s, s);
+    c = vselect (q1 | q2, -c, c);
+  }
+
+  template <typename V> inline V sind (V x) {
+    V s, c;
+    sincosd (x, s, c);
+    return s;
+  }
+
+  // atan for 0 <= t <= 1, radians
+  template <typename V> inline V atanUnit (V t) {
+    using M = typename V::M;
+    M big = t > V::broadcast (0.41421356237309504880); // tan (PI / 8)
+    V u = vselect (big, (t - V::broadcast (1.0)) / (t + V::broadcast (1.0)), t);
+    V z = u * u;
+    V p = horner (z, V::broadcast (-8.750608600031904122785E-1), -1.615753718733365076637E1,
+                  -7.500855792314704667340E1, -1.228866684490136173410E2,
+                  -6.485021904942025371773E1);
+    V q = horner (z, z + V::broadcast (2.485846490142306297962E1), 1.650270098316988542046E2,
+                  4.328810604912902668951E2, 4.853903996359136964868E2,
+                  1.945506571482613964425E2);
+    V a = u + u * z * p / q;
+    return vselect (big, a + V::broadcast (3.14159265358979323846 / 4.0), a);
+  }
+
+  template <typename V> inline V atan2d (V y, V x) {
+    using M = typename V::M;
+    V ax = vabs (x);
+    V ay = vabs (y);
+    V num = vmin (ax, ay);
+    V den = vmax (ax, ay);
+    M zero = den == V::broadcast (0.0);
+    V t = num / vselect (zero, V::broadcast (1.0), den);
+    V a = atanUnit (vselect (zero, V::broadcast (0.0), t));
+    a = vselect (ay > ax, V::broadcast (3.14159265358979323846 / 2.0) - a, a);
+    a = vselect (x < V::broadcast (0.0), V::broadcast (3.14159265358979323846) - a, a);
+    a = vselect (y < V::broadcast (0.0), -a, a);
+    return a * V::broadcast (180.0 / 3.14159265358979323846);
+  }
+
+  template <typename V> inline V acosd (V x) {
+    return atan2d (vsqrt ((V::broadcast (1.0) - x) * (V::broadcast (1.0) + x)), x);
+  }
+
+  // One vector of __sunriset__, see sunriset.c for the meaning of every step
+  template <typename V>
+  inline void sunriset (V days, V lat, V lon, V altit, bool upperLimb, V& trise, V& tset,
+                        typename V::M& below, typename V::M& above) {
+    V d = days + V::broadcast (0.5) - lon * V::broadcast (1.0 / 360.0);
+
+    V gmst0 = rev360 (V::broadcast (180.0 + 356.0470 + 282.9404)
+                      + V::broadcast (0.9856002585 + 4.70935E-5) * d);
+    V sidtime = rev360 (gmst0 + V::broadcast (180.0) + lon);
+
+    // sunpos ()
+    V M = rev360 (V::broadcast (356.0470) + V::broadcast (0.9856002585) * d);
+    V w = V::broadcast (282.9404) + V::broadcast (4.70935E-5) * d;
+    V e = V::broadcast (0.016709) - V::broadcast (1.151E-9) * d;
+    V sM, cM;
+    sincosd (M, sM, cM);
+    V E = M + e * V::broadcast (180.0 / 3.14159265358979323846) * sM
+                  * (V::broadcast (1.0) + e * cM);
+    V sE, cE;
+    sincosd (E, sE, cE);
+    V x = cE - e;
+    V y = vsqrt (V::broadcast (1.0) - e * e) * sE;
+    V r = vsqrt (x * x + y * y);
+    V slon = atan2d (y, x) + w;
+
+    // sun_RA_dec ()
+    V sl, cl;
+    sincosd (slon, sl, cl);
+    V so, co;
+    sincosd (V::broadcast (23.4393) - V::broadcast (3.563E-7) * d, so, co);
+    V xe = r * cl;
+    V ys = r * sl;
+    V ye = ys * co;
+    V ze = ys * so;
+    V sRA = atan2d (ye, xe);
+    V sinDec = ze / r;
+    V cosDec = vsqrt (xe * xe + ye * ye) / r;
+
+    V tsouth = V::broadcast (12.0) - rev180 (sidtime - sRA) * V::broadcast (1.0 / 15.0);
+
+    if (upperLimb)
+      altit = altit - V::broadcast (0.2666) / r;
+
+    V sLat, cLat;
+    sincosd (lat, sLat, cLat);
+    V cost = (sind (altit) - sLat * sinDec) / (cLat * cosDec);
+
+    below = cost >= V::broadcast (1.0);
+    above = cost <= V::broadcast (-1.0);
+    V cc = vmax (vmin (cost, V::broadcast (1.0)), V::broadcast (-1.0));
+    V t = acosd (cc) * V::broadcast (1.0 / 15.0);
+    t = vselect (below, V::broadcast (0.0), t);
+    t = vselect (above, V::broadcast (12.0), t);
+
+    trise = tsouth - t;
+    tset = tsouth + t;
+  }
+
+  template <typename V>
+  inline void sunrisetBlock (const BatchArgs<typename V::T>& a, std::size_t i) {
+    typename V::M below, above;
+    V rise, set;
+    sunriset (V::loadDays (a.days + i), V::load (a.lat + i), V::load (a.lon + i),
+              V::broadcast (a.altit), a.upperLimb != 0, rise, set, below, above);
+    rise.store (a.rise + i);
+    set.store (a.set + i);
+    unsigned b = below.bits ();
+    unsigned ab = above.bits ();
+    for (std::size_t l = 0; l < V::width; ++l)
+      a.rc[i + l] = ((b >> l) & 1u) ? -1 : (((ab >> l) & 1u) ? 1 : 0);
+  }
+
+  template <typename V> void sunrisetBatch (const BatchArgs<typename V::T>& a) {
+    using T = typename V::T;
+    constexpr std::size_t W = V::width;
+    std::size_t i = 0;
+    for (; i + W <= a.count; i += W)
+      sunrisetBlock<V> (a, i);
+
+    // tail goes through the same kernel so every point gets identical math
+    if (i < a.count) {
+      std::size_t n = a.count - i;
+      int days[W] = {};
+      T lat[W] = {}, lon[W] = {}, rise[W], set[W];
+      int rc[W];
+      for (std::size_t l = 0; l < n; ++l) {
+        days[l] = a.days[i + l];
+        lat[l] = a.lat[i + l];
+        lon[l] = a.lon[i + l];
+      }
+      BatchArgs<T> tail{ days, lat, lon, W, a.altit, a.upperLimb, rise, set, rc };
+      sunrisetBlock<V> (tail, 0);
+      for (std::size_t l = 0; l < n; ++l) {
+        a.rise[i + l] = rise[l];
+        a.set[i + l] = set[l];
+        a.rc[i + l] = rc[l];
+      }
+    }
+  }
+
+} // namespace dotname::batch::kernel
+
+#endif // __SUNRISETBATCHKERNEL_HPP
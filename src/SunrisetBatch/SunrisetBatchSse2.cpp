@@ -0,0 +1,199 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include "SunrisetBatchIsa.hpp"
+
+#ifdef SUNRISET_BATCH_X86
+
+  #include <cstddef>
+  #include <cstdint>
+  #include <immintrin.h>
+
+  #if defined(__clang__)
+    #pragma clang attribute push(__attribute__ ((target ("sse2"))), apply_to = function)
+  #else
+    #pragma GCC push_options
+    #pragma GCC target("sse2")
+  #endif
+
+  #include "SunrisetBatchKernel.hpp"
+
+namespace dotname::batch {
+  namespace {
+
+    struct VecD {
+      using T = double;
+      static constexpr std::size_t width = 2;
+      struct M {
+        __m128d m;
+        unsigned bits () const {
+          return static_cast<unsigned> (_mm_movemask_pd (m));
+        }
+        M operator| (M o) const {
+          return { _mm_or_pd (m, o.m) };
+        }
+      };
+      __m128d v;
+
+      static VecD broadcast (double x) {
+        return { _mm_set1_pd (x) };
+      }
+      static VecD load (const double* p) {
+        return { _mm_loadu_pd (p) };
+      }
+      static VecD loadDays (const int* p) {
+        return { _mm_cvtepi32_pd (_mm_loadl_epi64 (reinterpret_cast<const __m128i*> (p))) };
+      }
+      void store (double* p) const {
+        _mm_storeu_pd (p, v);
+      }
+    };
+
+    inline VecD operator+ (VecD a, VecD b) {
+      return { _mm_add_pd (a.v, b.v) };
+    }
+    inline VecD operator- (VecD a, VecD b) {
+      return { _mm_sub_pd (a.v, b.v) };
+    }
+    inline VecD operator* (VecD a, VecD b) {
+      return { _mm_mul_pd (a.v, b.v) };
+    }
+    inline VecD operator/ (VecD a, VecD b) {
+      return { _mm_div_pd (a.v, b.v) };
+    }
+    inline VecD operator- (VecD a) {
+      return { _mm_xor_pd (a.v, _mm_set1_pd (-0.0)) };
+    }
+    inline VecD::M operator== (VecD a, VecD b) {
+      return { _mm_cmpeq_pd (a.v, b.v) };
+    }
+    inline VecD::M operator< (VecD a, VecD b) {
+      return { _mm_cmplt_pd (a.v, b.v) };
+    }
+    inline VecD::M operator> (VecD a, VecD b) {
+      return { _mm_cmpgt_pd (a.v, b.v) };
+    }
+    inline VecD::M operator<= (VecD a, VecD b) {
+      return { _mm_cmple_pd (a.v, b.v) };
+    }
+    inline VecD::M operator>= (VecD a, VecD b) {
+      return { _mm_cmpge_pd (a.v, b.v) };
+    }
+    inline VecD vsqrt (VecD a) {
+      return { _mm_sqrt_pd (a.v) };
+    }
+    inline VecD vabs (VecD a) {
+      return { _mm_andnot_pd (_mm_set1_pd (-0.0), a.v) };
+    }
+    inline VecD vmin (VecD a, VecD b) {
+      return { _mm_min_pd (a.v, b.v) };
+    }
+    inline VecD vmax (VecD a, VecD b) {
+      return { _mm_max_pd (a.v, b.v) };
+    }
+    inline VecD vselect (VecD::M m, VecD a, VecD b) {
+      return { _mm_or_pd (_mm_and_pd (m.m, a.v), _mm_andnot_pd (m.m, b.v)) };
+    }
+    // SSE2 has no roundpd, truncate through int32 and fix up negatives (|x| < 2^31)
+    inline VecD vfloor (VecD a) {
+      __m128d t = _mm_cvtepi32_pd (_mm_cvttpd_epi32 (a.v));
+      return { _mm_sub_pd (t, _mm_and_pd (_mm_cmpgt_pd (t, a.v), _mm_set1_pd (1.0))) };
+    }
+
+    struct VecF {
+      using T = float;
+      static constexpr std::size_t width = 4;
+      struct M {
+        __m128 m;
+        unsigned bits () const {
+          return static_cast<unsigned> (_mm_movemask_ps (m));
+        }
+        M operator| (M o) const {
+          return { _mm_or_ps (m, o.m) };
+        }
+      };
+      __m128 v;
+
+      static VecF broadcast (double x) {
+        return { _mm_set1_ps (static_cast<float> (x)) };
+      }
+      static VecF load (const float* p) {
+        return { _mm_loadu_ps (p) };
+      }
+      static VecF loadDays (const int* p) {
+        return { _mm_cvtepi32_ps (_mm_loadu_si128 (reinterpret_cast<const __m128i*> (p))) };
+      }
+      void store (float* p) const {
+        _mm_storeu_ps (p, v);
+      }
+    };
+
+    inline VecF operator+ (VecF a, VecF b) {
+      return { _mm_add_ps (a.v, b.v) };
+    }
+    inline VecF operator- (VecF a, VecF b) {
+      return { _mm_sub_ps (a.v, b.v) };
+    }
+    inline VecF operator* (VecF a, VecF b) {
+      return { _mm_mul_ps (a.v, b.v) };
+    }
+    inline VecF operator/ (VecF a, VecF b) {
+      return { _mm_div_ps (a.v, b.v) };
+    }
+    inline VecF operator- (VecF a) {
+      return { _mm_xor_ps (a.v, _mm_set1_ps (-0.0f)) };
+    }
+    inline VecF::M operator== (VecF a, VecF b) {
+      return { _mm_cmpeq_ps (a.v, b.v) };
+    }
+    inline VecF::M operator< (VecF a, VecF b) {
+      return { _mm_cmplt_ps (a.v, b.v) };
+    }
+    inline VecF::M operator> (VecF a, VecF b) {
+      return { _mm_cmpgt_ps (a.v, b.v) };
+    }
+    inline VecF::M operator<= (VecF a, VecF b) {
+      return { _mm_cmple_ps (a.v, b.v) };
+    }
+    inline VecF::M operator>= (VecF a, VecF b) {
+      return { _mm_cmpge_ps (a.v, b.v) };
+    }
+    inline VecF vsqrt (VecF a) {
+      return { _mm_sqrt_ps (a.v) };
+    }
+    inline VecF vabs (VecF a) {
+      return { _mm_andnot_ps (_mm_set1_ps (-0.0f), a.v) };
+    }
+    inline VecF vmin (VecF a, VecF b) {
+      return { _mm_min_ps (a.v, b.v) };
+    }
+    inline VecF vmax (VecF a, VecF b) {
+      return { _mm_max_ps (a.v, b.v) };
+    }
+    inline VecF vselect (VecF::M m, VecF a, VecF b) {
+      return { _mm_or_ps (_mm_and_ps (m.m, a.v), _mm_andnot_ps (m.m, b.v)) };
+    }
+    inline VecF vfloor (VecF a) {
+      __m128 t = _mm_cvtepi32_ps (_mm_cvttps_epi32 (a.v));
+      return { _mm_sub_ps (t, _mm_and_ps (_mm_cmpgt_ps (t, a.v), _mm_set1_ps (1.0f))) };
+    }
+
+  } // namespace
+
+  void sunrisetSse2 (const BatchArgs<double>& args) {
+    kernel::sunrisetBatch<VecD> (args);
+  }
+
+  void sunrisetSse2 (const BatchArgs<float>& args) {
+    kernel::sunrisetBatch<VecF> (args);
+  }
+
+} // namespace dotname::batch
+
+  #if defined(__clang__)
+    #pragma clang attribute pop
+  #else
+    #pragma GCC pop_options
+  #endif
+
+#endif // SUNRISET_BATCH_X86
@@ -1,14 +1,19 @@
 // MIT License
 // Copyright (c) 2024-2025 Tomáš Mark
 #include <SunrisetWorker/SunrisetWorker.hpp>
+#include <SunrisetWorker/StartupSnapshot.hpp>
+#include <SunrisetWorker/SunState.hpp>
+#include <SunrisetWorker/TimeZoneIndex.hpp>
+#include <SunrisetWorker/TimeZoneRules.hpp>
 #include <Assets/AssetContext.hpp>
 #include <Logger/Logger.hpp>
+#include <Trace/Trace.hpp>
 #include <Utils/Utils.hpp>
 
-#include <nlohmann/json.hpp>
-
 #include <chrono>
+#include <cstdlib>
 #include <ctime>
+#include <limits>
 
 #if defined(PLATFORM_WEB)
   #include <emscripten/emscripten.h>
@@ -16,6 +21,20 @@
 
 namespace dotname {
 
+  namespace {
+
+    // a zone of the embedded table by name, nullptr when it has none
+    const TimeZoneInfo* embeddedZone (const std::string& name) {
+      for (std::size_t id = 0; id < timeZoneCount (); ++id) {
+        const TimeZoneInfo& zone = timeZoneInfo (static_cast<TimeZoneId> (id));
+        if (name == zone.name)
+          return &zone;
+      }
+      return nullptr;
+    }
+
+  } // namespace
+
   SunrisetWorker::SunrisetWorker () {
     LOG_D_STREAM << libName_ << " constructed ..." << std::endl;
     AssetContext::clearAssetsPath ();
@@ -27,6 +46,7 @@ namespace dotname {
         riseOffsetMinutes_ (params.riseOffsetMinutes.second),
         setOffsetMinutes_ (params.setOffsetMinutes.second), clear_ (params.clear.second),
         params_ (params) {
+    TRACE_SPAN ("SunrisetWorker");
 
     LOG_D_STREAM << libName_ << " constructed ..." << std::endl;
     AssetContext::clearAssetsPath ();
@@ -37,70 +57,11 @@ namespace dotname {
                    << "╰➤ " << AssetContext::getAssetsPath () << std::endl;
       auto logo = std::ifstream (AssetContext::getAssetsPath () / "logo.png");
       configPath_ = (AssetContext::getAssetsPath () / "config.json").string ();
+      config_ = ConfigStore (configPath_);
+      themeState_ = ThemeState (AssetContext::getAssetsPath () / "themestate.json");
+      if (params_.force.second)
+        themeState_.forget ();
 
-      if (loadConfig () == 0) {
-        LOG_I_STREAM << "Config file loaded: " << configPath_ << std::endl;
-      } else {
-        LOG_W_STREAM << "Config file not found or invalid, using default values." << std::endl;
-        // If the config file is not found, we can create a new one with default values
-        lat_ = 0;
-        lon_ = 0;
-        utcOffsetMinutes_ = 0;
-        riseOffsetMinutes_ = 0;
-        setOffsetMinutes_ = 0;
-        saveConfig ();
-      }
-
-      if (params_.lat.first) {
-        if (lat_ > 90.0 || lat_ < -90.0) {
-          LOG_E_STREAM << "Latitude out of range: " << lat_ << std::endl;
-          lat_ = 0.0;
-        }
-        LOG_I_STREAM << "Latitude set to: " << lat_ << std::endl;
-        saveConfig ();
-      }
-
-      if (params_.lon.first) {
-        if (lon_ > 180.0 || lon_ < -180.0) {
-          LOG_E_STREAM << "Longitude out of range: " << lon_ << std::endl;
-          lon_ = 0.0;
-        }
-        LOG_I_STREAM << "Longitude set to: " << lon_ << std::endl;
-        saveConfig ();
-      }
-
-      if (utcOffsetMinutes_ > 720 || utcOffsetMinutes_ < -720) {
-        LOG_E_STREAM << "UTC offset out of range: " << utcOffsetMinutes_ << std::endl;
-        utcOffsetMinutes_ = 0;
-      } else {
-        saveConfig ();
-      }
-
-      if (riseOffsetMinutes_ > 720 || riseOffsetMinutes_ < -720) {
-        LOG_E_STREAM << "Sunrise offset out of range: " << riseOffsetMinutes_ << std::endl;
-        riseOffsetMinutes_ = 0;
-      } else {
-        saveConfig ();
-      }
-
-      if (params_.setOffsetMinutes.first) {
-        if (setOffsetMinutes_ > 720 || setOffsetMinutes_ < -720) {
-          LOG_E_STREAM << "Sunset offset out of range: " << setOffsetMinutes_ << std::endl;
-          setOffsetMinutes_ = 0;
-        }
-        saveConfig ();
-      }
-
-      if (params_.clear.first && params_.clear.second) {
-        lat_ = 0;
-        lon_ = 0;
-        utcOffsetMinutes_ = 0;
-        riseOffsetMinutes_ = 0;
-        setOffsetMinutes_ = 0;
-        saveConfig ();
-      }
-
-      // Print the current settings
       auto now = std::chrono::system_clock::now ();               // Get current time
       auto now_time = std::chrono::system_clock::to_time_t (now); // Convert to time_t
 
@@ -110,45 +71,102 @@ namespace dotname {
       localtime_r (&now_time, &now_tm_); // Convert to local time
 #endif
 
-      year_ = now_tm_.tm_year + 1900;
-      month_ = now_tm_.tm_mon + 1;
-      day_ = now_tm_.tm_mday;
+      auto takeLocalTime = [this] () {
+        year_ = now_tm_.tm_year + 1900;
+        month_ = now_tm_.tm_mon + 1;
+        day_ = now_tm_.tm_mday;
 
-      rise_ = 0.0;
-      set_ = 0.0;
-
-      sun_rise_set (year_, month_, day_, lon_, lat_, &rise_, &set_);
+        // Get current time as a double (hours + minutes/60 + seconds/3600)
+        currentTime_ = now_tm_.tm_hour + now_tm_.tm_min / 60.0 + now_tm_.tm_sec / 3600.0;
+      };
+      takeLocalTime ();
+
+      // a start without settings on the command line reuses the resolved config and
+      // today's schedule while config.json is unchanged
+      const auto snapshotPath = AssetContext::getAssetsPath () / "startup.snap";
+      StartupSnapshot snapshot;
+      bool fromCommandLine = params_.lat.first || params_.lon.first
+                             || params_.utcOffsetMinutes.first || params_.riseOffsetMinutes.first
+                             || params_.setOffsetMinutes.first || params_.clear.first;
+      bool cached = !fromCommandLine
+                    && loadStartupSnapshot (snapshotPath, configPath_, year_, month_, day_,
+                                            snapshot) == 0;
+      if (cached) {
+        lat_ = snapshot.lat;
+        lon_ = snapshot.lon;
+        utcOffsetMinutes_ = snapshot.utcOffsetMinutes;
+        timeZone_ = snapshot.timeZone;
+        // the system's zone may have changed since, another offset drops the schedule below
+        if (snapshot.zoneDerived) {
+          timeZone_ = derivedZone ();
+          zoneDerived_ = true;
+        }
+        riseOffsetMinutes_ = snapshot.riseOffsetMinutes;
+        setOffsetMinutes_ = snapshot.setOffsetMinutes;
+        themeTimeoutMs_ = snapshot.themeTimeoutMs;
+        themeBackendNames_ = snapshot.themeBackends;
+        LOG_D_STREAM << "Startup snapshot loaded: " << snapshotPath << std::endl;
+      } else {
+        resolveConfig ();
+      }
 
-      std::string riseTime = to24Time (rise_);
-      std::string setTime = to24Time (set_);
+      // the zone's offset and wall clock now, daylight saving included; a snapshot taken
+      // under another offset or on another local date has a stale schedule
+      if (!timeZone_.empty ()) {
+        utcOffsetMinutes_ = zoneOffsetMinutes (now);
+        std::time_t local = now_time + utcOffsetMinutes_ * 60;
+#ifdef _WIN32
+        gmtime_s (&now_tm_, &local);
+#else
+        gmtime_r (&local, &now_tm_);
+#endif
+        takeLocalTime ();
+        cached = cached && utcOffsetMinutes_ == snapshot.utcOffsetMinutes
+                 && year_ == snapshot.year && month_ == snapshot.month && day_ == snapshot.day;
+      }
 
-      auto normalizeTime = [] (double t) {
-        while (t < 0)
-          t += 24.0;
-        while (t >= 24)
-          t -= 24.0;
-        return t;
-      };
+      setupThemeBackends ();
 
-      rise_ = normalizeTime (rise_ + utcOffsetMinutes_ / 60.0);
-      set_ = normalizeTime (set_ + utcOffsetMinutes_ / 60.0);
+      SunState state;
+      if (cached) {
+        state = snapshot.state;
+      } else {
+        {
+          TRACE_SPAN ("__sunriset__");
+          state = SunStateEngine (stateParams (now)).compute (year_, month_, day_, currentTime_);
+        }
+        snapshot.lat = lat_;
+        snapshot.lon = lon_;
+        snapshot.utcOffsetMinutes = utcOffsetMinutes_;
+        snapshot.timeZone = timeZone_;
+        snapshot.zoneDerived = zoneDerived_;
+        snapshot.riseOffsetMinutes = riseOffsetMinutes_;
+        snapshot.setOffsetMinutes = setOffsetMinutes_;
+        snapshot.themeTimeoutMs = themeTimeoutMs_;
+        snapshot.themeBackends = themeBackendNames_;
+        snapshot.year = year_;
+        snapshot.month = month_;
+        snapshot.day = day_;
+        snapshot.state = state;
+        saveStartupSnapshot (snapshotPath, configPath_, snapshot);
+      }
+      state.isDay = SunStateEngine::isDayAt (state, currentTime_);
 
-      riseTime = to24Time (rise_);
-      setTime = to24Time (set_);
+      rise_ = state.rise;
+      set_ = state.set;
 
-      // Get current time as a double (hours + minutes/60 + seconds/3600)
-      double cT = now_tm_.tm_hour + now_tm_.tm_min / 60.0 + now_tm_.tm_sec / 3600.0;
-      double riseOffMin = riseOffsetMinutes_ / 60.0;
-      double setOffMin = setOffsetMinutes_ / 60.0;
+      std::string riseTime = to24Time (rise_);
+      std::string setTime = to24Time (set_);
 
-      riseTimeWithOffset_ = to24Time (rise_ + riseOffMin);
-      setTimeWithOffset_ = to24Time (set_ + setOffMin);
+      riseTimeWithOffset_ = to24Time (state.lightAt);
+      setTimeWithOffset_ = to24Time (state.darkAt);
 
       LOG_I_STREAM << "════════════════════ FOLLOW SUN SUMMARY ════════════════════" << std::endl
                    << "📅 " << std::put_time (&now_tm_, "%d.%m.%Y %H:%M:%S") << std::endl
                    << "📍 Location: " << std::fixed << std::setprecision (4) << lat_ << "°N, "
                    << lon_ << "°E" << std::endl
-                   << "🌐 UTC offset: " << utcOffsetMinutes_ / 60 << " hours" << std::endl
+                   << "🌐 UTC offset: " << utcOffsetMinutes_ / 60 << " hours"
+                   << (timeZone_.empty () ? "" : " (" + timeZone_ + ")") << std::endl
                    << std::endl
                    << "🌅 Sunrise: " << riseTime << "  ➔  🌆 Sunset: " << setTime << std::endl
                    << std::endl
@@ -165,93 +183,293 @@ namespace dotname {
                    << std::endl;
 
       // Check if the sun is above or below the horizon
-      if ((rise_) < (set_)) {
-        if ((rise_ + riseOffMin) < cT && cT < (set_ + setOffMin)) {
-          LOG_I_STREAM << "Current time is between sunrise and sunset" << " -> Applying light theme"
-                       << std::endl;
-          switchLightThemeGNome (true);
-          LOG_I_STREAM << "╰➤ Light theme applied" << std::endl;
-        } else {
-          LOG_I_STREAM << "Current time is outside of sunrise and sunset"
-                       << " -> Applying dark theme" << std::endl;
-          switchLightThemeGNome (false);
-          LOG_I_STREAM << "╰➤ Dark theme applied" << std::endl;
-        }
+      if (state.rc > 0) {
+        LOG_I_STREAM << "Sun never sets" << std::endl;
+      } else if (state.rc < 0) {
+        LOG_I_STREAM << "Sun never rises" << std::endl;
+      } else if (state.isDay) {
+        LOG_I_STREAM << "Current time is between sunrise and sunset" << " -> Applying light theme"
+                     << std::endl;
       } else {
-        // If the sun never sets or rises, we need to handle it differently
-        if (rise_ > set_) {
-          // if the sun never sets - polar night
-          LOG_I_STREAM << "Sun never sets" << std::endl;
-          switchLightThemeGNome (true);
-          LOG_I_STREAM << "╰➤ Light theme applied" << std::endl;
-        }
-        // if the sun never rises - polar day
-        else if (rise_ < set_) {
-          LOG_I_STREAM << "Sun never rises" << std::endl;
-          switchLightThemeGNome (false);
-          LOG_I_STREAM << "╰➤ Dark theme applied" << std::endl;
-        }
+        LOG_I_STREAM << "Current time is outside of sunrise and sunset"
+                     << " -> Applying dark theme" << std::endl;
+      }
+      auto skipped = themeStats ().skipped;
+      if (applyTheme (state.isDay)) {
+        LOG_I_STREAM << (state.isDay ? "╰➤ Light theme applied" : "╰➤ Dark theme applied")
+                     << std::endl;
+      } else if (themeStats ().skipped > skipped) {
+        LOG_I_STREAM << "╰➤ Already " << (state.isDay ? "light" : "dark") << ", nothing to do"
+                     << std::endl;
+      } else {
+        LOG_W_STREAM << "╰➤ No theme backend could switch the theme" << std::endl;
+      }
+      LOG_D_STREAM << "Theme switches: " << themeStats ().applied << " applied, "
+                   << themeStats ().skipped << " skipped" << std::endl;
+
+      SunTransition next = nextTransition (now);
+      if (next.found) {
+        auto minutes = std::chrono::duration_cast<std::chrono::minutes> (next.at - now).count ();
+        LOG_I_STREAM << "Next switch to " << (next.toLight ? "light" : "dark") << " theme in "
+                     << minutes / 60 << " h " << minutes % 60 << " min" << std::endl;
       }
     }
   }
 
-  int SunrisetWorker::loadConfig () {
-    std::ifstream configFile (configPath_);
-    if (!configFile.is_open ()) {
-      LOG_E_STREAM << "Failed to open config file: " << configPath_ << std::endl;
-      return -1;
+  SunStateParams SunrisetWorker::stateParams (std::chrono::system_clock::time_point at) const {
+    SunStateParams params;
+    params.lat = lat_;
+    params.lon = lon_;
+    params.utcOffsetMinutes = timeZone_.empty () ? utcOffsetMinutes_ : zoneOffsetMinutes (at);
+    params.riseOffsetMinutes = riseOffsetMinutes_;
+    params.setOffsetMinutes = setOffsetMinutes_;
+    return params;
+  }
+
+  SunTransition SunrisetWorker::nextTransition (std::chrono::system_clock::time_point now) const {
+    return SunStateEngine (stateParams (now)).nextTransition (now);
+  }
+
+  bool SunrisetWorker::applyTheme (bool lightTheme) {
+    TRACE_SPAN ("applyTheme");
+    if (!themeState_.needsSwitch (lightTheme))
+      return false;
+    bool switched = false;
+    const auto timeout = std::chrono::milliseconds (themeTimeoutMs_);
+    for (const auto& result :
+         themeBackends_.apply (lightTheme, timeout, themeState_.pending (lightTheme))) {
+      LOG_D_STREAM << "╰➤ " << result.name << ": "
+                   << (result.rc == 0                       ? "ok"
+                       : result.rc == kThemeBackendTimedOut ? "timed out"
+                                                            : "failed")
+                   << " in " << result.latency.count () / 1000.0 << " ms" << std::endl;
+      themeState_.record (result.name, lightTheme, result.rc == 0);
+      switched = switched || result.rc == 0;
     }
+    // failed backends stay pending, the next run tries them again
+    if (switched)
+      themeState_.applied ();
+    return switched;
+  }
 
-    nlohmann::json configJson;
-    try {
-      configFile >> configJson;
-    } catch (const nlohmann::json::parse_error& e) {
-      LOG_E_STREAM << "Failed to parse config file: " << e.what () << std::endl;
-      return -1;
+  void SunrisetWorker::forgetAppliedTheme () {
+    themeState_.forget ();
+  }
+
+  void SunrisetWorker::resolveConfig () {
+    if (loadConfig () == 0) {
+      LOG_I_STREAM << "Config file loaded: " << configPath_ << std::endl;
+    } else {
+      LOG_W_STREAM << "Config file not found or invalid, using default values." << std::endl;
+      // If the config file is not found, we can create a new one with default values for
+      // what the command line did not set
+      if (!params_.lat.first)
+        lat_ = 0;
+      if (!params_.lon.first)
+        lon_ = 0;
+      if (!params_.utcOffsetMinutes.first) {
+        timeZone_ = derivedZone ();
+        zoneDerived_ = true;
+        utcOffsetMinutes_ = zoneOffsetMinutes (std::chrono::system_clock::now ());
+      }
+      if (!params_.riseOffsetMinutes.first)
+        riseOffsetMinutes_ = 0;
+      if (!params_.setOffsetMinutes.first)
+        setOffsetMinutes_ = 0;
+    }
+
+    if (params_.lat.first) {
+      if (lat_ > 90.0 || lat_ < -90.0) {
+        LOG_E_STREAM << "Latitude out of range: " << lat_ << std::endl;
+        lat_ = 0.0;
+      }
+      LOG_I_STREAM << "Latitude set to: " << lat_ << std::endl;
+    }
+
+    if (params_.lon.first) {
+      if (lon_ > 180.0 || lon_ < -180.0) {
+        LOG_E_STREAM << "Longitude out of range: " << lon_ << std::endl;
+        lon_ = 0.0;
+      }
+      LOG_I_STREAM << "Longitude set to: " << lon_ << std::endl;
+    }
+
+    // zones reach +14:00, only a fixed offset is checked
+    if (timeZone_.empty () && (utcOffsetMinutes_ > 720 || utcOffsetMinutes_ < -720)) {
+      LOG_E_STREAM << "UTC offset out of range: " << utcOffsetMinutes_ << std::endl;
+      utcOffsetMinutes_ = 0;
     }
 
+    if (riseOffsetMinutes_ > 720 || riseOffsetMinutes_ < -720) {
+      LOG_E_STREAM << "Sunrise offset out of range: " << riseOffsetMinutes_ << std::endl;
+      riseOffsetMinutes_ = 0;
+    }
+
+    if (params_.setOffsetMinutes.first) {
+      if (setOffsetMinutes_ > 720 || setOffsetMinutes_ < -720) {
+        LOG_E_STREAM << "Sunset offset out of range: " << setOffsetMinutes_ << std::endl;
+        setOffsetMinutes_ = 0;
+      }
+    }
+
+    if (params_.clear.first && params_.clear.second) {
+      lat_ = 0;
+      lon_ = 0;
+      utcOffsetMinutes_ = 0;
+      timeZone_.clear ();
+      zoneDerived_ = false;
+      riseOffsetMinutes_ = 0;
+      setOffsetMinutes_ = 0;
+    }
+
+    // all of the above in one write, none when nothing changed
+    saveConfig ();
+    LOG_D_STREAM << "Config: " << configStats ().writes << " write(s), "
+                 << configStats ().skipped << " skipped" << std::endl;
+  }
+
+  void SunrisetWorker::setupThemeBackends () {
+    TRACE_SPAN ("setupThemeBackends");
+    themeBackends_ = ThemeBackendRegistry ();
+    for (const auto& name : themeBackendNames_) {
+      if (auto backend = makeThemeBackend (name))
+        themeBackends_.add (std::move (backend));
+      else
+        LOG_W_STREAM << "Unknown theme backend: " << name << std::endl;
+    }
+    std::size_t hooks = themeBackends_.addHooks (AssetContext::getAssetsPath () / "hooks");
+    if (hooks)
+      LOG_D_STREAM << hooks << " theme hook(s) in " << AssetContext::getAssetsPath () / "hooks"
+                   << std::endl;
+    themeState_.setBackends (themeBackends_.names ());
+  }
+
+  int SunrisetWorker::loadConfig () {
+    TRACE_SPAN ("loadConfig");
+    if (config_.load () != 0)
+      return -1;
+
     // load only if not set by params
     if (!params_.lat.first)
-      lat_ = configJson.value ("lat", 50.0755);
+      lat_ = config_.get ("lat", 50.0755);
     if (!params_.lon.first)
-      lon_ = configJson.value ("lon", 14.4378);
-    if (!params_.utcOffsetMinutes.first)
-      utcOffsetMinutes_ = configJson.value ("utcOffsetMinutes", 0);
+      lon_ = config_.get ("lon", 14.4378);
+    if (!params_.utcOffsetMinutes.first) {
+      constexpr int kNoOffset = std::numeric_limits<int>::min ();
+      utcOffsetMinutes_ = config_.get ("utcOffsetMinutes", kNoOffset);
+      timeZone_ = config_.get ("timeZone", std::string ());
+      // derived only when nothing is saved: a saved zone or offset stays, --lat/--lon
+      // included, and so does one a daemon reload finds
+      zoneDerived_ = timeZone_.empty () && utcOffsetMinutes_ == kNoOffset;
+      if (zoneDerived_)
+        timeZone_ = derivedZone ();
+      if (!timeZone_.empty ())
+        utcOffsetMinutes_ = zoneOffsetMinutes (std::chrono::system_clock::now ());
+    } else {
+      timeZone_.clear ();
+      zoneDerived_ = false;
+    }
     if (!params_.riseOffsetMinutes.first)
-      riseOffsetMinutes_ = configJson.value ("riseOffsetMinutes", 0);
+      riseOffsetMinutes_ = config_.get ("riseOffsetMinutes", 0);
     if (!params_.setOffsetMinutes.first)
-      setOffsetMinutes_ = configJson.value ("setOffsetMinutes", 0);
+      setOffsetMinutes_ = config_.get ("setOffsetMinutes", 0);
+    themeBackendNames_ = config_.get ("themeBackends", std::vector<std::string> { "gnome" });
+    themeTimeoutMs_ = config_.get ("themeTimeoutMs", 2000);
 
     return 0;
   }
 
+  std::string SunrisetWorker::derivedZone () const {
+    // the nearest reference location gets border towns wrong, the system knows better
+    std::string zone = systemTimeZone ();
+    if (!zone.empty () && (timeZoneRules (zone) || embeddedZone (zone))) {
+      LOG_D_STREAM << "System time zone: " << zone << std::endl;
+      return zone;
+    }
+    const TimeZoneInfo& guess = timeZoneInfo (timeZoneAt (lat_, lon_));
+    LOG_I_STREAM << "Time zone guessed from " << lat_ << ", " << lon_ << ": " << guess.name
+                 << " (set timeZone in " << configPath_.filename ().string () << " or --utc)"
+                 << std::endl;
+    return guess.name;
+  }
+
+  void SunrisetWorker::systemZoneChanged () {
+    if (!zoneDerived_)
+      return;
+    timeZone_ = derivedZone ();
+    utcOffsetMinutes_ = zoneOffsetMinutes (std::chrono::system_clock::now ());
+    LOG_I_STREAM << "Following the time zone " << timeZone_ << std::endl;
+  }
+
+  int SunrisetWorker::zoneOffsetMinutes (std::chrono::system_clock::time_point at) const {
+    if (const TimeZoneRules* rules = timeZoneRules (timeZone_))
+      return rules->offsetMinutesAt (at);
+    // no tz database or an unknown name: the standard offset from the embedded table
+    if (const TimeZoneInfo* zone = embeddedZone (timeZone_))
+      return zone->standardOffsetMinutes;
+    return timeZoneInfo (timeZoneAt (lat_, lon_)).standardOffsetMinutes;
+  }
+
   int SunrisetWorker::saveConfig () {
-    nlohmann::json configJson;
-
-    // Save Lon Lat
-    configJson["lat"] = lat_;
-    configJson["lon"] = lon_;
-    configJson["utcOffsetMinutes"] = utcOffsetMinutes_;
-    configJson["riseOffsetMinutes"] = riseOffsetMinutes_;
-    configJson["setOffsetMinutes"] = setOffsetMinutes_;
-
-    // Save to file
-    std::ofstream configFile (configPath_);
-    if (!configFile.is_open ()) {
-      LOG_E_STREAM << "Failed to open config file for writing: " << configPath_ << std::endl;
-      return -1;
+    TRACE_SPAN ("saveConfig");
+    config_.set ("lat", lat_);
+    config_.set ("lon", lon_);
+    // a derived zone is derived again on every start; a zone's offset moves with daylight
+    // saving, only a fixed one is stored
+    if (!zoneDerived_) {
+      config_.set ("timeZone", timeZone_);
+      if (timeZone_.empty ())
+        config_.set ("utcOffsetMinutes", utcOffsetMinutes_);
     }
+    config_.set ("riseOffsetMinutes", riseOffsetMinutes_);
+    config_.set ("setOffsetMinutes", setOffsetMinutes_);
+    config_.set ("themeBackends", themeBackendNames_);
+    config_.set ("themeTimeoutMs", themeTimeoutMs_);
+    return config_.commit ();
+  }
 
-    try {
-      configFile << configJson.dump (4); // Pretty print with 4 spaces
-    } catch (const std::exception& e) {
-      LOG_E_STREAM << "Failed to write config file: " << e.what () << std::endl;
+  int SunrisetWorker::reloadConfig () {
+    TRACE_SPAN ("reloadConfig");
+    const SunStateParams previous = stateParams ();
+    const std::vector<std::string> backends = themeBackendNames_;
+    const int timeoutMs = themeTimeoutMs_;
+    const std::string zone = timeZone_;
+    const bool zoneDerived = zoneDerived_;
+
+    bool valid = loadConfig () == 0;
+    if (valid && (lat_ > 90.0 || lat_ < -90.0 || lon_ > 180.0 || lon_ < -180.0
+                  || (timeZone_.empty () && (utcOffsetMinutes_ > 720 || utcOffsetMinutes_ < -720))
+                  || riseOffsetMinutes_ > 720 || riseOffsetMinutes_ < -720
+                  || setOffsetMinutes_ > 720 || setOffsetMinutes_ < -720)) {
+      LOG_E_STREAM << "Config values out of range: " << configPath_ << std::endl;
+      valid = false;
+    }
+    if (!valid) {
+      LOG_W_STREAM << "Keeping the running configuration" << std::endl;
+      lat_ = previous.lat;
+      lon_ = previous.lon;
+      utcOffsetMinutes_ = previous.utcOffsetMinutes;
+      timeZone_ = zone;
+      zoneDerived_ = zoneDerived;
+      riseOffsetMinutes_ = previous.riseOffsetMinutes;
+      setOffsetMinutes_ = previous.setOffsetMinutes;
+      themeBackendNames_ = backends;
+      themeTimeoutMs_ = timeoutMs;
       return -1;
     }
 
+    if (themeBackendNames_ != backends)
+      setupThemeBackends ();
+    LOG_I_STREAM << "Config reloaded: " << std::fixed << std::setprecision (4) << lat_ << "°N, "
+                 << lon_ << "°E, UTC offset " << utcOffsetMinutes_ << " min"
+                 << (timeZone_.empty () ? "" : " (" + timeZone_ + ")") << std::endl;
     return 0;
   }
 
+  std::string SunrisetWorker::to24Time (double time) const {
+    return DotNameUtils::TimeUtils::to24Time (time);
+  }
+
   SunrisetWorker::~SunrisetWorker () {
     LOG_D_STREAM << libName_ << " ... destructed" << std::endl;
   }
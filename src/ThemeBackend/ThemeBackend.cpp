@@ -0,0 +1,177 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/ThemeBackend.hpp>
+#include <Logger/Logger.hpp>
+#include <Trace/Trace.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <thread>
+
+#if !defined(_WIN32)
+  #include <csignal>
+  #include <poll.h>
+  #include <spawn.h>
+  #include <sys/syscall.h>
+  #include <sys/wait.h>
+  #include <unistd.h>
+
+extern char** environ;
+#endif
+
+namespace dotname {
+
+  namespace {
+
+    int remainingMs (ThemeDeadline deadline) {
+      using namespace std::chrono;
+      auto left = duration_cast<milliseconds> (deadline - steady_clock::now ()).count ();
+      return left > 0 ? static_cast<int> (left) : 0;
+    }
+
+#if !defined(_WIN32)
+    // true once the child exited (status filled), false when the deadline passed first
+    bool waitChild (pid_t pid, ThemeDeadline deadline, int& status) {
+  #if defined(SYS_pidfd_open)
+      // a pidfd turns readable on exit, no polling loop
+      int fd = static_cast<int> (::syscall (SYS_pidfd_open, pid, 0));
+      if (fd >= 0) {
+        pollfd p { fd, POLLIN, 0 };
+        int ready;
+        do
+          ready = ::poll (&p, 1, remainingMs (deadline));
+        while (ready < 0 && errno == EINTR);
+        ::close (fd);
+        if (ready <= 0)
+          return false;
+        return ::waitpid (pid, &status, 0) == pid;
+      }
+  #endif
+      // kernels without pidfd
+      auto pause = std::chrono::microseconds (100);
+      for (;;) {
+        pid_t done = ::waitpid (pid, &status, WNOHANG);
+        if (done == pid)
+          return true;
+        if (done < 0 && errno != EINTR)
+          return true; // already reaped, nothing left to wait for
+        if (std::chrono::steady_clock::now () >= deadline)
+          return false;
+        std::this_thread::sleep_for (pause);
+        pause = std::min (pause * 2, std::chrono::microseconds (10000));
+      }
+    }
+#endif
+
+  } // namespace
+
+  CommandBackend::CommandBackend (std::string name, std::vector<Command> light,
+                                  std::vector<Command> dark)
+      : name_ (std::move (name)), light_ (std::move (light)), dark_ (std::move (dark)) {
+  }
+
+  int CommandBackend::apply (bool lightTheme, ThemeDeadline deadline) {
+    for (const auto& command : lightTheme ? light_ : dark_) {
+      int rc = run (command, deadline);
+      if (rc != 0)
+        return rc;
+    }
+    return 0;
+  }
+
+#if !defined(_WIN32)
+  int CommandBackend::run (const Command& command, ThemeDeadline deadline) {
+    if (command.empty ())
+      return -1;
+    TRACE_SPAN ("spawn " + command.front ());
+    std::vector<char*> argv;
+    for (const auto& arg : command)
+      argv.push_back (const_cast<char*> (arg.c_str ()));
+    argv.push_back (nullptr);
+
+    // own process group to kill the whole command on timeout; the daemon blocks
+    // SIGINT / SIGTERM, children get the default mask back
+    posix_spawnattr_t attr;
+    posix_spawnattr_init (&attr);
+    sigset_t none;
+    sigemptyset (&none);
+    posix_spawnattr_setsigmask (&attr, &none);
+    posix_spawnattr_setpgroup (&attr, 0);
+    posix_spawnattr_setflags (&attr, POSIX_SPAWN_SETPGROUP | POSIX_SPAWN_SETSIGMASK);
+    pid_t pid;
+    int err = ::posix_spawnp (&pid, argv[0], nullptr, &attr, argv.data (), environ);
+    posix_spawnattr_destroy (&attr);
+    if (err != 0) {
+      LOG_D_STREAM << command[0] << ": " << std::strerror (err) << std::endl;
+      return -1;
+    }
+
+    int status = 0;
+    if (!waitChild (pid, deadline, status)) {
+      ::kill (-pid, SIGKILL);
+      ::waitpid (pid, &status, 0);
+      return kThemeBackendTimedOut;
+    }
+    return WIFEXITED (status) && WEXITSTATUS (status) == 0 ? 0 : -1;
+  }
+#else
+  int CommandBackend::run (const Command&, ThemeDeadline) {
+    return -1; // no posix_spawn
+  }
+#endif
+
+  int GnomeBackend::apply (bool lightTheme, ThemeDeadline deadline) {
+    std::string scheme = lightTheme ? "default" : "prefer-dark";
+    std::string theme = lightTheme ? "Adwaita" : "Adwaita-dark";
+    if (dconf_.write ({ { "/org/gnome/desktop/interface/color-scheme", scheme },
+                        { "/org/gnome/desktop/interface/gtk-theme", theme } },
+                      remainingMs (deadline))
+        == 0)
+      return 0;
+    LOG_D_STREAM << "dconf: " << dconf_.error () << ", falling back to gsettings" << std::endl;
+    return makeThemeBackend ("gsettings")->apply (lightTheme, deadline);
+  }
+
+  std::unique_ptr<ThemeBackend> makeThemeBackend (const std::string& name) {
+    if (name == "gnome")
+      return std::make_unique<GnomeBackend> ();
+    if (name == "gsettings") {
+      auto gsettings = [] (const char* key, const char* value) {
+        return CommandBackend::Command { "gsettings", "set", "org.gnome.desktop.interface", key,
+                                         value };
+      };
+      return std::make_unique<CommandBackend> (
+          name,
+          std::vector<CommandBackend::Command> { gsettings ("color-scheme", "default"),
+                                                 gsettings ("gtk-theme", "Adwaita") },
+          std::vector<CommandBackend::Command> { gsettings ("color-scheme", "prefer-dark"),
+                                                 gsettings ("gtk-theme", "Adwaita-dark") });
+    }
+    if (name == "kde")
+      return std::make_unique<CommandBackend> (
+          name,
+          std::vector<CommandBackend::Command> { { "plasma-apply-colorscheme", "BreezeLight" } },
+          std::vector<CommandBackend::Command> { { "plasma-apply-colorscheme", "BreezeDark" } });
+    if (name == "xfce") {
+      auto xfconf = [] (const char* theme) {
+        return CommandBackend::Command { "xfconf-query", "-c", "xsettings", "-p",
+                                         "/Net/ThemeName", "-s", theme };
+      };
+      return std::make_unique<CommandBackend> (
+          name, std::vector<CommandBackend::Command> { xfconf ("Adwaita") },
+          std::vector<CommandBackend::Command> { xfconf ("Adwaita-dark") });
+    }
+    return nullptr;
+  }
+
+  std::unique_ptr<ThemeBackend> makeHookBackend (const std::filesystem::path& executable) {
+    std::string path = executable.string ();
+    return std::make_unique<CommandBackend> (
+        "hook:" + executable.filename ().string (),
+        std::vector<CommandBackend::Command> { { path, "light" } },
+        std::vector<CommandBackend::Command> { { path, "dark" } });
+  }
+
+} // namespace dotname
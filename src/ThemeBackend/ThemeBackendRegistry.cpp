@@ -0,0 +1,91 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/ThemeBackend.hpp>
+#include <Logger/Logger.hpp>
+#include <Trace/Trace.hpp>
+
+#include "ThreadPool/WorkStealingPool.hpp"
+
+#include <algorithm>
+
+#if !defined(_WIN32)
+  #include <unistd.h>
+#endif
+
+namespace dotname {
+
+  ThemeBackendRegistry::ThemeBackendRegistry () = default;
+  ThemeBackendRegistry::~ThemeBackendRegistry () = default;
+  ThemeBackendRegistry::ThemeBackendRegistry (ThemeBackendRegistry&&) noexcept = default;
+  ThemeBackendRegistry& ThemeBackendRegistry::operator= (ThemeBackendRegistry&&) noexcept
+      = default;
+
+  void ThemeBackendRegistry::add (std::unique_ptr<ThemeBackend> backend) {
+    if (backend)
+      backends_.push_back (std::move (backend));
+  }
+
+  std::size_t ThemeBackendRegistry::addHooks (const std::filesystem::path& dir) {
+    std::error_code ec;
+    std::vector<std::filesystem::path> hooks;
+    for (const auto& entry : std::filesystem::directory_iterator (dir, ec)) {
+      if (!entry.is_regular_file (ec))
+        continue;
+#if !defined(_WIN32)
+      if (::access (entry.path ().c_str (), X_OK) != 0)
+        continue;
+#endif
+      hooks.push_back (entry.path ());
+    }
+    std::sort (hooks.begin (), hooks.end ());
+    for (const auto& hook : hooks)
+      add (makeHookBackend (hook));
+    return hooks.size ();
+  }
+
+  std::vector<std::string> ThemeBackendRegistry::names () const {
+    std::vector<std::string> names;
+    for (const auto& backend : backends_)
+      names.push_back (backend->name ());
+    return names;
+  }
+
+  std::vector<ThemeBackendResult> ThemeBackendRegistry::apply (bool lightTheme,
+                                                               std::chrono::milliseconds timeout) {
+    return apply (lightTheme, timeout, names ());
+  }
+
+  std::vector<ThemeBackendResult>
+  ThemeBackendRegistry::apply (bool lightTheme, std::chrono::milliseconds timeout,
+                               const std::vector<std::string>& only) {
+    using namespace std::chrono;
+    std::vector<ThemeBackend*> selected;
+    for (const auto& backend : backends_)
+      if (std::find (only.begin (), only.end (), backend->name ()) != only.end ())
+        selected.push_back (backend.get ());
+    std::vector<ThemeBackendResult> results (selected.size ());
+    if (selected.empty ())
+      return results;
+    // every backend on its own worker, the caller included
+    if (!pool_ || pool_->size () != backends_.size ())
+      pool_ = std::make_unique<WorkStealingPool> (static_cast<unsigned> (backends_.size ()));
+
+    const auto start = steady_clock::now ();
+    const ThemeDeadline deadline = start + timeout;
+    pool_->parallelFor (selected.size (), [&] (std::size_t i, unsigned) {
+      ThemeBackendResult& result = results[i];
+      result.name = selected[i]->name ();
+      TRACE_SPAN ("theme backend " + result.name);
+      try {
+        result.rc = selected[i]->apply (lightTheme, deadline);
+      } catch (const std::exception& e) {
+        LOG_E_STREAM << result.name << ": " << e.what () << std::endl;
+        result.rc = -1;
+      }
+      result.latency = duration_cast<microseconds> (steady_clock::now () - start);
+    });
+    return results;
+  }
+
+} // namespace dotname
@@ -0,0 +1,115 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/ThemeState.hpp>
+#include <Logger/Logger.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <fstream>
+
+namespace dotname {
+
+  ThemeState::ThemeState (const std::filesystem::path& file) : file_ (file) {
+    if (!file_.empty ())
+      load ();
+  }
+
+  void ThemeState::setBackends (const std::vector<std::string>& names) {
+    bool same = names.size () == themes_.size ();
+    for (const auto& name : names)
+      same = same && themes_.count (name);
+    if (same)
+      return;
+    themes_.clear ();
+    for (const auto& name : names)
+      themes_[name] = -1;
+  }
+
+  bool ThemeState::needsSwitch (bool lightTheme) {
+    if (pending (lightTheme).empty ()) {
+      ++stats_.skipped; // in memory, a skip writes nothing
+      return false;
+    }
+    return true;
+  }
+
+  std::vector<std::string> ThemeState::pending (bool lightTheme) const {
+    std::vector<std::string> names;
+    for (const auto& [name, theme] : themes_)
+      if (theme != (lightTheme ? 1 : 0))
+        names.push_back (name);
+    return names;
+  }
+
+  void ThemeState::record (const std::string& backend, bool lightTheme, bool ok) {
+    themes_[backend] = ok ? (lightTheme ? 1 : 0) : -1;
+  }
+
+  int ThemeState::applied () {
+    ++stats_.applied;
+    return file_.empty () ? 0 : save ();
+  }
+
+  void ThemeState::forget () {
+    for (auto& entry : themes_)
+      entry.second = -1;
+  }
+
+  int ThemeState::theme (const std::string& backend) const {
+    auto it = themes_.find (backend);
+    return it == themes_.end () ? -1 : it->second;
+  }
+
+  int ThemeState::load () {
+    std::ifstream in (file_);
+    if (!in.is_open ())
+      return -1; // first run
+    try {
+      nlohmann::json json;
+      in >> json;
+      const nlohmann::json themes = json.value ("themes", nlohmann::json::object ());
+      for (const auto& [name, value] : themes.items ()) {
+        std::string theme = value.get<std::string> ();
+        themes_[name] = theme == "light" ? 1 : theme == "dark" ? 0 : -1;
+      }
+      stats_.applied = json.value ("applied", std::uint64_t (0));
+      stats_.skipped = json.value ("skipped", std::uint64_t (0));
+    } catch (const nlohmann::json::exception& e) {
+      LOG_W_STREAM << "Ignoring theme state " << file_ << ": " << e.what () << std::endl;
+      themes_.clear ();
+      stats_ = {};
+      return -1;
+    }
+    return 0;
+  }
+
+  int ThemeState::save () const {
+    nlohmann::json json;
+    json["themes"] = nlohmann::json::object ();
+    for (const auto& [name, theme] : themes_)
+      json["themes"][name] = theme > 0 ? "light" : theme == 0 ? "dark" : "unknown";
+    json["applied"] = stats_.applied;
+    json["skipped"] = stats_.skipped;
+
+    // written beside and renamed over, a crash leaves the old state or the new one
+    std::filesystem::path temp = file_;
+    temp += ".tmp";
+    {
+      std::ofstream out (temp, std::ios::trunc);
+      if (!out.is_open () || !(out << json.dump () << '\n')) {
+        LOG_E_STREAM << "Failed to write theme state: " << temp << std::endl;
+        return -1;
+      }
+    }
+    std::error_code ec;
+    std::filesystem::rename (temp, file_, ec);
+    if (ec) {
+      LOG_E_STREAM << "Failed to write theme state: " << file_ << ": " << ec.message ()
+                   << std::endl;
+      return -1;
+    }
+    return 0;
+  }
+
+} // namespace dotname
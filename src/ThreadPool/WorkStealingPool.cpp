@@ -0,0 +1,145 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include "WorkStealingPool.hpp"
+
+#if !defined(_WIN32)
+  #include <csignal>
+  #include <pthread.h>
+#endif
+
+namespace dotname {
+
+  WorkStealingPool::WorkStealingPool (unsigned threads) {
+    if (threads == 0)
+      threads = std::thread::hardware_concurrency ();
+    if (threads == 0)
+      threads = 1;
+    for (unsigned i = 0; i < threads; ++i)
+      queues_.push_back (std::make_unique<Queue> ());
+#if !defined(_WIN32)
+    // the workers start with every signal blocked, so signals meant for the process (a
+    // daemon's signalfd, the default SIGTERM action) never land on one of them
+    sigset_t all, previous;
+    sigfillset (&all);
+    pthread_sigmask (SIG_SETMASK, &all, &previous);
+#endif
+    for (unsigned i = 1; i < threads; ++i)
+      threads_.emplace_back (&WorkStealingPool::workerLoop, this, i);
+#if !defined(_WIN32)
+    pthread_sigmask (SIG_SETMASK, &previous, nullptr);
+#endif
+  }
+
+  WorkStealingPool::~WorkStealingPool () {
+    {
+      std::lock_guard<std::mutex> lock (m_);
+      stop_ = true;
+    }
+    wake_.notify_all ();
+    for (auto& t : threads_)
+      t.join ();
+  }
+
+  void WorkStealingPool::parallelFor (std::size_t count,
+                                      const std::function<void (std::size_t, unsigned)>& task) {
+    if (count == 0)
+      return;
+
+    std::size_t n = queues_.size ();
+    for (std::size_t w = 0; w < n; ++w) {
+      std::lock_guard<std::mutex> lock (queues_[w]->m);
+      queues_[w]->begin = count * w / n;
+      queues_[w]->end = count * (w + 1) / n;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock (m_);
+      task_ = &task;
+      error_ = nullptr;
+      steals_ = 0;
+      busy_ = static_cast<unsigned> (n);
+      ++generation_;
+    }
+    wake_.notify_all ();
+
+    drain (0);
+
+    std::unique_lock<std::mutex> lock (m_);
+    done_.wait (lock, [this] { return busy_ == 0; });
+    task_ = nullptr;
+    if (error_)
+      std::rethrow_exception (error_);
+  }
+
+  bool WorkStealingPool::pop (unsigned worker, std::size_t& index) {
+    Queue& q = *queues_[worker];
+    std::lock_guard<std::mutex> lock (q.m);
+    if (q.begin >= q.end)
+      return false;
+    index = q.begin++;
+    return true;
+  }
+
+  bool WorkStealingPool::steal (unsigned worker) {
+    std::size_t n = queues_.size ();
+    for (std::size_t k = 1; k < n; ++k) {
+      Queue& victim = *queues_[(worker + k) % n];
+      std::size_t from, to;
+      {
+        std::lock_guard<std::mutex> lock (victim.m);
+        if (victim.begin >= victim.end)
+          continue;
+        std::size_t left = victim.end - victim.begin;
+        // back half, the victim keeps working on the front of its range
+        from = victim.end - (left + 1) / 2;
+        to = victim.end;
+        victim.end = from;
+      }
+      Queue& own = *queues_[worker];
+      std::lock_guard<std::mutex> lock (own.m);
+      own.begin = from;
+      own.end = to;
+      return true;
+    }
+    return false;
+  }
+
+  void WorkStealingPool::drain (unsigned worker) {
+    std::size_t index, stolen = 0;
+    for (;;) {
+      while (pop (worker, index)) {
+        try {
+          (*task_) (index, worker);
+        } catch (...) {
+          std::lock_guard<std::mutex> lock (m_);
+          if (!error_)
+            error_ = std::current_exception ();
+        }
+      }
+      if (!steal (worker))
+        break;
+      ++stolen;
+    }
+
+    std::lock_guard<std::mutex> lock (m_);
+    steals_ += stolen;
+    if (--busy_ == 0)
+      done_.notify_one ();
+  }
+
+  void WorkStealingPool::workerLoop (unsigned worker) {
+    std::uint64_t seen = 0;
+    for (;;) {
+      {
+        std::unique_lock<std::mutex> lock (m_);
+        wake_.wait (lock, [&] { return stop_ || generation_ != seen; });
+        if (stop_)
+          return;
+        seen = generation_;
+      }
+      drain (worker);
+    }
+  }
+
+} // namespace dotname
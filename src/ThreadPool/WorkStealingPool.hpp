@@ -0,0 +1,73 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __WORKSTEALINGPOOL_HPP
+#define __WORKSTEALINGPOOL_HPP
+
+// Fixed size pool for data parallel loops, a worker out of work steals half of another's
+// range; the calling thread is worker 0
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace dotname {
+
+  class WorkStealingPool {
+  public:
+    // threads == 0 -> std::thread::hardware_concurrency ()
+    explicit WorkStealingPool (unsigned threads = 0);
+    ~WorkStealingPool ();
+
+    WorkStealingPool (const WorkStealingPool&) = delete;
+    WorkStealingPool& operator= (const WorkStealingPool&) = delete;
+
+    unsigned size () const {
+      return static_cast<unsigned> (queues_.size ());
+    }
+
+    // Runs task (index, worker) for every index in [0, count) and blocks until all are
+    // done. The first exception thrown by a task is rethrown here. Not reentrant.
+    void parallelFor (std::size_t count,
+                      const std::function<void (std::size_t, unsigned)>& task);
+
+    // steals of the last parallelFor (), for the benchmarks
+    std::size_t steals () const {
+      return steals_;
+    }
+
+  private:
+    struct Queue {
+      std::mutex m;
+      std::size_t begin = 0;
+      std::size_t end = 0;
+    };
+
+    bool pop (unsigned worker, std::size_t& index);
+    bool steal (unsigned worker);
+    void drain (unsigned worker);
+    void workerLoop (unsigned worker);
+
+    std::vector<std::unique_ptr<Queue>> queues_;
+    std::vector<std::thread> threads_;
+
+    std::mutex m_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    const std::function<void (std::size_t, unsigned)>* task_ = nullptr;
+    std::uint64_t generation_ = 0;
+    unsigned busy_ = 0;
+    bool stop_ = false;
+    std::exception_ptr error_;
+    std::size_t steals_ = 0;
+  };
+
+} // namespace dotname
+
+#endif // __WORKSTEALINGPOOL_HPP
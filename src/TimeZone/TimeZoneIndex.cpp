@@ -0,0 +1,212 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/TimeZoneIndex.hpp>
+
+#include "ThreadPool/WorkStealingPool.hpp"
+#include "TimeZoneTable.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace dotname {
+
+  namespace {
+
+    constexpr double kDegRad = 3.14159265358979323846 / 180.0;
+    constexpr double kEarthRadiusKm = 6371.0;
+    // points per task of the batch lookup
+    constexpr std::size_t kBatchBlock = 4096;
+
+    struct Vec {
+      double x, y, z;
+    };
+
+    Vec unit (double lat, double lon) {
+      double cl = std::cos (lat * kDegRad);
+      return { cl * std::cos (lon * kDegRad), cl * std::sin (lon * kDegRad),
+               std::sin (lat * kDegRad) };
+    }
+
+    double dot (const Vec& a, const Vec& b) {
+      return a.x * b.x + a.y * b.y + a.z * b.z;
+    }
+
+    // straight line distance through the sphere of radius 1, monotonic in the great circle
+    // distance and a metric, so the triangle inequality bounds a cell
+    double chord (const Vec& a, const Vec& b) {
+      return std::sqrt (std::max (0.0, 2.0 - 2.0 * dot (a, b)));
+    }
+
+    // the reference location of every zone (location i is zone i), then the extra ones
+    struct Locations {
+      std::vector<Vec> at;
+      std::vector<TimeZoneId> zone;
+
+      Locations () {
+        for (std::size_t i = 0; i < tz::kLocationCount; ++i) {
+          at.push_back (unit (tz::kZones[i].lat, tz::kZones[i].lon));
+          zone.push_back (static_cast<TimeZoneId> (i));
+        }
+        const TimeZoneInfo* first = tz::kZones;
+        const TimeZoneInfo* last = tz::kZones + tz::kLocationCount;
+        for (std::size_t i = 0; i < tz::kExtraLocationCount; ++i) {
+          const tz::TimeZoneLocation& l = tz::kExtraLocations[i];
+          const TimeZoneInfo* z
+              = std::lower_bound (first, last, l.zone, [] (const TimeZoneInfo& a, const char* b) {
+                  return std::strcmp (a.name, b) < 0;
+                });
+          at.push_back (unit (l.lat, l.lon));
+          zone.push_back (static_cast<TimeZoneId> (z - first));
+        }
+      }
+    };
+
+    const Locations& locations () {
+      static const Locations l;
+      return l;
+    }
+
+    const double kMaxAngle = kTimeZoneMaxDistanceKm / kEarthRadiusKm;
+    // a nearer location has a larger dot product
+    const double kMinDot = std::cos (kMaxAngle);
+    const double kMaxChord = 2.0 * std::sin (kMaxAngle / 2.0);
+
+    // zone of the nearest of the locations id (0) .. id (count - 1), ties to the first;
+    // the same comparisons for timeZoneAt () and the index, so both agree on every point
+    template <class Id>
+    TimeZoneId nearest (double lat, double lon, std::size_t count, Id id) {
+      const Vec p = unit (lat, lon);
+      const Locations& loc = locations ();
+      std::size_t best = 0;
+      double bestDot = -2.0;
+      for (std::size_t i = 0; i < count; ++i) {
+        double d = dot (p, loc.at[id (i)]);
+        if (d > bestDot) {
+          bestDot = d;
+          best = id (i);
+        }
+      }
+      return bestDot < kMinDot ? nauticalTimeZone (lon) : loc.zone[best];
+    }
+
+  } // namespace
+
+  std::size_t timeZoneCount () {
+    return tz::kZoneCount;
+  }
+
+  const TimeZoneInfo& timeZoneInfo (TimeZoneId id) {
+    return tz::kZones[id];
+  }
+
+  TimeZoneId nauticalTimeZone (double lon) {
+    long hours = std::lround (lon / 15.0);
+    hours = std::clamp (hours, -12L, 12L);
+    return static_cast<TimeZoneId> (tz::kLocationCount + 12 + hours);
+  }
+
+  TimeZoneId timeZoneAt (double lat, double lon) {
+    return nearest (lat, lon, locations ().at.size (), [] (std::size_t i) { return i; });
+  }
+
+  std::string systemTimeZone () {
+    // "Europe/Prague" out of ":Europe/Prague" or ".../zoneinfo/posix/Europe/Prague"
+    auto zoneName = [] (std::string name) {
+      if (!name.empty () && name[0] == ':')
+        name.erase (0, 1);
+      if (auto at = name.rfind ("zoneinfo/"); at != std::string::npos)
+        name.erase (0, at + 9);
+      for (const char* prefix : { "posix/", "right/" })
+        if (name.rfind (prefix, 0) == 0)
+          name.erase (0, std::strlen (prefix));
+      return name;
+    };
+
+    if (const char* tz = std::getenv ("TZ"); tz && *tz)
+      return zoneName (tz);
+    std::error_code ec;
+    std::string link = std::filesystem::read_symlink ("/etc/localtime", ec).string ();
+    if (!ec && link.find ("zoneinfo/") != std::string::npos)
+      return zoneName (link);
+    std::string name;
+    std::ifstream ("/etc/timezone") >> name;
+    return zoneName (name);
+  }
+
+  TimeZoneIndex::TimeZoneIndex (double cellDegrees, unsigned threads)
+      : cellDegrees_ (cellDegrees),
+        rows_ (static_cast<std::size_t> (std::ceil (180.0 / cellDegrees))),
+        columns_ (static_cast<std::size_t> (std::ceil (360.0 / cellDegrees))) {
+    const std::vector<Vec>& loc = locations ().at;
+    std::vector<std::vector<std::uint16_t>> perCell (cells ());
+
+    WorkStealingPool pool (threads);
+    pool.parallelFor (rows_, [&] (std::size_t row, unsigned) {
+      const double lat0 = -90.0 + static_cast<double> (row) * cellDegrees_;
+      const double lat1 = std::min (90.0, lat0 + cellDegrees_);
+      std::vector<double> chords (loc.size ());
+      for (std::size_t column = 0; column < columns_; ++column) {
+        const double lon0 = -180.0 + static_cast<double> (column) * cellDegrees_;
+        const double lon1 = std::min (180.0, lon0 + cellDegrees_);
+        const Vec centre = unit ((lat0 + lat1) / 2.0, (lon0 + lon1) / 2.0);
+
+        // radius of the cell around its centre: corners and edge midpoints, plus a margin
+        double radius = 0.0;
+        for (double lat : { lat0, (lat0 + lat1) / 2.0, lat1 })
+          for (double lon : { lon0, (lon0 + lon1) / 2.0, lon1 })
+            radius = std::max (radius, chord (centre, unit (lat, lon)));
+        radius = radius * 1.01 + 1e-9;
+
+        double nearestChord = 4.0;
+        for (std::size_t i = 0; i < loc.size (); ++i) {
+          chords[i] = chord (centre, loc[i]);
+          nearestChord = std::min (nearestChord, chords[i]);
+        }
+        // every point of the cell is further than the limit: nautical, no candidates
+        if (nearestChord - radius > kMaxChord)
+          continue;
+        // a location further than nearestChord + 2 radius from the centre is further from
+        // every point of the cell than the nearest location
+        auto& candidates = perCell[row * columns_ + column];
+        for (std::size_t i = 0; i < loc.size (); ++i)
+          if (chords[i] <= nearestChord + 2.0 * radius)
+            candidates.push_back (static_cast<std::uint16_t> (i));
+      }
+    });
+
+    offsets_.reserve (cells () + 1);
+    offsets_.push_back (0);
+    for (const auto& candidates : perCell) {
+      candidates_.insert (candidates_.end (), candidates.begin (), candidates.end ());
+      offsets_.push_back (static_cast<std::uint32_t> (candidates_.size ()));
+    }
+    candidates_.shrink_to_fit ();
+  }
+
+  TimeZoneId TimeZoneIndex::lookup (double lat, double lon) const {
+    auto cell = [this] (double degrees, std::size_t count) {
+      double i = std::floor (degrees / cellDegrees_);
+      return std::min (count - 1, static_cast<std::size_t> (std::max (0.0, i)));
+    };
+    const std::size_t c = cell (lat + 90.0, rows_) * columns_ + cell (lon + 180.0, columns_);
+    const std::uint16_t* ids = candidates_.data () + offsets_[c];
+    return nearest (lat, lon, offsets_[c + 1] - offsets_[c],
+                    [ids] (std::size_t i) { return ids[i]; });
+  }
+
+  void TimeZoneIndex::lookup (const double* lat, const double* lon, std::size_t count,
+                              TimeZoneId* zones, unsigned threads) const {
+    WorkStealingPool pool (threads);
+    pool.parallelFor ((count + kBatchBlock - 1) / kBatchBlock, [&] (std::size_t block, unsigned) {
+      const std::size_t end = std::min (count, (block + 1) * kBatchBlock);
+      for (std::size_t i = block * kBatchBlock; i < end; ++i)
+        zones[i] = lookup (lat[i], lon[i]);
+    });
+  }
+
+} // namespace dotname
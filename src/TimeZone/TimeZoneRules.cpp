@@ -0,0 +1,461 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/TimeZoneRules.hpp>
+#include <Logger/Logger.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace dotname {
+
+  namespace {
+
+    constexpr std::int64_t kNever = std::numeric_limits<std::int64_t>::max ();
+    // dayNumber (1970, 1, 1), days since 2000 Jan 0 of the epoch
+    constexpr long kEpochDayNumber = -10956;
+
+    // days since 1970-01-01 of a proleptic Gregorian date (H. Hinnant's algorithm)
+    long daysFromCivil (long y, int m, int d) {
+      y -= m <= 2;
+      long era = (y >= 0 ? y : y - 399) / 400;
+      long yoe = y - era * 400;
+      long doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+      long doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+      return era * 146097 + doe - 719468;
+    }
+
+    int yearOf (std::int64_t utcSeconds) {
+      long z = static_cast<long> (utcSeconds >= 0 ? utcSeconds / 86400
+                                                  : (utcSeconds - 86399) / 86400);
+      z += 719468;
+      long era = (z >= 0 ? z : z - 146096) / 146097;
+      long doe = z - era * 146097;
+      long yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+      long doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+      long mp = (5 * doy + 2) / 153;
+      return static_cast<int> (yoe + era * 400 + (mp >= 10));
+    }
+
+    bool isLeap (long y) {
+      return (y % 4 == 0 && y % 100 != 0) || y % 400 == 0;
+    }
+
+    int monthLength (long y, int m) {
+      static const int kDays[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+      return m == 2 && isLeap (y) ? 29 : kDays[m - 1];
+    }
+
+    std::int32_t be32 (const unsigned char* p) {
+      return static_cast<std::int32_t> (static_cast<std::uint32_t> (p[0]) << 24
+                                        | static_cast<std::uint32_t> (p[1]) << 16
+                                        | static_cast<std::uint32_t> (p[2]) << 8 | p[3]);
+    }
+
+    std::int64_t be64 (const unsigned char* p) {
+      return static_cast<std::int64_t> (static_cast<std::uint64_t> (
+                                            static_cast<std::uint32_t> (be32 (p)))
+                                            << 32
+                                        | static_cast<std::uint32_t> (be32 (p + 4)));
+    }
+
+    // POSIX TZ string scanner; every step returns false on malformed input
+    struct RuleScanner {
+      const std::string& s;
+      std::size_t at = 0;
+
+      bool done () const {
+        return at == s.size ();
+      }
+      bool accept (char c) {
+        if (at < s.size () && s[at] == c) {
+          ++at;
+          return true;
+        }
+        return false;
+      }
+      bool number (int& value, int max) {
+        std::size_t begin = at;
+        value = 0;
+        while (at < s.size () && s[at] >= '0' && s[at] <= '9' && at - begin < 4)
+          value = value * 10 + (s[at++] - '0');
+        return at > begin && value <= max;
+      }
+      // "CET" or "<+0530>"
+      bool name () {
+        if (accept ('<')) {
+          std::size_t close = s.find ('>', at);
+          if (close == std::string::npos || close - at < 3)
+            return false;
+          at = close + 1;
+          return true;
+        }
+        std::size_t begin = at;
+        while (at < s.size () && ((s[at] >= 'A' && s[at] <= 'Z') || (s[at] >= 'a' && s[at] <= 'z')))
+          ++at;
+        return at - begin >= 3;
+      }
+      // [+-]hh[:mm[:ss]], hours up to 167 for rule times (RFC 8536)
+      bool time (int& seconds, int maxHours) {
+        int sign = accept ('-') ? -1 : (accept ('+'), 1);
+        int h, m = 0, sec = 0;
+        if (!number (h, maxHours))
+          return false;
+        if (accept (':') && (!number (m, 59) || (accept (':') && !number (sec, 59))))
+          return false;
+        seconds = sign * (h * 3600 + m * 60 + sec);
+        return true;
+      }
+    };
+
+  } // namespace
+
+  int TimeZoneRules::load (const std::filesystem::path& file) {
+    std::ifstream in (file, std::ios::binary);
+    if (!in.is_open ()) {
+      LOG_W_STREAM << "Failed to open time zone file: " << file << std::endl;
+      return -1;
+    }
+    std::string data ((std::istreambuf_iterator<char> (in)), std::istreambuf_iterator<char> ());
+    return parse (data, file.string ());
+  }
+
+  int TimeZoneRules::parse (const std::string& data, const std::string& name) {
+    *this = TimeZoneRules ();
+    const auto* p = reinterpret_cast<const unsigned char*> (data.data ());
+    const std::size_t size = data.size ();
+
+    // header: magic, version, 15 reserved bytes, six counts
+    struct Counts {
+      std::size_t isut, isstd, leap, time, type, chars;
+    };
+    auto counts = [&] (std::size_t at, Counts& c) {
+      if (at + 44 > size || std::memcmp (p + at, "TZif", 4) != 0)
+        return false;
+      const unsigned char* n = p + at + 20;
+      c = { std::size_t (be32 (n)),      std::size_t (be32 (n + 4)),  std::size_t (be32 (n + 8)),
+            std::size_t (be32 (n + 12)), std::size_t (be32 (n + 16)), std::size_t (be32 (n + 20)) };
+      return c.type > 0 && c.type <= 256 && c.time <= 100000 && c.chars <= 65536
+             && c.leap <= 100000 && c.isut <= 256 && c.isstd <= 256;
+    };
+    auto blockSize = [] (const Counts& c, std::size_t timeSize) {
+      return c.time * (timeSize + 1) + c.type * 6 + c.chars + c.leap * (timeSize + 4) + c.isstd
+             + c.isut;
+    };
+
+    Counts c;
+    if (!counts (0, c)) {
+      LOG_W_STREAM << "Not a TZif file: " << name << std::endl;
+      return -1;
+    }
+    std::size_t at = 44;
+    std::size_t timeSize = 4;
+    // v2+ repeats the data with 64-bit times after the v1 block, then the POSIX rule
+    if (p[4] >= '2') {
+      at += blockSize (c, 4);
+      if (!counts (at, c)) {
+        LOG_W_STREAM << "Truncated TZif file: " << name << std::endl;
+        return -1;
+      }
+      at += 44;
+      timeSize = 8;
+    }
+    if (at + blockSize (c, timeSize) > size) {
+      LOG_W_STREAM << "Truncated TZif file: " << name << std::endl;
+      return -1;
+    }
+
+    const unsigned char* times = p + at;
+    const unsigned char* indices = times + c.time * timeSize;
+    const unsigned char* types = indices + c.time;
+    auto typeOffset = [&] (std::size_t type) {
+      return be32 (types + type * 6);
+    };
+
+    // type 0 holds before the first transition (RFC 8536)
+    initial_ = typeOffset (0);
+    std::int32_t current = initial_;
+    for (std::size_t i = 0; i < c.time; ++i) {
+      std::int64_t t = timeSize == 8 ? be64 (times + i * 8) : be32 (times + i * 4);
+      std::int64_t previous = i ? (timeSize == 8 ? be64 (times + i * 8 - 8)
+                                                 : be32 (times + i * 4 - 4))
+                                : std::numeric_limits<std::int64_t>::min ();
+      if (indices[i] >= c.type || t <= previous) {
+        LOG_W_STREAM << "Malformed TZif transitions: " << name << std::endl;
+        *this = TimeZoneRules ();
+        return -1;
+      }
+      std::int32_t offset = typeOffset (indices[i]);
+      if (offset == current)
+        continue; // abbreviation or DST flag only
+      at_.push_back (t);
+      offset_.push_back (offset);
+      current = offset;
+    }
+
+    // footer "\n<rule>\n", the rule may be empty
+    at += blockSize (c, timeSize);
+    if (timeSize == 8 && at < size && p[at] == '\n') {
+      std::size_t end = data.find ('\n', at + 1);
+      std::string rule = data.substr (at + 1, end == std::string::npos ? 0 : end - at - 1);
+      if (!rule.empty ()) {
+        PosixRule posix;
+        if (parseRule (rule, posix) != 0) {
+          LOG_W_STREAM << "Ignoring the malformed TZ rule \"" << rule << "\" of " << name
+                       << std::endl;
+        } else {
+          rule_ = rule;
+          posix_ = posix;
+          hasRule_ = true;
+          // no transitions: the rule holds for all time
+          if (c.time == 0)
+            initial_ = posix.stdOffset;
+          expandRule (at_.empty () ? std::numeric_limits<std::int64_t>::min () : at_.back ());
+        }
+      }
+    }
+    return 0;
+  }
+
+  int TimeZoneRules::parsePosix (const std::string& rule) {
+    *this = TimeZoneRules ();
+    PosixRule posix;
+    if (parseRule (rule, posix) != 0) {
+      LOG_W_STREAM << "Malformed TZ rule: \"" << rule << "\"" << std::endl;
+      return -1;
+    }
+    rule_ = rule;
+    posix_ = posix;
+    hasRule_ = true;
+    initial_ = posix.stdOffset;
+    expandRule (std::numeric_limits<std::int64_t>::min ());
+    return 0;
+  }
+
+  int TimeZoneRules::parseRule (const std::string& text, PosixRule& rule) {
+    RuleScanner in { text };
+    int offset;
+    // POSIX offsets count west of Greenwich
+    if (!in.name () || !in.time (offset, 24))
+      return -1;
+    rule = PosixRule ();
+    rule.stdOffset = -offset;
+    if (in.done ())
+      return 0;
+
+    if (!in.name ())
+      return -1;
+    rule.hasDst = true;
+    rule.dstOffset = rule.stdOffset + 3600;
+    if (!in.done () && text[in.at] != ',') {
+      if (!in.time (offset, 24))
+        return -1;
+      rule.dstOffset = -offset;
+    }
+    if (in.done ()) {
+      // no dates, the POSIX default is the US rule
+      rule.start = { 'M', 3, 2, 0, 7200 };
+      rule.end = { 'M', 11, 1, 0, 7200 };
+      return 0;
+    }
+
+    auto date = [&in] (PosixRule::Date& d) {
+      if (!in.accept (','))
+        return false;
+      if (in.accept ('M')) {
+        d.kind = 'M';
+        if (!in.number (d.a, 12) || d.a < 1 || !in.accept ('.') || !in.number (d.b, 5)
+            || d.b < 1 || !in.accept ('.') || !in.number (d.c, 6))
+          return false;
+      } else if (in.accept ('J')) {
+        d.kind = 'J';
+        if (!in.number (d.a, 365) || d.a < 1)
+          return false;
+      } else {
+        d.kind = 'D';
+        if (!in.number (d.a, 365))
+          return false;
+      }
+      d.time = 7200;
+      return !in.accept ('/') || in.time (d.time, 167);
+    };
+    if (!date (rule.start) || !date (rule.end) || !in.done ())
+      return -1;
+    return 0;
+  }
+
+  void TimeZoneRules::ruleInstants (const PosixRule& rule, int year, std::int64_t& start,
+                                    std::int64_t& end) {
+    auto day = [year] (const PosixRule::Date& d) {
+      long jan1 = daysFromCivil (year, 1, 1);
+      if (d.kind == 'J')
+        return jan1 + d.a - 1 + (isLeap (year) && d.a >= 60);
+      if (d.kind == 'D')
+        return jan1 + d.a;
+      // weekday d.c of week d.b, week 5 is the last one of the month
+      long first = daysFromCivil (year, d.a, 1);
+      int weekday = static_cast<int> (((first + 4) % 7 + 7) % 7);
+      int offset = (d.c - weekday + 7) % 7 + (d.b - 1) * 7;
+      while (offset >= monthLength (year, d.a))
+        offset -= 7;
+      return first + offset;
+    };
+    // the start is given in standard time, the end in daylight time
+    start = static_cast<std::int64_t> (day (rule.start)) * 86400 + rule.start.time
+            - rule.stdOffset;
+    end = static_cast<std::int64_t> (day (rule.end)) * 86400 + rule.end.time - rule.dstOffset;
+  }
+
+  int TimeZoneRules::ruleOffsetAt (std::int64_t utcSeconds) const {
+    if (!posix_.hasDst)
+      return posix_.stdOffset;
+    // the latest of the rule's changes at or before t, from this year or the last one
+    int year = yearOf (utcSeconds);
+    std::int64_t best = std::numeric_limits<std::int64_t>::min ();
+    int offset = posix_.stdOffset;
+    for (int y = year - 1; y <= year; ++y) {
+      std::int64_t start, end;
+      ruleInstants (posix_, y, start, end);
+      // on a tie the start wins, a zone in DST all year ends and restarts at one instant
+      if (end <= utcSeconds && end > best) {
+        best = end;
+        offset = posix_.stdOffset;
+      }
+      if (start <= utcSeconds && start >= best) {
+        best = start;
+        offset = posix_.dstOffset;
+      }
+    }
+    return offset;
+  }
+
+  void TimeZoneRules::expandRule (std::int64_t from) {
+    if (!posix_.hasDst) {
+      // the table ends in the rule's standard time, nothing to expand
+      expandedTo_ = kNever;
+      return;
+    }
+    int firstYear = from == std::numeric_limits<std::int64_t>::min () ? 1970 : yearOf (from);
+    struct Change {
+      std::int64_t at;
+      bool start;
+    };
+    std::vector<Change> changes;
+    for (int y = firstYear; y <= kTimeZoneRulesExpandToYear; ++y) {
+      std::int64_t start, end;
+      ruleInstants (posix_, y, start, end);
+      changes.push_back ({ start, true });
+      changes.push_back ({ end, false });
+    }
+    std::sort (changes.begin (), changes.end (), [] (const Change& a, const Change& b) {
+      return a.at != b.at ? a.at < b.at : a.start < b.start;
+    });
+
+    std::int32_t current = offset_.empty () ? initial_ : offset_.back ();
+    for (const auto& change : changes) {
+      if (change.at <= from)
+        continue;
+      std::int32_t offset = change.start ? posix_.dstOffset : posix_.stdOffset;
+      if (offset == current)
+        continue;
+      // an end and a start at one instant: the later one (the start) replaces the first
+      if (!at_.empty () && at_.back () == change.at) {
+        offset_.back () = offset;
+      } else {
+        at_.push_back (change.at);
+        offset_.push_back (offset);
+      }
+      current = offset;
+    }
+    expandedTo_ = daysFromCivil (kTimeZoneRulesExpandToYear + 1, 1, 1) * 86400;
+  }
+
+  long TimeZoneRules::find (std::int64_t t) const {
+    return static_cast<long> (std::upper_bound (at_.begin (), at_.end (), t) - at_.begin ()) - 1;
+  }
+
+  int TimeZoneRules::offsetSecondsAt (std::int64_t utcSeconds) const {
+    if (hasRule_ && utcSeconds >= expandedTo_)
+      return ruleOffsetAt (utcSeconds);
+    long i = find (utcSeconds);
+    return i < 0 ? initial_ : offset_[static_cast<std::size_t> (i)];
+  }
+
+  void TimeZoneRules::offsetsAt (const std::int64_t* utcSeconds, std::size_t count,
+                                 int* offsetSeconds) const {
+    const long n = static_cast<long> (at_.size ());
+    long i = count ? find (utcSeconds[0]) : -1;
+    for (std::size_t k = 0; k < count; ++k) {
+      std::int64_t t = utcSeconds[k];
+      if (hasRule_ && t >= expandedTo_) {
+        offsetSeconds[k] = ruleOffsetAt (t);
+        continue;
+      }
+      // the cursor's interval [at_[i], at_[i + 1]) still holds, or the next one does
+      if ((i >= 0 && t < at_[i]) || (i + 1 < n && t >= at_[i + 1])) {
+        if (i + 2 <= n && t >= at_[i + 1] && (i + 2 == n || t < at_[i + 2]))
+          ++i;
+        else
+          i = find (t);
+      }
+      offsetSeconds[k] = i < 0 ? initial_ : offset_[static_cast<std::size_t> (i)];
+    }
+  }
+
+  void TimeZoneRules::toLocalHours (const int* days, const double* utHours, std::size_t count,
+                                    double* localHours) const {
+    constexpr std::size_t kChunk = 256;
+    std::int64_t instants[kChunk];
+    int offsets[kChunk];
+    for (std::size_t begin = 0; begin < count; begin += kChunk) {
+      std::size_t n = std::min (kChunk, count - begin);
+      for (std::size_t k = 0; k < n; ++k)
+        instants[k] = (static_cast<std::int64_t> (days[begin + k]) - kEpochDayNumber) * 86400
+                      + static_cast<std::int64_t> (std::floor (utHours[begin + k] * 3600.0));
+      offsetsAt (instants, n, offsets);
+      for (std::size_t k = 0; k < n; ++k)
+        localHours[begin + k] = utHours[begin + k] + offsets[k] / 3600.0;
+    }
+  }
+
+  std::filesystem::path zoneinfoDir () {
+    const char* dir = std::getenv ("TZDIR");
+    if (dir && *dir)
+      return dir;
+    return "/usr/share/zoneinfo";
+  }
+
+  const TimeZoneRules* timeZoneRules (const std::string& name) {
+    static std::mutex mutex;
+    static std::map<std::string, std::unique_ptr<TimeZoneRules>> zones;
+
+    std::lock_guard<std::mutex> lock (mutex);
+    auto found = zones.find (name);
+    if (found != zones.end ())
+      return found->second.get ();
+
+    // a zone name, never a path out of the zoneinfo directory
+    std::unique_ptr<TimeZoneRules> rules;
+    std::filesystem::path relative (name);
+    bool valid = !name.empty () && relative.is_relative ()
+                 && std::none_of (relative.begin (), relative.end (),
+                                  [] (const std::filesystem::path& part) { return part == ".."; });
+    if (!valid) {
+      LOG_W_STREAM << "Invalid time zone name: \"" << name << "\"" << std::endl;
+    } else {
+      rules = std::make_unique<TimeZoneRules> ();
+      if (rules->load (zoneinfoDir () / relative) != 0)
+        rules.reset ();
+    }
+    return zones.emplace (name, std::move (rules)).first->second.get ();
+  }
+
+} // namespace dotname
@@ -0,0 +1,604 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include "TimeZoneTable.hpp"
+
+namespace dotname::tz {
+
+  // Generated from tzdata 2025b zone.tab: name, reference location (degrees) and the
+  // smaller of the January / July UTC offsets as the standard offset; the country codes
+  // of zone.tab in the comments. Sorted by name, the ids follow this order.
+  const TimeZoneInfo kZones[] = {
+    { "Africa/Abidjan", 5.3167, -4.0333, 0, false }, // CI
+    { "Africa/Accra", 5.5500, -0.2167, 0, false }, // GH
+    { "Africa/Addis_Ababa", 9.0333, 38.7000, 180, false }, // ET
+    { "Africa/Algiers", 36.7833, 3.0500, 60, false }, // DZ
+    { "Africa/Asmara", 15.3333, 38.8833, 180, false }, // ER
+    { "Africa/Bamako", 12.6500, -8.0000, 0, false }, // ML
+    { "Africa/Bangui", 4.3667, 18.5833, 60, false }, // CF
+    { "Africa/Banjul", 13.4667, -16.6500, 0, false }, // GM
+    { "Africa/Bissau", 11.8500, -15.5833, 0, false }, // GW
+    { "Africa/Blantyre", -15.7833, 35.0000, 120, false }, // MW
+    { "Africa/Brazzaville", -4.2667, 15.2833, 60, false }, // CG
+    { "Africa/Bujumbura", -3.3833, 29.3667, 120, false }, // BI
+    { "Africa/Cairo", 30.0500, 31.2500, 120, false }, // EG
+    { "Africa/Casablanca", 33.6500, -7.5833, 60, false }, // MA
+    { "Africa/Ceuta", 35.8833, -5.3167, 60, false }, // ES
+    { "Africa/Conakry", 9.5167, -13.7167, 0, false }, // GN
+    { "Africa/Dakar", 14.6667, -17.4333, 0, false }, // SN
+    { "Africa/Dar_es_Salaam", -6.8000, 39.2833, 180, false }, // TZ
+    { "Africa/Djibouti", 11.6000, 43.1500, 180, false }, // DJ
+    { "Africa/Douala", 4.0500, 9.7000, 60, false }, // CM
+    { "Africa/El_Aaiun", 27.1500, -13.2000, 60, false }, // EH
+    { "Africa/Freetown", 8.5000, -13.2500, 0, false }, // SL
+    { "Africa/Gaborone", -24.6500, 25.9167, 120, false }, // BW
+    { "Africa/Harare", -17.8333, 31.0500, 120, false }, // ZW
+    { "Africa/Johannesburg", -26.2500, 28.0000, 120, false }, // ZA
+    { "Africa/Juba", 4.8500, 31.6167, 120, false }, // SS
+    { "Africa/Kampala", 0.3167, 32.4167, 180, false }, // UG
+    { "Africa/Khartoum", 15.6000, 32.5333, 120, false }, // SD
+    { "Africa/Kigali", -1.9500, 30.0667, 120, false }, // RW
+    { "Africa/Kinshasa", -4.3000, 15.3000, 60, false }, // CD
+    { "Africa/Lagos", 6.4500, 3.4000, 60, false }, // NG
+    { "Africa/Libreville", 0.3833, 9.4500, 60, false }, // GA
+    { "Africa/Lome", 6.1333, 1.2167, 0, false }, // TG
+    { "Africa/Luanda", -8.8000, 13.2333, 60, false }, // AO
+    { "Africa/Lubumbashi", -11.6667, 27.4667, 120, false }, // CD
+    { "Africa/Lusaka", -15.4167, 28.2833, 120, false }, // ZM
+    { "Africa/Malabo", 3.7500, 8.7833, 60, false }, // GQ
+    { "Africa/Maputo", -25.9667, 32.5833, 120, false }, // MZ
+    { "Africa/Maseru", -29.4667, 27.5000, 120, false }, // LS
+    { "Africa/Mbabane", -26.3000, 31.1000, 120, false }, // SZ
+    { "Africa/Mogadishu", 2.0667, 45.3667, 180, false }, // SO
+    { "Africa/Monrovia", 6.3000, -10.7833, 0, false }, // LR
+    { "Africa/Nairobi", -1.2833, 36.8167, 180, false }, // KE
+    { "Africa/Ndjamena", 12.1167, 15.0500, 60, false }, // TD
+    { "Africa/Niamey", 13.5167, 2.1167, 60, false }, // NE
+    { "Africa/Nouakchott", 18.1000, -15.9500, 0, false }, // MR
+    { "Africa/Ouagadougou", 12.3667, -1.5167, 0, false }, // BF
+    { "Africa/Porto-Novo", 6.4833, 2.6167, 60, false }, // BJ
+    { "Africa/Sao_Tome", 0.3333, 6.7333, 0, false }, // ST
+    { "Africa/Tripoli", 32.9000, 13.1833, 120, false }, // LY
+    { "Africa/Tunis", 36.8000, 10.1833, 60, false }, // TN
+    { "Africa/Windhoek", -22.5667, 17.1000, 120, false }, // NA
+    { "America/Adak", 51.8800, -176.6581, -600, false }, // US
+    { "America/Anchorage", 61.2181, -149.9003, -540, false }, // US
+    { "America/Anguilla", 18.2000, -63.0667, -240, false }, // AI
+    { "America/Antigua", 17.0500, -61.8000, -240, false }, // AG
+    { "America/Araguaina", -7.2000, -48.2000, -180, false }, // BR
+    { "America/Argentina/Buenos_Aires", -34.6000, -58.4500, -180, false }, // AR
+    { "America/Argentina/Catamarca", -28.4667, -65.7833, -180, false }, // AR
+    { "America/Argentina/Cordoba", -31.4000, -64.1833, -180, false }, // AR
+    { "America/Argentina/Jujuy", -24.1833, -65.3000, -180, false }, // AR
+    { "America/Argentina/La_Rioja", -29.4333, -66.8500, -180, false }, // AR
+    { "America/Argentina/Mendoza", -32.8833, -68.8167, -180, false }, // AR
+    { "America/Argentina/Rio_Gallegos", -51.6333, -69.2167, -180, false }, // AR
+    { "America/Argentina/Salta", -24.7833, -65.4167, -180, false }, // AR
+    { "America/Argentina/San_Juan", -31.5333, -68.5167, -180, false }, // AR
+    { "America/Argentina/San_Luis", -33.3167, -66.3500, -180, false }, // AR
+    { "America/Argentina/Tucuman", -26.8167, -65.2167, -180, false }, // AR
+    { "America/Argentina/Ushuaia", -54.8000, -68.3000, -180, false }, // AR
+    { "America/Aruba", 12.5000, -69.9667, -240, false }, // AW
+    { "America/Asuncion", -25.2667, -57.6667, -180, false }, // PY
+    { "America/Atikokan", 48.7586, -91.6217, -300, false }, // CA
+    { "America/Bahia", -12.9833, -38.5167, -180, false }, // BR
+    { "America/Bahia_Banderas", 20.8000, -105.2500, -360, false }, // MX
+    { "America/Barbados", 13.1000, -59.6167, -240, false }, // BB
+    { "America/Belem", -1.4500, -48.4833, -180, false }, // BR
+    { "America/Belize", 17.5000, -88.2000, -360, false }, // BZ
+    { "America/Blanc-Sablon", 51.4167, -57.1167, -240, false }, // CA
+    { "America/Boa_Vista", 2.8167, -60.6667, -240, false }, // BR
+    { "America/Bogota", 4.6000, -74.0833, -300, false }, // CO
+    { "America/Boise", 43.6136, -116.2025, -420, false }, // US
+    { "America/Cambridge_Bay", 69.1139, -105.0528, -420, false }, // CA
+    { "America/Campo_Grande", -20.4500, -54.6167, -240, false }, // BR
+    { "America/Cancun", 21.0833, -86.7667, -300, false }, // MX
+    { "America/Caracas", 10.5000, -66.9333, -240, false }, // VE
+    { "America/Cayenne", 4.9333, -52.3333, -180, false }, // GF
+    { "America/Cayman", 19.3000, -81.3833, -300, false }, // KY
+    { "America/Chicago", 41.8500, -87.6500, -360, false }, // US
+    { "America/Chihuahua", 28.6333, -106.0833, -360, false }, // MX
+    { "America/Ciudad_Juarez", 31.7333, -106.4833, -420, false }, // MX
+    { "America/Costa_Rica", 9.9333, -84.0833, -360, false }, // CR
+    { "America/Coyhaique", -45.5667, -72.0667, -180, false }, // CL
+    { "America/Creston", 49.1000, -116.5167, -420, false }, // CA
+    { "America/Cuiaba", -15.5833, -56.0833, -240, false }, // BR
+    { "America/Curacao", 12.1833, -69.0000, -240, false }, // CW
+    { "America/Danmarkshavn", 76.7667, -18.6667, 0, false }, // GL
+    { "America/Dawson", 64.0667, -139.4167, -420, false }, // CA
+    { "America/Dawson_Creek", 55.7667, -120.2333, -420, false }, // CA
+    { "America/Denver", 39.7392, -104.9842, -420, false }, // US
+    { "America/Detroit", 42.3314, -83.0458, -300, false }, // US
+    { "America/Dominica", 15.3000, -61.4000, -240, false }, // DM
+    { "America/Edmonton", 53.5500, -113.4667, -420, false }, // CA
+    { "America/Eirunepe", -6.6667, -69.8667, -300, false }, // BR
+    { "America/El_Salvador", 13.7000, -89.2000, -360, false }, // SV
+    { "America/Fort_Nelson", 58.8000, -122.7000, -420, false }, // CA
+    { "America/Fortaleza", -3.7167, -38.5000, -180, false }, // BR
+    { "America/Glace_Bay", 46.2000, -59.9500, -240, false }, // CA
+    { "America/Goose_Bay", 53.3333, -60.4167, -240, false }, // CA
+    { "America/Grand_Turk", 21.4667, -71.1333, -300, false }, // TC
+    { "America/Grenada", 12.0500, -61.7500, -240, false }, // GD
+    { "America/Guadeloupe", 16.2333, -61.5333, -240, false }, // GP
+    { "America/Guatemala", 14.6333, -90.5167, -360, false }, // GT
+    { "America/Guayaquil", -2.1667, -79.8333, -300, false }, // EC
+    { "America/Guyana", 6.8000, -58.1667, -240, false }, // GY
+    { "America/Halifax", 44.6500, -63.6000, -240, false }, // CA
+    { "America/Havana", 23.1333, -82.3667, -300, false }, // CU
+    { "America/Hermosillo", 29.0667, -110.9667, -420, false }, // MX
+    { "America/Indiana/Indianapolis", 39.7683, -86.1581, -300, false }, // US
+    { "America/Indiana/Knox", 41.2958, -86.6250, -360, false }, // US
+    { "America/Indiana/Marengo", 38.3756, -86.3447, -300, false }, // US
+    { "America/Indiana/Petersburg", 38.4919, -87.2786, -300, false }, // US
+    { "America/Indiana/Tell_City", 37.9531, -86.7614, -360, false }, // US
+    { "America/Indiana/Vevay", 38.7478, -85.0672, -300, false }, // US
+    { "America/Indiana/Vincennes", 38.6772, -87.5286, -300, false }, // US
+    { "America/Indiana/Winamac", 41.0514, -86.6031, -300, false }, // US
+    { "America/Inuvik", 68.3497, -133.7167, -420, false }, // CA
+    { "America/Iqaluit", 63.7333, -68.4667, -300, false }, // CA
+    { "America/Jamaica", 17.9681, -76.7933, -300, false }, // JM
+    { "America/Juneau", 58.3019, -134.4197, -540, false }, // US
+    { "America/Kentucky/Louisville", 38.2542, -85.7594, -300, false }, // US
+    { "America/Kentucky/Monticello", 36.8297, -84.8492, -300, false }, // US
+    { "America/Kralendijk", 12.1508, -68.2767, -240, false }, // BQ
+    { "America/La_Paz", -16.5000, -68.1500, -240, false }, // BO
+    { "America/Lima", -12.0500, -77.0500, -300, false }, // PE
+    { "America/Los_Angeles", 34.0522, -118.2428, -480, false }, // US
+    { "America/Lower_Princes", 18.0514, -63.0472, -240, false }, // SX
+    { "America/Maceio", -9.6667, -35.7167, -180, false }, // BR
+    { "America/Managua", 12.1500, -86.2833, -360, false }, // NI
+    { "America/Manaus", -3.1333, -60.0167, -240, false }, // BR
+    { "America/Marigot", 18.0667, -63.0833, -240, false }, // MF
+    { "America/Martinique", 14.6000, -61.0833, -240, false }, // MQ
+    { "America/Matamoros", 25.8333, -97.5000, -360, false }, // MX
+    { "America/Mazatlan", 23.2167, -106.4167, -420, false }, // MX
+    { "America/Menominee", 45.1078, -87.6142, -360, false }, // US
+    { "America/Merida", 20.9667, -89.6167, -360, false }, // MX
+    { "America/Metlakatla", 55.1269, -131.5764, -540, false }, // US
+    { "America/Mexico_City", 19.4000, -99.1500, -360, false }, // MX
+    { "America/Miquelon", 47.0500, -56.3333, -180, false }, // PM
+    { "America/Moncton", 46.1000, -64.7833, -240, false }, // CA
+    { "America/Monterrey", 25.6667, -100.3167, -360, false }, // MX
+    { "America/Montevideo", -34.9092, -56.2125, -180, false }, // UY
+    { "America/Montserrat", 16.7167, -62.2167, -240, false }, // MS
+    { "America/Nassau", 25.0833, -77.3500, -300, false }, // BS
+    { "America/New_York", 40.7142, -74.0064, -300, false }, // US
+    { "America/Nome", 64.5011, -165.4064, -540, false }, // US
+    { "America/Noronha", -3.8500, -32.4167, -120, false }, // BR
+    { "America/North_Dakota/Beulah", 47.2642, -101.7778, -360, false }, // US
+    { "America/North_Dakota/Center", 47.1164, -101.2992, -360, false }, // US
+    { "America/North_Dakota/New_Salem", 46.8450, -101.4108, -360, false }, // US
+    { "America/Nuuk", 64.1833, -51.7333, -120, false }, // GL
+    { "America/Ojinaga", 29.5667, -104.4167, -360, false }, // MX
+    { "America/Panama", 8.9667, -79.5333, -300, false }, // PA
+    { "America/Paramaribo", 5.8333, -55.1667, -180, false }, // SR
+    { "America/Phoenix", 33.4483, -112.0733, -420, false }, // US
+    { "America/Port-au-Prince", 18.5333, -72.3333, -300, false }, // HT
+    { "America/Port_of_Spain", 10.6500, -61.5167, -240, false }, // TT
+    { "America/Porto_Velho", -8.7667, -63.9000, -240, false }, // BR
+    { "America/Puerto_Rico", 18.4683, -66.1061, -240, false }, // PR
+    { "America/Punta_Arenas", -53.1500, -70.9167, -180, false }, // CL
+    { "America/Rankin_Inlet", 62.8167, -92.0831, -360, false }, // CA
+    { "America/Recife", -8.0500, -34.9000, -180, false }, // BR
+    { "America/Regina", 50.4000, -104.6500, -360, false }, // CA
+    { "America/Resolute", 74.6956, -94.8292, -360, false }, // CA
+    { "America/Rio_Branco", -9.9667, -67.8000, -300, false }, // BR
+    { "America/Santarem", -2.4333, -54.8667, -180, false }, // BR
+    { "America/Santiago", -33.4500, -70.6667, -240, false }, // CL
+    { "America/Santo_Domingo", 18.4667, -69.9000, -240, false }, // DO
+    { "America/Sao_Paulo", -23.5333, -46.6167, -180, false }, // BR
+    { "America/Scoresbysund", 70.4833, -21.9667, -120, false }, // GL
+    { "America/Sitka", 57.1764, -135.3019, -540, false }, // US
+    { "America/St_Barthelemy", 17.8833, -62.8500, -240, false }, // BL
+    { "America/St_Johns", 47.5667, -52.7167, -210, false }, // CA
+    { "America/St_Kitts", 17.3000, -62.7167, -240, false }, // KN
+    { "America/St_Lucia", 14.0167, -61.0000, -240, false }, // LC
+    { "America/St_Thomas", 18.3500, -64.9333, -240, false }, // VI
+    { "America/St_Vincent", 13.1500, -61.2333, -240, false }, // VC
+    { "America/Swift_Current", 50.2833, -107.8333, -360, false }, // CA
+    { "America/Tegucigalpa", 14.1000, -87.2167, -360, false }, // HN
+    { "America/Thule", 76.5667, -68.7833, -240, false }, // GL
+    { "America/Tijuana", 32.5333, -117.0167, -480, false }, // MX
+    { "America/Toronto", 43.6500, -79.3833, -300, false }, // CA
+    { "America/Tortola", 18.4500, -64.6167, -240, false }, // VG
+    { "America/Vancouver", 49.2667, -123.1167, -480, false }, // CA
+    { "America/Whitehorse", 60.7167, -135.0500, -420, false }, // CA
+    { "America/Winnipeg", 49.8833, -97.1500, -360, false }, // CA
+    { "America/Yakutat", 59.5469, -139.7272, -540, false }, // US
+    { "Antarctica/Casey", -66.2833, 110.5167, 480, false }, // AQ
+    { "Antarctica/Davis", -68.5833, 77.9667, 420, false }, // AQ
+    { "Antarctica/DumontDUrville", -66.6667, 140.0167, 600, false }, // AQ
+    { "Antarctica/Macquarie", -54.5000, 158.9500, 600, false }, // AU
+    { "Antarctica/Mawson", -67.6000, 62.8833, 300, false }, // AQ
+    { "Antarctica/McMurdo", -77.8333, 166.6000, 720, false }, // AQ
+    { "Antarctica/Palmer", -64.8000, -64.1000, -180, false }, // AQ
+    { "Antarctica/Rothera", -67.5667, -68.1333, -180, false }, // AQ
+    { "Antarctica/Syowa", -69.0061, 39.5900, 180, false }, // AQ
+    { "Antarctica/Troll", -72.0114, 2.5350, 0, false }, // AQ
+    { "Antarctica/Vostok", -78.4000, 106.9000, 300, false }, // AQ
+    { "Arctic/Longyearbyen", 78.0000, 16.0000, 60, false }, // SJ
+    { "Asia/Aden", 12.7500, 45.2000, 180, false }, // YE
+    { "Asia/Almaty", 43.2500, 76.9500, 300, false }, // KZ
+    { "Asia/Amman", 31.9500, 35.9333, 180, false }, // JO
+    { "Asia/Anadyr", 64.7500, 177.4833, 720, false }, // RU
+    { "Asia/Aqtau", 44.5167, 50.2667, 300, false }, // KZ
+    { "Asia/Aqtobe", 50.2833, 57.1667, 300, false }, // KZ
+    { "Asia/Ashgabat", 37.9500, 58.3833, 300, false }, // TM
+    { "Asia/Atyrau", 47.1167, 51.9333, 300, false }, // KZ
+    { "Asia/Baghdad", 33.3500, 44.4167, 180, false }, // IQ
+    { "Asia/Bahrain", 26.3833, 50.5833, 180, false }, // BH
+    { "Asia/Baku", 40.3833, 49.8500, 240, false }, // AZ
+    { "Asia/Bangkok", 13.7500, 100.5167, 420, false }, // TH
+    { "Asia/Barnaul", 53.3667, 83.7500, 420, false }, // RU
+    { "Asia/Beirut", 33.8833, 35.5000, 120, false }, // LB
+    { "Asia/Bishkek", 42.9000, 74.6000, 360, false }, // KG
+    { "Asia/Brunei", 4.9333, 114.9167, 480, false }, // BN
+    { "Asia/Chita", 52.0500, 113.4667, 540, false }, // RU
+    { "Asia/Colombo", 6.9333, 79.8500, 330, false }, // LK
+    { "Asia/Damascus", 33.5000, 36.3000, 180, false }, // SY
+    { "Asia/Dhaka", 23.7167, 90.4167, 360, false }, // BD
+    { "Asia/Dili", -8.5500, 125.5833, 540, false }, // TL
+    { "Asia/Dubai", 25.3000, 55.3000, 240, false }, // AE
+    { "Asia/Dushanbe", 38.5833, 68.8000, 300, false }, // TJ
+    { "Asia/Famagusta", 35.1167, 33.9500, 120, false }, // CY
+    { "Asia/Gaza", 31.5000, 34.4667, 120, false }, // PS
+    { "Asia/Hebron", 31.5333, 35.0950, 120, false }, // PS
+    { "Asia/Ho_Chi_Minh", 10.7500, 106.6667, 420, false }, // VN
+    { "Asia/Hong_Kong", 22.2833, 114.1500, 480, false }, // HK
+    { "Asia/Hovd", 48.0167, 91.6500, 420, false }, // MN
+    { "Asia/Irkutsk", 52.2667, 104.3333, 480, false }, // RU
+    { "Asia/Jakarta", -6.1667, 106.8000, 420, false }, // ID
+    { "Asia/Jayapura", -2.5333, 140.7000, 540, false }, // ID
+    { "Asia/Jerusalem", 31.7806, 35.2239, 120, false }, // IL
+    { "Asia/Kabul", 34.5167, 69.2000, 270, false }, // AF
+    { "Asia/Kamchatka", 53.0167, 158.6500, 720, false }, // RU
+    { "Asia/Karachi", 24.8667, 67.0500, 300, false }, // PK
+    { "Asia/Kathmandu", 27.7167, 85.3167, 345, false }, // NP
+    { "Asia/Khandyga", 62.6564, 135.5539, 540, false }, // RU
+    { "Asia/Kolkata", 22.5333, 88.3667, 330, false }, // IN
+    { "Asia/Krasnoyarsk", 56.0167, 92.8333, 420, false }, // RU
+    { "Asia/Kuala_Lumpur", 3.1667, 101.7000, 480, false }, // MY
+    { "Asia/Kuching", 1.5500, 110.3333, 480, false }, // MY
+    { "Asia/Kuwait", 29.3333, 47.9833, 180, false }, // KW
+    { "Asia/Macau", 22.1972, 113.5417, 480, false }, // MO
+    { "Asia/Magadan", 59.5667, 150.8000, 660, false }, // RU
+    { "Asia/Makassar", -5.1167, 119.4000, 480, false }, // ID
+    { "Asia/Manila", 14.5867, 120.9678, 480, false }, // PH
+    { "Asia/Muscat", 23.6000, 58.5833, 240, false }, // OM
+    { "Asia/Nicosia", 35.1667, 33.3667, 120, false }, // CY
+    { "Asia/Novokuznetsk", 53.7500, 87.1167, 420, false }, // RU
+    { "Asia/Novosibirsk", 55.0333, 82.9167, 420, false }, // RU
+    { "Asia/Omsk", 55.0000, 73.4000, 360, false }, // RU
+    { "Asia/Oral", 51.2167, 51.3500, 300, false }, // KZ
+    { "Asia/Phnom_Penh", 11.5500, 104.9167, 420, false }, // KH
+    { "Asia/Pontianak", -0.0333, 109.3333, 420, false }, // ID
+    { "Asia/Pyongyang", 39.0167, 125.7500, 540, false }, // KP
+    { "Asia/Qatar", 25.2833, 51.5333, 180, false }, // QA
+    { "Asia/Qostanay", 53.2000, 63.6167, 300, false }, // KZ
+    { "Asia/Qyzylorda", 44.8000, 65.4667, 300, false }, // KZ
+    { "Asia/Riyadh", 24.6333, 46.7167, 180, false }, // SA
+    { "Asia/Sakhalin", 46.9667, 142.7000, 660, false }, // RU
+    { "Asia/Samarkand", 39.6667, 66.8000, 300, false }, // UZ
+    { "Asia/Seoul", 37.5500, 126.9667, 540, false }, // KR
+    { "Asia/Shanghai", 31.2333, 121.4667, 480, false }, // CN
+    { "Asia/Singapore", 1.2833, 103.8500, 480, false }, // SG
+    { "Asia/Srednekolymsk", 67.4667, 153.7167, 660, false }, // RU
+    { "Asia/Taipei", 25.0500, 121.5000, 480, false }, // TW
+    { "Asia/Tashkent", 41.3333, 69.3000, 300, false }, // UZ
+    { "Asia/Tbilisi", 41.7167, 44.8167, 240, false }, // GE
+    { "Asia/Tehran", 35.6667, 51.4333, 210, false }, // IR
+    { "Asia/Thimphu", 27.4667, 89.6500, 360, false }, // BT
+    { "Asia/Tokyo", 35.6544, 139.7447, 540, false }, // JP
+    { "Asia/Tomsk", 56.5000, 84.9667, 420, false }, // RU
+    { "Asia/Ulaanbaatar", 47.9167, 106.8833, 480, false }, // MN
+    { "Asia/Urumqi", 43.8000, 87.5833, 360, false }, // CN
+    { "Asia/Ust-Nera", 64.5603, 143.2267, 600, false }, // RU
+    { "Asia/Vientiane", 17.9667, 102.6000, 420, false }, // LA
+    { "Asia/Vladivostok", 43.1667, 131.9333, 600, false }, // RU
+    { "Asia/Yakutsk", 62.0000, 129.6667, 540, false }, // RU
+    { "Asia/Yangon", 16.7833, 96.1667, 390, false }, // MM
+    { "Asia/Yekaterinburg", 56.8500, 60.6000, 300, false }, // RU
+    { "Asia/Yerevan", 40.1833, 44.5000, 240, false }, // AM
+    { "Atlantic/Azores", 37.7333, -25.6667, -60, false }, // PT
+    { "Atlantic/Bermuda", 32.2833, -64.7667, -240, false }, // BM
+    { "Atlantic/Canary", 28.1000, -15.4000, 0, false }, // ES
+    { "Atlantic/Cape_Verde", 14.9167, -23.5167, -60, false }, // CV
+    { "Atlantic/Faroe", 62.0167, -6.7667, 0, false }, // FO
+    { "Atlantic/Madeira", 32.6333, -16.9000, 0, false }, // PT
+    { "Atlantic/Reykjavik", 64.1500, -21.8500, 0, false }, // IS
+    { "Atlantic/South_Georgia", -54.2667, -36.5333, -120, false }, // GS
+    { "Atlantic/St_Helena", -15.9167, -5.7000, 0, false }, // SH
+    { "Atlantic/Stanley", -51.7000, -57.8500, -180, false }, // FK
+    { "Australia/Adelaide", -34.9167, 138.5833, 570, false }, // AU
+    { "Australia/Brisbane", -27.4667, 153.0333, 600, false }, // AU
+    { "Australia/Broken_Hill", -31.9500, 141.4500, 570, false }, // AU
+    { "Australia/Darwin", -12.4667, 130.8333, 570, false }, // AU
+    { "Australia/Eucla", -31.7167, 128.8667, 525, false }, // AU
+    { "Australia/Hobart", -42.8833, 147.3167, 600, false }, // AU
+    { "Australia/Lindeman", -20.2667, 149.0000, 600, false }, // AU
+    { "Australia/Lord_Howe", -31.5500, 159.0833, 630, false }, // AU
+    { "Australia/Melbourne", -37.8167, 144.9667, 600, false }, // AU
+    { "Australia/Perth", -31.9500, 115.8500, 480, false }, // AU
+    { "Australia/Sydney", -33.8667, 151.2167, 600, false }, // AU
+    { "Europe/Amsterdam", 52.3667, 4.9000, 60, false }, // NL
+    { "Europe/Andorra", 42.5000, 1.5167, 60, false }, // AD
+    { "Europe/Astrakhan", 46.3500, 48.0500, 240, false }, // RU
+    { "Europe/Athens", 37.9667, 23.7167, 120, false }, // GR
+    { "Europe/Belgrade", 44.8333, 20.5000, 60, false }, // RS
+    { "Europe/Berlin", 52.5000, 13.3667, 60, false }, // DE
+    { "Europe/Bratislava", 48.1500, 17.1167, 60, false }, // SK
+    { "Europe/Brussels", 50.8333, 4.3333, 60, false }, // BE
+    { "Europe/Bucharest", 44.4333, 26.1000, 120, false }, // RO
+    { "Europe/Budapest", 47.5000, 19.0833, 60, false }, // HU
+    { "Europe/Busingen", 47.7000, 8.6833, 60, false }, // DE
+    { "Europe/Chisinau", 47.0000, 28.8333, 120, false }, // MD
+    { "Europe/Copenhagen", 55.6667, 12.5833, 60, false }, // DK
+    { "Europe/Dublin", 53.3333, -6.2500, 0, false }, // IE
+    { "Europe/Gibraltar", 36.1333, -5.3500, 60, false }, // GI
+    { "Europe/Guernsey", 49.4547, -2.5361, 0, false }, // GG
+    { "Europe/Helsinki", 60.1667, 24.9667, 120, false }, // FI
+    { "Europe/Isle_of_Man", 54.1500, -4.4667, 0, false }, // IM
+    { "Europe/Istanbul", 41.0167, 28.9667, 180, false }, // TR
+    { "Europe/Jersey", 49.1836, -2.1067, 0, false }, // JE
+    { "Europe/Kaliningrad", 54.7167, 20.5000, 120, false }, // RU
+    { "Europe/Kirov", 58.6000, 49.6500, 180, false }, // RU
+    { "Europe/Kyiv", 50.4333, 30.5167, 120, false }, // UA
+    { "Europe/Lisbon", 38.7167, -9.1333, 0, false }, // PT
+    { "Europe/Ljubljana", 46.0500, 14.5167, 60, false }, // SI
+    { "Europe/London", 51.5083, -0.1253, 0, false }, // GB
+    { "Europe/Luxembourg", 49.6000, 6.1500, 60, false }, // LU
+    { "Europe/Madrid", 40.4000, -3.6833, 60, false }, // ES
+    { "Europe/Malta", 35.9000, 14.5167, 60, false }, // MT
+    { "Europe/Mariehamn", 60.1000, 19.9500, 120, false }, // AX
+    { "Europe/Minsk", 53.9000, 27.5667, 180, false }, // BY
+    { "Europe/Monaco", 43.7000, 7.3833, 60, false }, // MC
+    { "Europe/Moscow", 55.7558, 37.6178, 180, false }, // RU
+    { "Europe/Oslo", 59.9167, 10.7500, 60, false }, // NO
+    { "Europe/Paris", 48.8667, 2.3333, 60, false }, // FR
+    { "Europe/Podgorica", 42.4333, 19.2667, 60, false }, // ME
+    { "Europe/Prague", 50.0833, 14.4333, 60, false }, // CZ
+    { "Europe/Riga", 56.9500, 24.1000, 120, false }, // LV
+    { "Europe/Rome", 41.9000, 12.4833, 60, false }, // IT
+    { "Europe/Samara", 53.2000, 50.1500, 240, false }, // RU
+    { "Europe/San_Marino", 43.9167, 12.4667, 60, false }, // SM
+    { "Europe/Sarajevo", 43.8667, 18.4167, 60, false }, // BA
+    { "Europe/Saratov", 51.5667, 46.0333, 240, false }, // RU
+    { "Europe/Simferopol", 44.9500, 34.1000, 180, false }, // UA
+    { "Europe/Skopje", 41.9833, 21.4333, 60, false }, // MK
+    { "Europe/Sofia", 42.6833, 23.3167, 120, false }, // BG
+    { "Europe/Stockholm", 59.3333, 18.0500, 60, false }, // SE
+    { "Europe/Tallinn", 59.4167, 24.7500, 120, false }, // EE
+    { "Europe/Tirane", 41.3333, 19.8333, 60, false }, // AL
+    { "Europe/Ulyanovsk", 54.3333, 48.4000, 240, false }, // RU
+    { "Europe/Vaduz", 47.1500, 9.5167, 60, false }, // LI
+    { "Europe/Vatican", 41.9022, 12.4531, 60, false }, // VA
+    { "Europe/Vienna", 48.2167, 16.3333, 60, false }, // AT
+    { "Europe/Vilnius", 54.6833, 25.3167, 120, false }, // LT
+    { "Europe/Volgograd", 48.7333, 44.4167, 180, false }, // RU
+    { "Europe/Warsaw", 52.2500, 21.0000, 60, false }, // PL
+    { "Europe/Zagreb", 45.8000, 15.9667, 60, false }, // HR
+    { "Europe/Zurich", 47.3833, 8.5333, 60, false }, // CH
+    { "Indian/Antananarivo", -18.9167, 47.5167, 180, false }, // MG
+    { "Indian/Chagos", -7.3333, 72.4167, 360, false }, // IO
+    { "Indian/Christmas", -10.4167, 105.7167, 420, false }, // CX
+    { "Indian/Cocos", -12.1667, 96.9167, 390, false }, // CC
+    { "Indian/Comoro", -11.6833, 43.2667, 180, false }, // KM
+    { "Indian/Kerguelen", -49.3528, 70.2175, 300, false }, // TF
+    { "Indian/Mahe", -4.6667, 55.4667, 240, false }, // SC
+    { "Indian/Maldives", 4.1667, 73.5000, 300, false }, // MV
+    { "Indian/Mauritius", -20.1667, 57.5000, 240, false }, // MU
+    { "Indian/Mayotte", -12.7833, 45.2333, 180, false }, // YT
+    { "Indian/Reunion", -20.8667, 55.4667, 240, false }, // RE
+    { "Pacific/Apia", -13.8333, -171.7333, 780, false }, // WS
+    { "Pacific/Auckland", -36.8667, 174.7667, 720, false }, // NZ
+    { "Pacific/Bougainville", -6.2167, 155.5667, 660, false }, // PG
+    { "Pacific/Chatham", -43.9500, -176.5500, 765, false }, // NZ
+    { "Pacific/Chuuk", 7.4167, 151.7833, 600, false }, // FM
+    { "Pacific/Easter", -27.1500, -109.4333, -360, false }, // CL
+    { "Pacific/Efate", -17.6667, 168.4167, 660, false }, // VU
+    { "Pacific/Fakaofo", -9.3667, -171.2333, 780, false }, // TK
+    { "Pacific/Fiji", -18.1333, 178.4167, 720, false }, // FJ
+    { "Pacific/Funafuti", -8.5167, 179.2167, 720, false }, // TV
+    { "Pacific/Galapagos", -0.9000, -89.6000, -360, false }, // EC
+    { "Pacific/Gambier", -23.1333, -134.9500, -540, false }, // PF
+    { "Pacific/Guadalcanal", -9.5333, 160.2000, 660, false }, // SB
+    { "Pacific/Guam", 13.4667, 144.7500, 600, false }, // GU
+    { "Pacific/Honolulu", 21.3069, -157.8583, -600, false }, // US
+    { "Pacific/Kanton", -2.7833, -171.7167, 780, false }, // KI
+    { "Pacific/Kiritimati", 1.8667, -157.3333, 840, false }, // KI
+    { "Pacific/Kosrae", 5.3167, 162.9833, 660, false }, // FM
+    { "Pacific/Kwajalein", 9.0833, 167.3333, 720, false }, // MH
+    { "Pacific/Majuro", 7.1500, 171.2000, 720, false }, // MH
+    { "Pacific/Marquesas", -9.0000, -139.5000, -570, false }, // PF
+    { "Pacific/Midway", 28.2167, -177.3667, -660, false }, // UM
+    { "Pacific/Nauru", -0.5167, 166.9167, 720, false }, // NR
+    { "Pacific/Niue", -19.0167, -169.9167, -660, false }, // NU
+    { "Pacific/Norfolk", -29.0500, 167.9667, 660, false }, // NF
+    { "Pacific/Noumea", -22.2667, 166.4500, 660, false }, // NC
+    { "Pacific/Pago_Pago", -14.2667, -170.7000, -660, false }, // AS
+    { "Pacific/Palau", 7.3333, 134.4833, 540, false }, // PW
+    { "Pacific/Pitcairn", -25.0667, -130.0833, -480, false }, // PN
+    { "Pacific/Pohnpei", 6.9667, 158.2167, 660, false }, // FM
+    { "Pacific/Port_Moresby", -9.5000, 147.1667, 600, false }, // PG
+    { "Pacific/Rarotonga", -21.2333, -159.7667, -600, false }, // CK
+    { "Pacific/Saipan", 15.2000, 145.7500, 600, false }, // MP
+    { "Pacific/Tahiti", -17.5333, -149.5667, -600, false }, // PF
+    { "Pacific/Tarawa", 1.4167, 173.0000, 720, false }, // KI
+    { "Pacific/Tongatapu", -21.1333, -175.2000, 780, false }, // TO
+    { "Pacific/Wake", 19.2833, 166.6167, 720, false }, // UM
+    { "Pacific/Wallis", -13.3000, -176.1667, 720, false }, // WF
+    // nautical zones, POSIX signs: Etc/GMT+12 is UTC-12
+    { "Etc/GMT+12", 0.0, 0.0, -720, true },
+    { "Etc/GMT+11", 0.0, 0.0, -660, true },
+    { "Etc/GMT+10", 0.0, 0.0, -600, true },
+    { "Etc/GMT+9", 0.0, 0.0, -540, true },
+    { "Etc/GMT+8", 0.0, 0.0, -480, true },
+    { "Etc/GMT+7", 0.0, 0.0, -420, true },
+    { "Etc/GMT+6", 0.0, 0.0, -360, true },
+    { "Etc/GMT+5", 0.0, 0.0, -300, true },
+    { "Etc/GMT+4", 0.0, 0.0, -240, true },
+    { "Etc/GMT+3", 0.0, 0.0, -180, true },
+    { "Etc/GMT+2", 0.0, 0.0, -120, true },
+    { "Etc/GMT+1", 0.0, 0.0, -60, true },
+    { "Etc/GMT", 0.0, 0.0, 0, true },
+    { "Etc/GMT-1", 0.0, 0.0, 60, true },
+    { "Etc/GMT-2", 0.0, 0.0, 120, true },
+    { "Etc/GMT-3", 0.0, 0.0, 180, true },
+    { "Etc/GMT-4", 0.0, 0.0, 240, true },
+    { "Etc/GMT-5", 0.0, 0.0, 300, true },
+    { "Etc/GMT-6", 0.0, 0.0, 360, true },
+    { "Etc/GMT-7", 0.0, 0.0, 420, true },
+    { "Etc/GMT-8", 0.0, 0.0, 480, true },
+    { "Etc/GMT-9", 0.0, 0.0, 540, true },
+    { "Etc/GMT-10", 0.0, 0.0, 600, true },
+    { "Etc/GMT-11", 0.0, 0.0, 660, true },
+    { "Etc/GMT-12", 0.0, 0.0, 720, true },
+  };
+
+  const std::size_t kZoneCount = sizeof (kZones) / sizeof (kZones[0]);
+  const std::size_t kLocationCount = kZoneCount - 25;
+
+  // Major cities far from the reference location of their zone, where the Voronoi cells
+  // of zone.tab alone hand them a neighbour's zone (Delhi would get Asia/Kathmandu)
+  const TimeZoneLocation kExtraLocations[] = {
+    { "Asia/Kolkata", 28.61, 77.21 }, // Delhi
+    { "Asia/Kolkata", 19.08, 72.88 }, // Mumbai
+    { "Asia/Kolkata", 13.08, 80.27 }, // Chennai
+    { "Asia/Kolkata", 12.97, 77.59 }, // Bengaluru
+    { "Asia/Kolkata", 17.39, 78.49 }, // Hyderabad
+    { "Asia/Kolkata", 23.02, 72.57 }, // Ahmedabad
+    { "Asia/Kolkata", 26.91, 75.79 }, // Jaipur
+    { "Asia/Kolkata", 26.85, 80.95 }, // Lucknow
+    { "Asia/Kolkata", 21.15, 79.09 }, // Nagpur
+    { "Asia/Kolkata", 31.63, 74.87 }, // Amritsar
+    { "Asia/Kolkata", 34.08, 74.80 }, // Srinagar
+    { "Asia/Kolkata", 26.14, 91.74 }, // Guwahati
+    { "Asia/Kolkata", 9.93, 76.27 }, // Kochi
+    { "Asia/Karachi", 31.55, 74.34 }, // Lahore
+    { "Asia/Karachi", 33.68, 73.05 }, // Islamabad
+    { "Asia/Karachi", 34.01, 71.58 }, // Peshawar
+    { "Asia/Karachi", 30.18, 66.99 }, // Quetta
+    { "Asia/Shanghai", 39.90, 116.41 }, // Beijing
+    { "Asia/Shanghai", 23.13, 113.26 }, // Guangzhou
+    { "Asia/Shanghai", 29.56, 106.55 }, // Chongqing
+    { "Asia/Shanghai", 30.57, 104.07 }, // Chengdu
+    { "Asia/Shanghai", 25.04, 102.71 }, // Kunming
+    { "Asia/Shanghai", 29.65, 91.17 }, // Lhasa
+    { "Asia/Shanghai", 34.34, 108.94 }, // Xi'an
+    { "Asia/Shanghai", 36.06, 103.83 }, // Lanzhou
+    { "Asia/Shanghai", 36.62, 101.78 }, // Xining
+    { "Asia/Shanghai", 45.80, 126.53 }, // Harbin
+    { "Asia/Shanghai", 40.84, 111.75 }, // Hohhot
+    { "Asia/Shanghai", 36.40, 94.90 }, // Golmud
+    { "Asia/Urumqi", 39.47, 75.99 }, // Kashgar
+    { "America/New_York", 25.76, -80.19 }, // Miami
+    { "America/New_York", 33.75, -84.39 }, // Atlanta
+    { "America/New_York", 38.91, -77.04 }, // Washington
+    { "America/New_York", 42.36, -71.06 }, // Boston
+    { "America/New_York", 35.23, -80.84 }, // Charlotte
+    { "America/New_York", 39.96, -83.00 }, // Columbus
+    { "America/Chicago", 32.78, -96.80 }, // Dallas
+    { "America/Chicago", 29.76, -95.37 }, // Houston
+    { "America/Chicago", 29.95, -90.07 }, // New Orleans
+    { "America/Chicago", 44.98, -93.27 }, // Minneapolis
+    { "America/Chicago", 38.63, -90.20 }, // St. Louis
+    { "America/Chicago", 39.10, -94.58 }, // Kansas City
+    { "America/Chicago", 36.16, -86.78 }, // Nashville
+    { "America/Chicago", 35.47, -97.52 }, // Oklahoma City
+    { "America/Chicago", 41.26, -95.93 }, // Omaha
+    { "America/Chicago", 29.42, -98.49 }, // San Antonio
+    { "America/Denver", 40.76, -111.89 }, // Salt Lake City
+    { "America/Denver", 35.08, -106.65 }, // Albuquerque
+    { "America/Denver", 31.76, -106.49 }, // El Paso
+    { "America/Denver", 45.78, -108.50 }, // Billings
+    { "America/Denver", 41.14, -104.82 }, // Cheyenne
+    { "America/Los_Angeles", 47.61, -122.33 }, // Seattle
+    { "America/Los_Angeles", 37.77, -122.42 }, // San Francisco
+    { "America/Los_Angeles", 36.17, -115.14 }, // Las Vegas
+    { "America/Los_Angeles", 45.52, -122.68 }, // Portland
+    { "America/Los_Angeles", 32.72, -117.16 }, // San Diego
+    { "America/Anchorage", 64.84, -147.72 }, // Fairbanks
+    { "America/Toronto", 45.50, -73.57 }, // Montreal
+    { "America/Toronto", 45.42, -75.70 }, // Ottawa
+    { "America/Toronto", 46.81, -71.21 }, // Quebec
+    { "America/Edmonton", 51.05, -114.07 }, // Calgary
+    { "America/Regina", 52.13, -106.67 }, // Saskatoon
+    { "America/Sao_Paulo", -22.91, -43.17 }, // Rio de Janeiro
+    { "America/Sao_Paulo", -15.79, -47.88 }, // Brasilia
+    { "America/Sao_Paulo", -19.92, -43.94 }, // Belo Horizonte
+    { "America/Sao_Paulo", -25.43, -49.27 }, // Curitiba
+    { "America/Sao_Paulo", -30.03, -51.23 }, // Porto Alegre
+    { "America/Mexico_City", 20.66, -103.35 }, // Guadalajara
+    { "America/Mexico_City", 19.04, -98.21 }, // Puebla
+    { "Australia/Darwin", -23.70, 133.88 }, // Alice Springs
+    { "Australia/Brisbane", -16.92, 145.77 }, // Cairns
+    { "Australia/Sydney", -35.28, 149.13 }, // Canberra
+    { "Australia/Perth", -20.31, 118.58 }, // Port Hedland
+    { "Australia/Perth", -30.75, 121.47 }, // Kalgoorlie
+    { "Asia/Jakarta", -7.25, 112.75 }, // Surabaya
+    { "Asia/Makassar", -8.65, 115.22 }, // Denpasar
+    { "Africa/Algiers", 22.79, 5.53 }, // Tamanrasset
+    { "Africa/Tripoli", 27.04, 14.43 }, // Sabha
+    { "Africa/Cairo", 24.09, 32.90 }, // Aswan
+    { "Africa/Bamako", 16.77, -3.01 }, // Timbuktu
+    { "Africa/Niamey", 16.97, 7.99 }, // Agadez
+    { "Africa/Johannesburg", -33.92, 18.42 }, // Cape Town
+    { "Africa/Lagos", 12.00, 8.52 }, // Kano
+    { "Asia/Riyadh", 21.49, 39.19 }, // Jeddah
+    { "Asia/Tehran", 36.30, 59.61 }, // Mashhad
+    { "Asia/Tehran", 29.59, 52.58 }, // Shiraz
+    { "Europe/Moscow", 59.94, 30.31 }, // Saint Petersburg
+    { "Europe/Moscow", 47.24, 39.71 }, // Rostov-on-Don
+    { "Europe/Istanbul", 39.93, 32.86 }, // Ankara
+    // borders the nearest reference location gets wrong: Galicia and Extremadura are not
+    // Lisbon, Brittany is not Guernsey, eastern Estonia is not Moscow
+    { "Europe/Madrid", 42.24, -8.72 }, // Vigo
+    { "Europe/Madrid", 42.88, -8.54 }, // Santiago de Compostela
+    { "Europe/Madrid", 43.36, -8.41 }, // A Coruña
+    { "Europe/Madrid", 42.34, -7.86 }, // Ourense
+    { "Europe/Madrid", 43.01, -7.56 }, // Lugo
+    { "Europe/Madrid", 38.88, -6.97 }, // Badajoz
+    { "Europe/Madrid", 39.47, -6.37 }, // Cáceres
+    { "Europe/Madrid", 37.26, -6.95 }, // Huelva
+    { "Europe/Madrid", 37.39, -5.98 }, // Seville
+    { "Europe/Madrid", 40.97, -5.66 }, // Salamanca
+    { "Europe/Madrid", 41.50, -5.75 }, // Zamora
+    { "Europe/Madrid", 43.36, -5.85 }, // Oviedo
+    { "Europe/Lisbon", 41.15, -8.61 }, // Porto
+    { "Europe/Lisbon", 41.55, -8.42 }, // Braga
+    { "Europe/Lisbon", 41.81, -6.76 }, // Bragança
+    { "Europe/Lisbon", 40.54, -7.27 }, // Guarda
+    { "Europe/Lisbon", 38.57, -7.91 }, // Évora
+    { "Europe/Lisbon", 37.02, -7.93 }, // Faro
+    { "Europe/Lisbon", 38.88, -7.16 }, // Elvas
+    { "Europe/Lisbon", 37.19, -7.42 }, // Vila Real de Santo António
+    { "Europe/Paris", 48.39, -4.49 }, // Brest
+    { "Europe/Paris", 48.00, -4.10 }, // Quimper
+    { "Europe/Paris", 47.75, -3.37 }, // Lorient
+    { "Europe/Paris", 48.11, -1.68 }, // Rennes
+    { "Europe/Paris", 48.51, -2.76 }, // Saint-Brieuc
+    { "Europe/Paris", 48.65, -2.03 }, // Saint-Malo
+    { "Europe/Paris", 48.84, -1.60 }, // Granville
+    { "Europe/Paris", 49.64, -1.62 }, // Cherbourg
+    { "Europe/Paris", 47.22, -1.55 }, // Nantes
+    { "Europe/Tallinn", 59.38, 28.19 }, // Narva
+    { "Europe/Tallinn", 59.36, 27.41 }, // Jõhvi
+    { "Europe/Tallinn", 58.38, 26.72 }, // Tartu
+    { "Europe/Tallinn", 57.83, 27.02 }, // Võru
+    { "Europe/Tallinn", 58.39, 24.50 }, // Pärnu
+    { "Europe/Moscow", 57.82, 28.33 }, // Pskov
+    { "Europe/Moscow", 59.37, 28.61 }, // Kingisepp
+    { "Europe/Moscow", 59.37, 28.22 }, // Ivangorod
+    // and across the Baltic: Gdańsk is not Kaliningrad, Hrodna is not Vilnius, the two
+    // towns on the Torne are not both Helsinki, Spokane is not Creston
+    { "Europe/Warsaw", 54.35, 18.65 }, // Gdańsk
+    { "Europe/Warsaw", 54.16, 19.40 }, // Elbląg
+    { "Europe/Minsk", 53.68, 23.83 }, // Hrodna
+    { "Europe/Stockholm", 65.84, 24.14 }, // Haparanda
+    { "Europe/Helsinki", 65.85, 24.15 }, // Tornio
+    { "America/Los_Angeles", 47.66, -117.43 }, // Spokane
+  };
+
+  const std::size_t kExtraLocationCount = sizeof (kExtraLocations) / sizeof (kExtraLocations[0]);
+
+} // namespace dotname::tz
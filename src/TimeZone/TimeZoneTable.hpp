@@ -0,0 +1,29 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __TIMEZONETABLE_HPP
+#define __TIMEZONETABLE_HPP
+
+// The embedded zone dataset: zones with a reference location sorted by name, the nautical
+// zones, further locations of some zones
+
+#include <SunrisetWorker/TimeZoneIndex.hpp>
+
+#include <cstddef>
+
+namespace dotname::tz {
+
+  struct TimeZoneLocation {
+    const char* zone; // one of the names in kZones
+    double lat, lon;
+  };
+
+  extern const TimeZoneInfo kZones[];
+  extern const std::size_t kZoneCount;
+  extern const std::size_t kLocationCount;
+  extern const TimeZoneLocation kExtraLocations[];
+  extern const std::size_t kExtraLocationCount;
+
+} // namespace dotname::tz
+
+#endif // __TIMEZONETABLE_HPP
@@ -0,0 +1,128 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include "Trace.hpp"
+#include <Logger/Logger.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <chrono>
+#include <fstream>
+#include <mutex>
+#include <vector>
+
+#ifdef _WIN32
+  #include <process.h>
+  #define getpid _getpid
+#else
+  #include <unistd.h>
+#endif
+
+namespace dotname {
+
+  namespace {
+
+    struct TraceEvent {
+      std::string name;
+      std::int64_t start, duration;
+      std::uint32_t thread;
+    };
+
+    struct TraceLog {
+      std::mutex mutex;
+      std::filesystem::path file;
+      std::vector<TraceEvent> events;
+      std::uint64_t dropped = 0;
+    };
+
+    TraceLog& traceLog () {
+      static TraceLog log;
+      return log;
+    }
+
+    // small stable ids for the viewer's thread lanes, the first tracing thread is 1
+    std::uint32_t threadId () {
+      static std::atomic<std::uint32_t> next { 1 };
+      thread_local const std::uint32_t id = next.fetch_add (1, std::memory_order_relaxed);
+      return id;
+    }
+
+  } // namespace
+
+  void Trace::enable (const std::filesystem::path& file) {
+    TraceLog& log = traceLog ();
+    {
+      std::lock_guard<std::mutex> lock (log.mutex);
+      log.file = file;
+    }
+    threadId (); // the enabling thread, usually main, gets lane 1
+    enabled_.store (true, std::memory_order_relaxed);
+  }
+
+  void Trace::disable () {
+    enabled_.store (false, std::memory_order_relaxed);
+    TraceLog& log = traceLog ();
+    std::lock_guard<std::mutex> lock (log.mutex);
+    log.events.clear ();
+    log.dropped = 0;
+  }
+
+  std::int64_t Trace::now () {
+    using namespace std::chrono;
+    return duration_cast<microseconds> (steady_clock::now ().time_since_epoch ()).count ();
+  }
+
+  void Trace::complete (std::string name, std::int64_t startUs, std::int64_t endUs) {
+    if (!enabled ())
+      return;
+    std::uint32_t thread = threadId ();
+    TraceLog& log = traceLog ();
+    std::lock_guard<std::mutex> lock (log.mutex);
+    if (log.events.size () >= kTraceMaxEvents) {
+      ++log.dropped;
+      return;
+    }
+    log.events.push_back ({ std::move (name), startUs, endUs - startUs, thread });
+  }
+
+  int Trace::flush () {
+    if (!enabled ())
+      return 0;
+    TraceLog& log = traceLog ();
+    std::lock_guard<std::mutex> lock (log.mutex);
+
+    const int pid = static_cast<int> (getpid ());
+    nlohmann::json events = nlohmann::json::array ();
+    events.push_back ({ { "name", "process_name" },
+                        { "ph", "M" },
+                        { "pid", pid },
+                        { "tid", 1 },
+                        { "args", { { "name", "FollowSun" } } } });
+    for (const auto& event : log.events)
+      events.push_back ({ { "name", event.name },
+                          { "cat", "followsun" },
+                          { "ph", "X" },
+                          { "ts", event.start },
+                          { "dur", event.duration },
+                          { "pid", pid },
+                          { "tid", event.thread } });
+
+    std::ofstream out (log.file, std::ios::trunc);
+    if (!out.is_open ()) {
+      LOG_E_STREAM << "Failed to open trace file: " << log.file << std::endl;
+      return -1;
+    }
+    try {
+      out << nlohmann::json { { "traceEvents", events }, { "displayTimeUnit", "ms" } }.dump ()
+          << '\n';
+    } catch (const nlohmann::json::exception& e) {
+      LOG_E_STREAM << "Failed to write trace file: " << e.what () << std::endl;
+      return -1;
+    }
+    LOG_D_STREAM << "Trace: " << log.events.size () << " span(s) written to " << log.file
+                 << (log.dropped ? ", " + std::to_string (log.dropped) + " dropped" : "")
+                 << std::endl;
+    return out ? 0 : -1;
+  }
+
+} // namespace dotname
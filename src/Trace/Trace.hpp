@@ -0,0 +1,73 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __TRACE_HPP
+#define __TRACE_HPP
+
+// Scoped spans, TRACE_SPAN ("loadConfig"), written as Chrome trace_event JSON; a span
+// costs one relaxed atomic load while tracing is off
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <utility>
+
+namespace dotname {
+
+  constexpr std::size_t kTraceMaxEvents = 1 << 20;
+
+  class Trace {
+  public:
+    // Starts recording for a later flush () into file
+    static void enable (const std::filesystem::path& file);
+    // Stops recording and drops what was recorded, nothing is written
+    static void disable ();
+    static bool enabled () {
+      return enabled_.load (std::memory_order_relaxed);
+    }
+    // Microseconds on the steady clock, the time base of all events
+    static std::int64_t now ();
+    // A finished span, also for phases that began before enable ()
+    static void complete (std::string name, std::int64_t startUs, std::int64_t endUs);
+    // Writes everything recorded so far, 0 on success or when off, -1 on failure (logged)
+    static int flush ();
+
+  private:
+    static inline std::atomic<bool> enabled_ { false };
+  };
+
+  class TraceSpan {
+  public:
+    explicit TraceSpan (const char* name) {
+      if (Trace::enabled ()) {
+        name_ = name;
+        start_ = Trace::now ();
+      }
+    }
+    explicit TraceSpan (std::string name) {
+      if (Trace::enabled ()) {
+        name_ = std::move (name);
+        start_ = Trace::now ();
+      }
+    }
+    ~TraceSpan () {
+      if (start_ >= 0)
+        Trace::complete (std::move (name_), start_, Trace::now ());
+    }
+
+    TraceSpan (const TraceSpan&) = delete;
+    TraceSpan& operator= (const TraceSpan&) = delete;
+
+  private:
+    std::string name_;
+    std::int64_t start_ = -1;
+  };
+
+} // namespace dotname
+
+#define TRACE_SPAN_CONCAT_(a, b) a##b
+#define TRACE_SPAN_NAME_(line) TRACE_SPAN_CONCAT_ (traceSpan_, line)
+#define TRACE_SPAN(name) ::dotname::TraceSpan TRACE_SPAN_NAME_ (__LINE__) (name)
+
+#endif // __TRACE_HPP
@@ -6,6 +6,7 @@
 
 #include "Logger/Logger.hpp"
 
+#include <cmath>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
@@ -143,6 +144,16 @@ namespace DotNameUtils {
     }
   } // namespace Dots
 
+  namespace TimeUtils {
+    // hours as H:MM, folded into 0..24 first
+    inline std::string to24Time (double time) {
+      time -= 24.0 * std::floor (time / 24.0);
+      int hours = static_cast<int> (time);
+      int minutes = static_cast<int> ((time - hours) * 60);
+      return std::to_string (hours) + ":" + (minutes < 10 ? "0" : "") + std::to_string (minutes);
+    }
+  } // namespace TimeUtils
+
   namespace Performance {
     inline void simpleCpuBenchmark (std::chrono::microseconds duration
                                     = std::chrono::microseconds (1000000)) {
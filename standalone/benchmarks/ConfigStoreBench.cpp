@@ -0,0 +1,86 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/ConfigStore.hpp>
+#include <benchmark/benchmark.h>
+
+#include "../tests/TempDir.hpp"
+
+#include <fstream>
+#include <sstream>
+
+namespace {
+
+  // The config a FollowSun start used to produce: the whole file rewritten in place
+  // (truncate + dump) once per validated setting, 7 times on a start with every option.
+  // Serialized by hand to keep nlohmann out of the benchmark.
+  void BM_ConfigLegacyStartup (benchmark::State& state) {
+    TempDir dir;
+    auto file = dir / "config.json";
+    for (auto _ : state) {
+      for (int save = 0; save < 7; ++save) {
+        std::ostringstream text;
+        text << "{\n    \"lat\": 50.0755,\n    \"lon\": 14.4378,\n    \"riseOffsetMinutes\": 0,\n"
+             << "    \"setOffsetMinutes\": 0,\n    \"themeBackends\": [\n        \"gnome\"\n"
+             << "    ],\n    \"themeTimeoutMs\": 2000,\n    \"utcOffsetMinutes\": " << save
+             << "\n}";
+        std::ofstream out (file, std::ios::trunc);
+        out << text.str ();
+      }
+    }
+    state.counters["writes/start"] = 7;
+  }
+
+  void setAll (dotname::ConfigStore& store, int utc) {
+    store.set ("lat", 50.0755);
+    store.set ("lon", 14.4378);
+    store.set ("utcOffsetMinutes", utc);
+    store.set ("riseOffsetMinutes", 0);
+    store.set ("setOffsetMinutes", 0);
+    store.set ("themeBackends", std::vector<std::string> { "gnome" });
+    store.set ("themeTimeoutMs", 2000);
+  }
+
+  // A start that changed a setting: load, one durable commit (temp + fsync + rename)
+  void BM_ConfigStoreStartupChanged (benchmark::State& state) {
+    TempDir dir;
+    auto file = dir / "config.json";
+    int utc = 0;
+    std::uint64_t writes = 0;
+    for (auto _ : state) {
+      dotname::ConfigStore store (file);
+      store.load ();
+      setAll (store, ++utc % 2);
+      store.commit ();
+      writes += store.stats ().writes;
+    }
+    state.counters["writes/start"] = benchmark::Counter (
+        static_cast<double> (writes) / static_cast<double> (state.iterations ()));
+  }
+
+  // The common start: nothing changed, load and no write at all
+  void BM_ConfigStoreStartupUnchanged (benchmark::State& state) {
+    TempDir dir;
+    auto file = dir / "config.json";
+    {
+      dotname::ConfigStore store (file);
+      setAll (store, 60);
+      store.commit ();
+    }
+    std::uint64_t writes = 0;
+    for (auto _ : state) {
+      dotname::ConfigStore store (file);
+      store.load ();
+      setAll (store, 60);
+      store.commit ();
+      writes += store.stats ().writes;
+    }
+    state.counters["writes/start"] = benchmark::Counter (
+        static_cast<double> (writes) / static_cast<double> (state.iterations ()));
+  }
+
+} // namespace
+
+BENCHMARK (BM_ConfigLegacyStartup)->Unit (benchmark::kMicrosecond);
+BENCHMARK (BM_ConfigStoreStartupChanged)->Unit (benchmark::kMicrosecond);
+BENCHMARK (BM_ConfigStoreStartupUnchanged)->Unit (benchmark::kMicrosecond);
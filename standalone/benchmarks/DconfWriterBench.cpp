@@ -0,0 +1,66 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/DconfWriter.hpp>
+#include <benchmark/benchmark.h>
+
+#include <cstdlib>
+
+#if defined(__linux__)
+  #include "../tests/DBusTestBus.hpp"
+#endif
+
+namespace {
+
+  // Latency of one theme switch (color-scheme + gtk-theme) the old way: two std::system
+  // calls, each a fork of /bin/sh that execs gsettings. Measures the process cost even
+  // where gsettings has no schemas to write to.
+  void BM_SwitchGsettingsSystem (benchmark::State& state) {
+    bool light = false;
+    for (auto _ : state) {
+      light = !light;
+      if (light) {
+        std::system ("gsettings set org.gnome.desktop.interface color-scheme 'default' "
+                     ">/dev/null 2>&1");
+        std::system ("gsettings set org.gnome.desktop.interface gtk-theme 'Adwaita' "
+                     ">/dev/null 2>&1");
+      } else {
+        std::system ("gsettings set org.gnome.desktop.interface color-scheme 'prefer-dark' "
+                     ">/dev/null 2>&1");
+        std::system ("gsettings set org.gnome.desktop.interface gtk-theme 'Adwaita-dark' "
+                     ">/dev/null 2>&1");
+      }
+    }
+    state.counters["switches/s"] = benchmark::Counter (
+        static_cast<double> (state.iterations ()), benchmark::Counter::kIsRate);
+  }
+
+#if defined(__linux__)
+  // The same switch as one dconf Change () round trip over a private bus to a stub
+  // ca.desrt.dconf; the real dconf-service adds its own database write on top.
+  void BM_SwitchDconfDBus (benchmark::State& state) {
+    DBusTestBus bus;
+    dotname::DconfWriter writer;
+    if (!bus.available () || bus.startDconf () != 0 || writer.connect (bus.address ()) != 0) {
+      state.SkipWithError ("dbus-daemon not available");
+      return;
+    }
+    bool light = false;
+    for (auto _ : state) {
+      light = !light;
+      if (writer.switchLightTheme (light) != 0) {
+        state.SkipWithError ("Change failed");
+        break;
+      }
+    }
+    state.counters["switches/s"] = benchmark::Counter (
+        static_cast<double> (state.iterations ()), benchmark::Counter::kIsRate);
+  }
+#endif
+
+} // namespace
+
+BENCHMARK (BM_SwitchGsettingsSystem)->Unit (benchmark::kMillisecond)->UseRealTime ();
+#if defined(__linux__)
+BENCHMARK (BM_SwitchDconfDBus)->Unit (benchmark::kMicrosecond)->UseRealTime ();
+#endif
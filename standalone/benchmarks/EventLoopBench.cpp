@@ -0,0 +1,83 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/EventLoop.hpp>
+#include <benchmark/benchmark.h>
+
+#if defined(__linux__)
+  #include <cstdint>
+  #include <sys/epoll.h>
+  #include <sys/eventfd.h>
+  #include <unistd.h>
+
+namespace {
+
+  // one event per iteration: signal an eventfd, suspend until epoll reports it, drain it
+  dotname::Task eventRounds (dotname::EventLoop& loop, benchmark::State& state, int fd) {
+    std::uint64_t one = 1, value;
+    while (state.KeepRunning ()) {
+      if (::write (fd, &one, sizeof (one)) != sizeof (one))
+        co_return -1;
+      co_await loop.wait (fd);
+      if (::read (fd, &value, sizeof (value)) != sizeof (value))
+        co_return -1;
+    }
+    co_return 0;
+  }
+
+  void BM_EventLoopDispatch (benchmark::State& state) {
+    int fd = eventfd (0, EFD_NONBLOCK | EFD_CLOEXEC);
+    dotname::EventLoop loop;
+    loop.spawn (eventRounds (loop, state, fd));
+    if (loop.run () != 0)
+      state.SkipWithError ("event loop failed");
+    ::close (fd);
+    state.SetItemsProcessed (state.iterations ());
+  }
+
+  // the same syscalls without coroutines: the floor the loop's dispatch adds to
+  void BM_EpollDispatch (benchmark::State& state) {
+    int fd = eventfd (0, EFD_NONBLOCK | EFD_CLOEXEC);
+    int ep = epoll_create1 (EPOLL_CLOEXEC);
+    epoll_event ev {};
+    ev.events = EPOLLIN | EPOLLONESHOT;
+    epoll_ctl (ep, EPOLL_CTL_ADD, fd, &ev);
+    std::uint64_t one = 1, value;
+    epoll_event out[8];
+    for (auto _ : state) {
+      benchmark::DoNotOptimize (::write (fd, &one, sizeof (one)));
+      epoll_ctl (ep, EPOLL_CTL_MOD, fd, &ev);
+      benchmark::DoNotOptimize (epoll_wait (ep, out, 8, -1));
+      benchmark::DoNotOptimize (::read (fd, &value, sizeof (value)));
+    }
+    ::close (ep);
+    ::close (fd);
+    state.SetItemsProcessed (state.iterations ());
+  }
+
+  // task switches alone, no syscalls: a child task per iteration
+  dotname::Task child () {
+    co_return 1;
+  }
+
+  dotname::Task childRounds (benchmark::State& state) {
+    int sum = 0;
+    while (state.KeepRunning ())
+      sum += co_await child ();
+    benchmark::DoNotOptimize (sum);
+    co_return 0;
+  }
+
+  void BM_EventLoopTaskAwait (benchmark::State& state) {
+    dotname::EventLoop loop;
+    loop.spawn (childRounds (state));
+    loop.run ();
+    state.SetItemsProcessed (state.iterations ());
+  }
+
+} // namespace
+
+BENCHMARK (BM_EventLoopDispatch);
+BENCHMARK (BM_EpollDispatch);
+BENCHMARK (BM_EventLoopTaskAwait);
+#endif
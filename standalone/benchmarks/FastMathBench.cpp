@@ -0,0 +1,74 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/SunEngine.hpp>
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace {
+
+  struct Query {
+    int year, month, day;
+    double lat, lon;
+  };
+
+  // Differential harness: state.range (0) random (date, lat, lon) inputs through the
+  // reference __sunriset__ and the FastMath engine. Reports max / RMS error of rise and
+  // set in seconds over the points where both agree on the return code, the number of
+  // return code mismatches (polar boundary) and the wall clock speedup.
+  void BM_FastMathDifferential (benchmark::State& state) {
+    std::vector<Query> q (static_cast<std::size_t> (state.range (0)));
+    std::mt19937 rng (2025);
+    std::uniform_int_distribution<int> year (1801, 2099), month (1, 12), day (1, 28);
+    std::uniform_real_distribution<double> lat (-89.9, 89.9), lon (-180.0, 180.0);
+    for (auto& x : q)
+      x = { year (rng), month (rng), day (rng), lat (rng), lon (rng) };
+
+    std::vector<double> r0 (q.size ()), s0 (q.size ()), r1 (q.size ()), s1 (q.size ());
+    std::vector<int> rc0 (q.size ()), rc1 (q.size ());
+    auto run = [&] (dotname::SunEngine engine, double* rise, double* set, int* rc) {
+      auto t0 = std::chrono::steady_clock::now ();
+      for (std::size_t i = 0; i < q.size (); ++i)
+        rc[i] = dotname::sunriset (engine, q[i].year, q[i].month, q[i].day, q[i].lon, q[i].lat,
+                                   -35.0 / 60.0, 1, &rise[i], &set[i]);
+      return std::chrono::duration<double> (std::chrono::steady_clock::now () - t0).count ();
+    };
+
+    double tRef = 0.0, tFast = 0.0;
+    for (auto _ : state) {
+      tRef += run (dotname::SunEngine::Reference, r0.data (), s0.data (), rc0.data ());
+      tFast += run (dotname::SunEngine::FastMath, r1.data (), s1.data (), rc1.data ());
+    }
+
+    double worst = 0.0, sum = 0.0;
+    std::size_t n = 0, mismatches = 0;
+    for (std::size_t i = 0; i < q.size (); ++i) {
+      if (rc0[i] != rc1[i]) {
+        ++mismatches;
+        continue;
+      }
+      for (double e : { std::fabs (r0[i] - r1[i]), std::fabs (s0[i] - s1[i]) }) {
+        e *= 3600.0;
+        worst = std::max (worst, e);
+        sum += e * e;
+        ++n;
+      }
+    }
+    state.counters["max_err_s"] = worst;
+    state.counters["rms_err_s"] = n ? std::sqrt (sum / n) : 0.0;
+    state.counters["rc_mismatch"] = static_cast<double> (mismatches);
+    state.counters["speedup"] = tFast > 0.0 ? tRef / tFast : 0.0;
+  }
+
+} // namespace
+
+BENCHMARK (BM_FastMathDifferential)
+    ->Arg (1 << 22)
+    ->Iterations (1)
+    ->Unit (benchmark::kMillisecond)
+    ->UseRealTime ();
@@ -0,0 +1,83 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/SessionEvents.hpp>
+#include <SunrisetWorker/SunState.hpp>
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <vector>
+
+#if defined(__linux__)
+  #include "../tests/DBusTestBus.hpp"
+
+  #include <poll.h>
+#endif
+
+namespace {
+
+  // What the former dbus-monitor.sh paid for every line dbus-monitor printed, unlock or
+  // not: a subshell running echo | grep. An unlock then cold started FollowSun on top.
+  void BM_UnlockScriptPerLine (benchmark::State& state) {
+    for (auto _ : state)
+      std::system ("echo '   boolean false' | grep -q 'boolean false'");
+    state.counters["lines/s"] = benchmark::Counter (static_cast<double> (state.iterations ()),
+                                                    benchmark::Counter::kIsRate);
+  }
+
+#if defined(__linux__)
+  // ActiveChanged (false) sent on a private bus until the listener has the event and the
+  // state is re-evaluated, the whole unlock path of the daemon
+  void BM_UnlockInProcess (benchmark::State& state) {
+    DBusTestBus bus;
+    dotname::SessionEventListener listener;
+    dotname::dbus::Connection sender;
+    if (!bus.available () || listener.connect (bus.address (), bus.address ()) != 0
+        || sender.connect (bus.address ()) != 0) {
+      state.SkipWithError ("dbus-daemon not available");
+      return;
+    }
+    dotname::SunStateParams params;
+    params.lat = 50.0755;
+    params.lon = 14.4378;
+    params.utcOffsetMinutes = 60;
+    const dotname::SunStateEngine engine (params);
+
+    dotname::dbus::Message signal;
+    signal.type = dotname::dbus::MessageType::Signal;
+    signal.flags = dotname::dbus::kNoReplyExpected;
+    signal.path = "/org/gnome/ScreenSaver";
+    signal.interface = "org.gnome.ScreenSaver";
+    signal.member = "ActiveChanged";
+    signal.signature = "b";
+    dotname::dbus::BodyWriter (signal.body).uint32 (0);
+
+    std::vector<dotname::SessionEvent> events;
+    std::vector<pollfd> fds;
+    for (auto _ : state) {
+      if (sender.send (signal) != 0) {
+        state.SkipWithError ("send failed");
+        break;
+      }
+      events.clear ();
+      while (events.empty ()) {
+        fds.clear ();
+        for (int fd : listener.fds ())
+          fds.push_back ({ fd, POLLIN, 0 });
+        ::poll (fds.data (), fds.size (), 1000);
+        listener.drain (events);
+      }
+      benchmark::DoNotOptimize (engine.stateAt (std::chrono::system_clock::now ()).isDay);
+    }
+    state.counters["unlocks/s"] = benchmark::Counter (
+        static_cast<double> (state.iterations ()), benchmark::Counter::kIsRate);
+  }
+#endif
+
+} // namespace
+
+BENCHMARK (BM_UnlockScriptPerLine)->Unit (benchmark::kMillisecond)->UseRealTime ();
+#if defined(__linux__)
+BENCHMARK (BM_UnlockInProcess)->Unit (benchmark::kMicrosecond)->UseRealTime ();
+#endif
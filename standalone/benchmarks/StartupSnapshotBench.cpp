@@ -0,0 +1,142 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/ConfigStore.hpp>
+#include <SunrisetWorker/StartupSnapshot.hpp>
+#include <benchmark/benchmark.h>
+
+#include "../tests/TempDir.hpp"
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+  #include <fcntl.h>
+  #include <spawn.h>
+  #include <sys/wait.h>
+extern char** environ;
+#endif
+
+namespace {
+
+  struct BenchFiles {
+    TempDir dir;
+    std::filesystem::path config = dir / "config.json", snapshot = dir / "startup.snap";
+    BenchFiles () {
+      dotname::ConfigStore store (config);
+      store.set ("lat", 50.0755);
+      store.set ("lon", 14.4378);
+      store.set ("utcOffsetMinutes", 60);
+      store.set ("riseOffsetMinutes", 0);
+      store.set ("setOffsetMinutes", 0);
+      store.set ("themeBackends", std::vector<std::string> { "gnome" });
+      store.set ("themeTimeoutMs", 2000);
+      store.commit ();
+    }
+  };
+
+  // What a one-shot start did before: parse config.json, resolve and compute the day
+  void BM_StartupJson (benchmark::State& state) {
+    BenchFiles files;
+    for (auto _ : state) {
+      dotname::ConfigStore store (files.config);
+      store.load ();
+      dotname::SunStateParams params;
+      params.lat = store.get ("lat", 50.0755);
+      params.lon = store.get ("lon", 14.4378);
+      params.utcOffsetMinutes = store.get ("utcOffsetMinutes", 0);
+      params.riseOffsetMinutes = store.get ("riseOffsetMinutes", 0);
+      params.setOffsetMinutes = store.get ("setOffsetMinutes", 0);
+      auto backends = store.get ("themeBackends", std::vector<std::string> { "gnome" });
+      benchmark::DoNotOptimize (backends);
+      benchmark::DoNotOptimize (dotname::SunStateEngine (params).compute (2025, 6, 21, 12.0));
+    }
+  }
+
+  void BM_StartupSnapshot (benchmark::State& state) {
+    BenchFiles files;
+    dotname::StartupSnapshot snapshot;
+    snapshot.year = 2025;
+    snapshot.month = 6;
+    snapshot.day = 21;
+    snapshot.themeBackends = { "gnome" };
+    dotname::saveStartupSnapshot (files.snapshot, files.config, snapshot);
+    for (auto _ : state) {
+      dotname::StartupSnapshot loaded;
+      if (dotname::loadStartupSnapshot (files.snapshot, files.config, 2025, 6, 21, loaded) != 0) {
+        state.SkipWithError ("snapshot not loaded");
+        break;
+      }
+      benchmark::DoNotOptimize (loaded);
+    }
+  }
+
+#if defined(__linux__)
+  // Exec to exit of a copy of the FollowSun binary given in FOLLOWSUN_BIN, in a temporary
+  // prefix with a copy of its assets and no theme backends, so the runs leave the desktop
+  // and the installed state alone. Arg 0 removes startup.snap before every run
+  // (config.json path plus the rebuild), arg 1 keeps it (snapshot path).
+  void BM_StartupExec (benchmark::State& state) {
+    const char* installed = std::getenv ("FOLLOWSUN_BIN");
+    if (!installed) {
+      state.SkipWithError ("FOLLOWSUN_BIN not set");
+      return;
+    }
+    TempDir prefix;
+    const auto binary = prefix.path () / "bin" / "FollowSun";
+    const auto assets = prefix.path () / "share" / "FollowSun" / "assets";
+    std::error_code ec;
+    std::filesystem::create_directories (binary.parent_path (), ec);
+    std::filesystem::copy_file (installed, binary, ec);
+    if (!ec) {
+      std::filesystem::create_directories (assets.parent_path (), ec);
+      std::filesystem::copy (std::filesystem::path (installed).parent_path ()
+                                 / "../share/FollowSun/assets",
+                             assets, std::filesystem::copy_options::recursive, ec);
+    }
+    if (ec) {
+      state.SkipWithError ("cannot copy FollowSun and its assets");
+      return;
+    }
+    std::filesystem::remove_all (assets / "hooks");
+    std::filesystem::remove (assets / "themestate.json");
+    dotname::ConfigStore config (assets / "config.json");
+    config.load ();
+    config.set ("themeBackends", std::vector<std::string> {});
+    config.commit ();
+
+    const std::string path = binary.string ();
+    char* argv[] = { const_cast<char*> (path.c_str ()), nullptr };
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init (&actions);
+    posix_spawn_file_actions_addopen (&actions, 1, "/dev/null", O_WRONLY, 0);
+    posix_spawn_file_actions_addopen (&actions, 2, "/dev/null", O_WRONLY, 0);
+    for (auto _ : state) {
+      if (state.range (0) == 0) {
+        state.PauseTiming ();
+        std::filesystem::remove (assets / "startup.snap");
+        state.ResumeTiming ();
+      }
+      pid_t pid;
+      int status = 0;
+      if (posix_spawn (&pid, path.c_str (), &actions, nullptr, argv, environ) != 0
+          || waitpid (pid, &status, 0) != pid || !WIFEXITED (status)
+          || WEXITSTATUS (status) != 0) {
+        state.SkipWithError ("FollowSun failed");
+        break;
+      }
+    }
+    posix_spawn_file_actions_destroy (&actions);
+  }
+#endif
+
+} // namespace
+
+BENCHMARK (BM_StartupJson)->Unit (benchmark::kMicrosecond);
+BENCHMARK (BM_StartupSnapshot)->Unit (benchmark::kMicrosecond);
+#if defined(__linux__)
+BENCHMARK (BM_StartupExec)->Arg (0)->Arg (1)->Unit (benchmark::kMillisecond);
+#endif
@@ -0,0 +1,79 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/SunCache.hpp>
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace {
+
+  struct Query {
+    double lat, lon;
+    int day;
+  };
+
+  // a service workload: 1000 cities, Zipf-like popularity, the next 30 days
+  const std::vector<Query>& queries () {
+    static const std::vector<Query> q = [] {
+      std::mt19937 rng (23);
+      std::uniform_real_distribution<double> lat (-60.0, 60.0), lon (-180.0, 180.0);
+      std::vector<std::pair<double, double>> cities (1000);
+      for (auto& c : cities)
+        c = { lat (rng), lon (rng) };
+      std::vector<double> weights (cities.size ());
+      for (std::size_t i = 0; i < weights.size (); ++i)
+        weights[i] = 1.0 / static_cast<double> (i + 1);
+      std::discrete_distribution<std::size_t> city (weights.begin (), weights.end ());
+      std::uniform_int_distribution<int> day (1, 30);
+      std::vector<Query> v (1 << 16);
+      for (auto& x : v) {
+        const auto& c = cities[city (rng)];
+        x = { c.first, c.second, day (rng) };
+      }
+      return v;
+    }();
+    return q;
+  }
+
+  std::unique_ptr<dotname::SunCache> cache;
+
+  void BM_SunCacheGet (benchmark::State& state) {
+    const auto& q = queries ();
+    std::size_t i = static_cast<std::size_t> (state.thread_index ()) * 7919;
+    for (auto _ : state) {
+      const Query& x = q[i++ & (q.size () - 1)];
+      benchmark::DoNotOptimize (cache->get (x.lat, x.lon, 2025, 6, x.day));
+    }
+    state.counters["calls/s"] = benchmark::Counter (static_cast<double> (state.iterations ()),
+                                                    benchmark::Counter::kIsRate);
+    if (state.thread_index () == 0) {
+      auto s = cache->stats ();
+      state.counters["hit_rate"] = static_cast<double> (s.hits)
+                                   / static_cast<double> (s.hits + s.misses);
+      state.counters["evictions"] = static_cast<double> (s.evictions);
+      state.counters["KiB"] = static_cast<double> (s.memoryBytes >> 10);
+    }
+  }
+
+  // shared by all threads of a run
+  void setupCache (const benchmark::State& state) {
+    cache = std::make_unique<dotname::SunCache> (static_cast<std::size_t> (state.range (0)) << 10);
+  }
+
+  void teardownCache (const benchmark::State&) {
+    cache.reset ();
+  }
+
+} // namespace
+
+// memory cap in KiB: smaller than the working set (~30000 keys), then large enough
+BENCHMARK (BM_SunCacheGet)
+    ->Arg (256)
+    ->Arg (8192)
+    ->ThreadRange (1, 8)
+    ->Setup (setupCache)
+    ->Teardown (teardownCache)
+    ->UseRealTime ();
@@ -0,0 +1,94 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/SunEngine.hpp>
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace {
+
+  struct Query {
+    int year, month, day;
+    double lat, lon;
+  };
+
+  const std::vector<Query>& queries () {
+    static const std::vector<Query> q = [] {
+      std::vector<Query> v (1 << 14);
+      std::mt19937 rng (11);
+      std::uniform_int_distribution<int> year (1801, 2099), month (1, 12), day (1, 28);
+      std::uniform_real_distribution<double> lat (-89.0, 89.0), lon (-180.0, 180.0);
+      for (auto& x : v)
+        x = { year (rng), month (rng), day (rng), lat (rng), lon (rng) };
+      return v;
+    }();
+    return q;
+  }
+
+  // Max and RMS deviation from the reference engine in seconds, rise/set/day length
+  void reportError (benchmark::State& state, dotname::SunEngine engine) {
+    double worst = 0.0, sum = 0.0;
+    std::size_t n = 0;
+    for (const auto& q : queries ()) {
+      double r0, s0, r1, s1;
+      int rc0 = dotname::sunriset (dotname::SunEngine::Reference, q.year, q.month, q.day, q.lon,
+                                   q.lat, -35.0 / 60.0, 1, &r0, &s0);
+      int rc1 = dotname::sunriset (engine, q.year, q.month, q.day, q.lon, q.lat, -35.0 / 60.0, 1,
+                                   &r1, &s1);
+      if (rc0 != rc1)
+        continue;
+      double e = std::max (std::fabs (r0 - r1), std::fabs (s0 - s1)) * 3600.0;
+      worst = std::max (worst, e);
+      sum += e * e;
+      ++n;
+    }
+    state.counters["max_err_s"] = worst;
+    state.counters["rms_err_s"] = n ? std::sqrt (sum / n) : 0.0;
+  }
+
+  void BM_SunEngineSunriset (benchmark::State& state) {
+    auto engine = static_cast<dotname::SunEngine> (state.range (0));
+    const auto& q = queries ();
+    double rise, set;
+    dotname::sunriset (engine, 2000, 1, 1, 0.0, 0.0, -35.0 / 60.0, 1, &rise, &set); // warm up
+    std::size_t i = 0;
+    for (auto _ : state) {
+      const Query& x = q[i++ & (q.size () - 1)];
+      benchmark::DoNotOptimize (dotname::sunriset (engine, x.year, x.month, x.day, x.lon, x.lat,
+                                                   -35.0 / 60.0, 1, &rise, &set));
+      benchmark::DoNotOptimize (rise);
+    }
+    state.SetLabel (dotname::sunEngineName (engine));
+    state.counters["calls/s"] = benchmark::Counter (static_cast<double> (state.iterations ()),
+                                                    benchmark::Counter::kIsRate);
+    reportError (state, engine);
+  }
+
+  void BM_SunEngineDaylen (benchmark::State& state) {
+    auto engine = static_cast<dotname::SunEngine> (state.range (0));
+    const auto& q = queries ();
+    std::size_t i = 0;
+    for (auto _ : state) {
+      const Query& x = q[i++ & (q.size () - 1)];
+      benchmark::DoNotOptimize (
+          dotname::daylen (engine, x.year, x.month, x.day, x.lon, x.lat, -35.0 / 60.0, 1));
+    }
+    state.SetLabel (dotname::sunEngineName (engine));
+    state.counters["calls/s"] = benchmark::Counter (static_cast<double> (state.iterations ()),
+                                                    benchmark::Counter::kIsRate);
+  }
+
+  void engineArgs (benchmark::internal::Benchmark* b) {
+    for (auto engine : { dotname::SunEngine::Reference, dotname::SunEngine::EphemerisTable,
+                         dotname::SunEngine::FastMath })
+      b->Arg (static_cast<int> (engine));
+  }
+
+} // namespace
+
+BENCHMARK (BM_SunEngineSunriset)->Apply (engineArgs);
+BENCHMARK (BM_SunEngineDaylen)->Apply (engineArgs);
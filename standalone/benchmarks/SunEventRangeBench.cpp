@@ -0,0 +1,51 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/SunEventRange.hpp>
+#include <SunrisetWorker/SunrisetBatch.hpp>
+#include <benchmark/benchmark.h>
+
+extern "C" {
+#include "SunrisetC/sunriset.h"
+}
+
+namespace {
+
+  const int kFrom = dotname::dayNumber (2000, 1, 1);
+  const int kTo = dotname::dayNumber (2099, 12, 31);
+
+  // 100 years, one independent sun_rise_set per day
+  void BM_Century_PerDayCall (benchmark::State& state) {
+    for (auto _ : state) {
+      double sum = 0.0;
+      for (int day = kFrom; day <= kTo; ++day) {
+        double rise, set;
+        sun_rise_set (2000, 1, day, 14.4378, 50.0755, &rise, &set);
+        sum += rise + set;
+      }
+      benchmark::DoNotOptimize (sum);
+    }
+    state.counters["days/s"]
+        = benchmark::Counter (static_cast<double> (state.iterations ()) * (kTo - kFrom + 1),
+                              benchmark::Counter::kIsRate);
+  }
+
+  // 100 years, incremental stepping
+  void BM_Century_SunEventRange (benchmark::State& state) {
+    for (auto _ : state) {
+      double sum = 0.0;
+      for (const auto& ev : dotname::SunEventRange (50.0755, 14.4378, kFrom, kTo,
+                                                    dotname::SunAltitudes::RiseSet,
+                                                    static_cast<int> (state.range (0))))
+        sum += ev.rise + ev.set;
+      benchmark::DoNotOptimize (sum);
+    }
+    state.counters["days/s"]
+        = benchmark::Counter (static_cast<double> (state.iterations ()) * (kTo - kFrom + 1),
+                              benchmark::Counter::kIsRate);
+  }
+
+} // namespace
+
+BENCHMARK (BM_Century_PerDayCall)->Unit (benchmark::kMillisecond);
+BENCHMARK (BM_Century_SunEventRange)->Arg (16)->Arg (64)->Arg (365)->Unit (benchmark::kMillisecond);
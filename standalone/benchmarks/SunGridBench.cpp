@@ -0,0 +1,66 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/SunGrid.hpp>
+#include <SunrisetWorker/SunrisetBatch.hpp>
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <thread>
+
+namespace {
+
+  // whole world at 0.25 degrees, rise/set and civil twilight, one day
+  dotname::SunGridSpec world () {
+    dotname::SunGridSpec spec;
+    spec.resolution = 0.25;
+    spec.fromDay = spec.toDay = dotname::dayNumber (2025, 3, 20);
+    spec.altitudes = { dotname::SunAltitudes::RiseSet, dotname::SunAltitudes::CivilTwilight };
+    return spec;
+  }
+
+  // Scaling from 1 to N threads. efficiency = T(1) / (N * T(N)), T(1) is taken from the
+  // engine argument's 1 thread run, which the argument list runs first.
+  void BM_SunGridScaling (benchmark::State& state) {
+    static std::map<long, double> single;
+    auto spec = world ();
+    spec.engine = static_cast<dotname::SunEngine> (state.range (0));
+    auto threads = static_cast<unsigned> (state.range (1));
+    dotname::SunGridEngine engine (threads);
+    engine.compute (spec); // warm up the pool, arena and ephemeris table
+
+    double seconds = 0.0;
+    for (auto _ : state) {
+      auto t0 = std::chrono::steady_clock::now ();
+      benchmark::DoNotOptimize (engine.compute (spec));
+      seconds += std::chrono::duration<double> (std::chrono::steady_clock::now () - t0).count ();
+    }
+    double perRun = seconds / static_cast<double> (state.iterations ());
+    if (threads == 1)
+      single[state.range (0)] = perRun;
+
+    state.SetLabel (dotname::sunEngineName (spec.engine));
+    state.counters["cells/s"] = benchmark::Counter (
+        static_cast<double> (spec.size () * state.iterations ()), benchmark::Counter::kIsRate);
+    auto it = single.find (state.range (0));
+    if (it != single.end ())
+      state.counters["efficiency"] = it->second / (threads * perRun);
+  }
+
+  void scalingArgs (benchmark::internal::Benchmark* b) {
+    unsigned cores = std::max (1u, std::thread::hardware_concurrency ());
+    for (auto engine : { dotname::SunEngine::Reference, dotname::SunEngine::FastMath }) {
+      for (unsigned t = 1; t < cores; t *= 2)
+        b->Args ({ static_cast<long> (engine), t });
+      b->Args ({ static_cast<long> (engine), cores });
+    }
+  }
+
+} // namespace
+
+BENCHMARK (BM_SunGridScaling)
+    ->Apply (scalingArgs)
+    ->Unit (benchmark::kMillisecond)
+    ->UseRealTime ();
@@ -0,0 +1,76 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/SunGridFile.hpp>
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <random>
+#include <vector>
+
+extern "C" {
+#include "SunrisetC/sunriset.h"
+}
+
+namespace {
+
+  struct Query {
+    int year, month, day;
+    double lat, lon;
+  };
+
+  const std::vector<Query>& queries () {
+    static const std::vector<Query> q = [] {
+      std::vector<Query> v (1 << 14);
+      std::mt19937 rng (17);
+      std::uniform_int_distribution<int> year (2020, 2040), month (1, 12), day (1, 28);
+      std::uniform_real_distribution<double> lat (-60.0, 60.0), lon (-180.0, 180.0);
+      for (auto& x : v)
+        x = { year (rng), month (rng), day (rng), lat (rng), lon (rng) };
+      return v;
+    }();
+    return q;
+  }
+
+  const dotname::SunGridFile& grid () {
+    static const dotname::SunGridFile g = [] {
+      auto path = std::filesystem::temp_directory_path () / "SunGridFileBench.bin";
+      dotname::buildSunGridFile (path, {});
+      return dotname::SunGridFile (path);
+    }();
+    return g;
+  }
+
+  void BM_SunGridFileLookup (benchmark::State& state) {
+    const auto& g = grid ();
+    const auto& q = queries ();
+    double rise, set;
+    std::size_t i = 0;
+    for (auto _ : state) {
+      const Query& x = q[i++ & (q.size () - 1)];
+      benchmark::DoNotOptimize (g.sunriset (x.year, x.month, x.day, x.lon, x.lat, &rise, &set));
+      benchmark::DoNotOptimize (rise);
+    }
+    state.counters["calls/s"] = benchmark::Counter (static_cast<double> (state.iterations ()),
+                                                    benchmark::Counter::kIsRate);
+    state.counters["max_err_s"] = g.header ().maxErrorSeconds;
+  }
+
+  void BM_SunGridFileReference (benchmark::State& state) {
+    const auto& q = queries ();
+    double rise, set;
+    std::size_t i = 0;
+    for (auto _ : state) {
+      const Query& x = q[i++ & (q.size () - 1)];
+      benchmark::DoNotOptimize (__sunriset__ (x.year, x.month, x.day, x.lon, x.lat,
+                                              -35.0 / 60.0, 1, &rise, &set));
+      benchmark::DoNotOptimize (rise);
+    }
+    state.counters["calls/s"] = benchmark::Counter (static_cast<double> (state.iterations ()),
+                                                    benchmark::Counter::kIsRate);
+  }
+
+} // namespace
+
+BENCHMARK (BM_SunGridFileLookup);
+BENCHMARK (BM_SunGridFileReference);
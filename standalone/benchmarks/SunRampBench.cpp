@@ -0,0 +1,52 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/SunRamp.hpp>
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+
+namespace {
+
+  using Clock = std::chrono::system_clock;
+
+  // the once per date work: ephemeris, 1440 elevation samples, change points
+  void BM_RampPlan (benchmark::State& state) {
+    dotname::SunRamp ramp (50.0755, 14.4378, 60, {});
+    long day = ramp.localDay (Clock::now ());
+    for (auto _ : state)
+      benchmark::DoNotOptimize (ramp.plan (day++).data ());
+  }
+
+  // A caller polling every second for a day against one woken by nextAt (): the writes
+  // are the same, the polling one pays an upper_bound per second
+  void BM_RampDayPolling (benchmark::State& state) {
+    std::uint64_t writes = 0;
+    for (auto _ : state) {
+      dotname::SunRamp ramp (50.0755, 14.4378, 60, {});
+      auto from = Clock::time_point (std::chrono::hours (24 * 20167)); // 2025-03-20
+      for (int second = 0; second < 86400; ++second)
+        writes += ramp.fire (from + std::chrono::seconds (second), [] (double) {});
+    }
+    state.counters["writes/day"] = benchmark::Counter (
+        static_cast<double> (writes) / static_cast<double> (state.iterations ()));
+  }
+
+  void BM_RampDayTimer (benchmark::State& state) {
+    std::uint64_t writes = 0;
+    for (auto _ : state) {
+      dotname::SunRamp ramp (50.0755, 14.4378, 60, {});
+      auto from = Clock::time_point (std::chrono::hours (24 * 20167));
+      writes += ramp.fire (from, [] (double) {});
+      for (auto t = ramp.nextAt (); t < from + std::chrono::hours (24); t = ramp.nextAt ())
+        writes += ramp.fire (t, [] (double) {});
+    }
+    state.counters["writes/day"] = benchmark::Counter (
+        static_cast<double> (writes) / static_cast<double> (state.iterations ()));
+  }
+
+} // namespace
+
+BENCHMARK (BM_RampPlan)->Unit (benchmark::kMicrosecond);
+BENCHMARK (BM_RampDayPolling)->Unit (benchmark::kMillisecond);
+BENCHMARK (BM_RampDayTimer)->Unit (benchmark::kMicrosecond);
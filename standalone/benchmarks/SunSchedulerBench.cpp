@@ -0,0 +1,166 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/SunScheduler.hpp>
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace {
+
+  using Clock = std::chrono::system_clock;
+
+  // 2025-03-20 00:00 UTC, a day window boundary
+  const Clock::time_point kDayStart = Clock::from_time_t (1742428800);
+
+  const std::vector<dotname::SunStateParams>& params () {
+    static const std::vector<dotname::SunStateParams> p = [] {
+      std::vector<dotname::SunStateParams> v (100000);
+      std::mt19937 rng (15);
+      std::uniform_real_distribution<double> lat (-65.0, 65.0), lon (-180.0, 180.0);
+      std::uniform_int_distribution<int> offset (-60, 60);
+      for (auto& x : v) {
+        x.lat = lat (rng);
+        x.lon = lon (rng);
+        x.utcOffsetMinutes = static_cast<int> (x.lon / 15.0) * 60;
+        x.riseOffsetMinutes = offset (rng);
+        x.setOffsetMinutes = offset (rng);
+      }
+      return v;
+    }();
+    return p;
+  }
+
+  std::unique_ptr<dotname::SunScheduler> build (std::size_t n, std::size_t& fired) {
+    auto scheduler = std::make_unique<dotname::SunScheduler> (
+        [&fired] (const dotname::SunScheduleEvent&) { ++fired; });
+    for (std::size_t i = 0; i < n; ++i)
+      scheduler->add (params ()[i], kDayStart);
+    return scheduler;
+  }
+
+  // items_per_second is operations per second, per schedule or per transition
+  void perOperation (benchmark::State& state, std::size_t operations) {
+    state.SetItemsProcessed (static_cast<std::int64_t> (operations));
+  }
+
+  // add () of n schedules: one state and one window computation each plus a heap push
+  void BM_SchedulerInsert (benchmark::State& state) {
+    const auto n = static_cast<std::size_t> (state.range (0));
+    std::size_t fired = 0;
+    for (auto _ : state) {
+      auto scheduler = build (n, fired);
+      state.PauseTiming (); // destruction is not part of it
+      scheduler.reset ();
+      state.ResumeTiming ();
+    }
+    perOperation (state, n * state.iterations ());
+  }
+
+  // remove () of n schedules in random order from a full heap
+  void BM_SchedulerCancel (benchmark::State& state) {
+    const auto n = static_cast<std::size_t> (state.range (0));
+    std::vector<dotname::SunScheduleId> order (n);
+    for (std::size_t i = 0; i < n; ++i)
+      order[i] = static_cast<dotname::SunScheduleId> (i);
+    std::shuffle (order.begin (), order.end (), std::mt19937 (7));
+    std::size_t fired = 0;
+    for (auto _ : state) {
+      state.PauseTiming ();
+      auto scheduler = build (n, fired);
+      state.ResumeTiming ();
+      for (auto id : order)
+        scheduler->remove (id);
+      state.PauseTiming ();
+      scheduler.reset ();
+      state.ResumeTiming ();
+    }
+    perOperation (state, n * state.iterations ());
+  }
+
+  // fire () through one day in one minute steps, per transition reaching the callback
+  // (the popped midnight confirmations are part of the cost)
+  void BM_SchedulerFire (benchmark::State& state) {
+    const auto n = static_cast<std::size_t> (state.range (0));
+    std::size_t fired = 0, events = 0;
+    for (auto _ : state) {
+      state.PauseTiming ();
+      auto scheduler = build (n, fired);
+      fired = 0;
+      state.ResumeTiming ();
+      for (auto now = kDayStart; now < kDayStart + std::chrono::hours (24);
+           now += std::chrono::minutes (1))
+        scheduler->fire (now);
+      state.PauseTiming ();
+      events += fired;
+      scheduler.reset ();
+      state.ResumeTiming ();
+    }
+    perOperation (state, events);
+    state.counters["transitions/day"] = static_cast<double> (events) / state.iterations () / n;
+  }
+
+  // the day boundary: every schedule recomputed in one sunrisetBatch () pass, heap rebuilt
+  void BM_SchedulerDayRecompute (benchmark::State& state) {
+    const auto n = static_cast<std::size_t> (state.range (0));
+    std::size_t fired = 0;
+    for (auto _ : state) {
+      state.PauseTiming ();
+      auto scheduler = build (n, fired);
+      scheduler->fire (kDayStart + std::chrono::hours (24) - std::chrono::nanoseconds (1));
+      state.ResumeTiming ();
+      scheduler->fire (kDayStart + std::chrono::hours (24));
+      state.PauseTiming ();
+      scheduler.reset ();
+      state.ResumeTiming ();
+    }
+    perOperation (state, n * state.iterations ());
+  }
+
+  // A zone change with 100 local schedules among n fixed ones: only the local ones are
+  // recomputed, each requeued in O(log n); items are the local schedules
+  void BM_SchedulerZoneChange (benchmark::State& state) {
+    const auto n = static_cast<std::size_t> (state.range (0));
+    constexpr std::size_t kLocal = 100;
+    int offset = 60;
+    std::size_t fired = 0;
+    dotname::SunScheduler scheduler ([&fired] (const dotname::SunScheduleEvent&) { ++fired; },
+                                     [&offset] (Clock::time_point) { return offset; });
+    for (std::size_t i = 0; i < n; ++i)
+      scheduler.add (params ()[i], kDayStart);
+    for (std::size_t i = 0; i < kLocal; ++i)
+      scheduler.addLocal (params ()[n + i], kDayStart);
+    const auto now = kDayStart + std::chrono::hours (12);
+    scheduler.fire (now);
+    for (auto _ : state) {
+      offset = offset == 60 ? 120 : 60;
+      scheduler.zoneChanged (now);
+    }
+    perOperation (state, kLocal * state.iterations ());
+  }
+
+  // A clock step or resume: every schedule resynchronized, same cost as a day recompute
+  void BM_SchedulerClockChange (benchmark::State& state) {
+    const auto n = static_cast<std::size_t> (state.range (0));
+    std::size_t fired = 0;
+    auto scheduler = build (n, fired);
+    auto now = kDayStart + std::chrono::hours (12);
+    for (auto _ : state) {
+      now += std::chrono::minutes (1);
+      scheduler->clockChanged (now);
+    }
+    perOperation (state, n * state.iterations ());
+  }
+
+} // namespace
+
+BENCHMARK (BM_SchedulerInsert)->Arg (10000)->Arg (100000)->Unit (benchmark::kMillisecond);
+BENCHMARK (BM_SchedulerCancel)->Arg (10000)->Arg (100000)->Unit (benchmark::kMillisecond);
+BENCHMARK (BM_SchedulerFire)->Arg (10000)->Arg (100000)->Unit (benchmark::kMillisecond);
+BENCHMARK (BM_SchedulerDayRecompute)->Arg (10000)->Arg (100000)->Unit (benchmark::kMillisecond);
+BENCHMARK (BM_SchedulerZoneChange)->Arg (10000)->Arg (99900)->Unit (benchmark::kMicrosecond);
+BENCHMARK (BM_SchedulerClockChange)->Arg (10000)->Arg (100000)->Unit (benchmark::kMillisecond);
@@ -0,0 +1,54 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/SunState.hpp>
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace {
+
+  const std::vector<dotname::SunStateParams>& params () {
+    static const std::vector<dotname::SunStateParams> p = [] {
+      std::vector<dotname::SunStateParams> v (1 << 12);
+      std::mt19937 rng (29);
+      std::uniform_real_distribution<double> lat (-65.0, 65.0), lon (-180.0, 180.0);
+      std::uniform_int_distribution<int> offset (-60, 60);
+      for (auto& x : v) {
+        x.lat = lat (rng);
+        x.lon = lon (rng);
+        x.utcOffsetMinutes = static_cast<int> (x.lon / 15.0) * 60;
+        x.riseOffsetMinutes = offset (rng);
+        x.setOffsetMinutes = offset (rng);
+      }
+      return v;
+    }();
+    return p;
+  }
+
+  // Stress: every thread builds engines for its own users and queries them, nothing is
+  // shared but the read-only parameter table. calls/s per thread should stay flat.
+  void BM_SunStateStress (benchmark::State& state) {
+    const auto& p = params ();
+    std::size_t i = static_cast<std::size_t> (state.thread_index ()) * 997;
+    double hours = 0.0;
+    for (auto _ : state) {
+      dotname::SunStateEngine engine (p[i++ & (p.size () - 1)]);
+      hours = hours < 23.0 ? hours + 0.37 : 0.0;
+      benchmark::DoNotOptimize (engine.compute (2025, 1 + static_cast<int> (i % 12), 15, hours));
+    }
+    // counters are summed over the threads: calls/s is the total throughput
+    state.counters["calls/s"] = benchmark::Counter (static_cast<double> (state.iterations ()),
+                                                    benchmark::Counter::kIsRate);
+    state.counters["calls/s/thread"] = benchmark::Counter (
+        static_cast<double> (state.iterations ()), benchmark::Counter::kAvgThreadsRate);
+  }
+
+} // namespace
+
+BENCHMARK (BM_SunStateStress)
+    ->ThreadRange (1, static_cast<int> (std::max (1u, std::thread::hardware_concurrency ())))
+    ->UseRealTime ();
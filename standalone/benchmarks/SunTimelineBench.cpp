@@ -0,0 +1,61 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/SunTimeline.hpp>
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace {
+
+  using Clock = std::chrono::system_clock;
+
+  // n rules on the seven predefined elevations, both crossings, spread offsets
+  std::vector<dotname::SunRule> rules (int n) {
+    const dotname::SunAltitude altitudes[]
+        = { dotname::SunAltitudes::RiseSet,           dotname::SunAltitudes::DayLength,
+            dotname::SunAltitudes::CivilTwilight,     dotname::SunAltitudes::NauticalTwilight,
+            dotname::SunAltitudes::AstronomicalTwilight, dotname::SunAltitudes::GoldenHour,
+            dotname::SunAltitudes::BlueHour };
+    std::vector<dotname::SunRule> v;
+    for (int i = 0; i < n; ++i)
+      v.push_back (
+          { altitudes[i % 7], i % 2 == 0, (i / 14) * 5, "action" + std::to_string (i % 5) });
+    return v;
+  }
+
+  // one daily plan: a sunCrossings () pass, sort and dedup
+  void BM_TimelinePlan (benchmark::State& state) {
+    auto list = rules (static_cast<int> (state.range (0)));
+    dotname::SunTimeline timeline (50.0755, 14.4378, 60, list);
+    long day = timeline.localDay (Clock::now ());
+    for (auto _ : state)
+      benchmark::DoNotOptimize (timeline.plan (day++).data ());
+    state.counters["plans/s"] = benchmark::Counter (
+        static_cast<double> (state.iterations ()), benchmark::Counter::kIsRate);
+  }
+
+  // a timer waking every minute for a year: the cost per fire () does not grow with the
+  // number of calls, a plan per date and nothing else
+  void BM_TimelineFireYear (benchmark::State& state) {
+    auto list = rules (static_cast<int> (state.range (0)));
+    std::size_t fired = 0, calls = 0;
+    for (auto _ : state) {
+      dotname::SunTimeline timeline (50.0755, 14.4378, 60, list);
+      auto t = Clock::time_point (std::chrono::hours (24 * 20089)); // 2025-01-01
+      auto end = t + std::chrono::hours (24 * 365);
+      for (; t < end; t += std::chrono::minutes (1), ++calls)
+        fired += timeline.fire (t, [] (const dotname::SunPlanEntry&) {});
+    }
+    state.counters["fires/s"]
+        = benchmark::Counter (static_cast<double> (calls), benchmark::Counter::kIsRate);
+    state.counters["actions"] = benchmark::Counter (static_cast<double> (fired)
+                                                    / static_cast<double> (state.iterations ()));
+  }
+
+} // namespace
+
+BENCHMARK (BM_TimelinePlan)->Arg (4)->Arg (16)->Arg (64)->Unit (benchmark::kMicrosecond);
+BENCHMARK (BM_TimelineFireYear)->Arg (4)->Arg (64)->Unit (benchmark::kMillisecond);
@@ -0,0 +1,61 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/SunrisetBatch.hpp>
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+namespace {
+
+  constexpr std::size_t kPoints = 1 << 16;
+
+  template <typename T> struct Input {
+    std::vector<int> days;
+    std::vector<T> lat, lon, rise, set;
+    std::vector<int> rc;
+
+    Input ()
+        : days (kPoints), lat (kPoints), lon (kPoints), rise (kPoints), set (kPoints),
+          rc (kPoints) {
+      std::mt19937 rng (7);
+      std::uniform_int_distribution<int> day (dotname::dayNumber (1900, 1, 1),
+                                              dotname::dayNumber (2099, 12, 31));
+      std::uniform_real_distribution<double> la (-66.0, 66.0), lo (-180.0, 180.0);
+      for (std::size_t i = 0; i < kPoints; ++i) {
+        days[i] = day (rng);
+        lat[i] = static_cast<T> (la (rng));
+        lon[i] = static_cast<T> (lo (rng));
+      }
+    }
+  };
+
+  template <typename T> void BM_SunrisetBatch (benchmark::State& state) {
+    static Input<T> in;
+    auto isa = static_cast<dotname::SimdIsa> (state.range (0));
+    if (isa > dotname::detectSimdIsa ()) {
+      state.SkipWithError ("ISA not supported by this CPU");
+      return;
+    }
+    for (auto _ : state) {
+      dotname::sunRiseSetBatch (in.days.data (), in.lat.data (), in.lon.data (), kPoints,
+                                in.rise.data (), in.set.data (), in.rc.data (), isa);
+      benchmark::DoNotOptimize (in.rise.data ());
+      benchmark::ClobberMemory ();
+    }
+    state.SetLabel (dotname::simdIsaName (isa));
+    state.counters["points/s"] = benchmark::Counter (
+        static_cast<double> (state.iterations ()) * kPoints, benchmark::Counter::kIsRate);
+  }
+
+  void isaArgs (benchmark::internal::Benchmark* b) {
+    for (auto isa : { dotname::SimdIsa::Scalar, dotname::SimdIsa::Sse2, dotname::SimdIsa::Avx2,
+                      dotname::SimdIsa::Avx512 })
+      b->Arg (static_cast<int> (isa));
+  }
+
+} // namespace
+
+BENCHMARK_TEMPLATE (BM_SunrisetBatch, double)->Apply (isaArgs);
+BENCHMARK_TEMPLATE (BM_SunrisetBatch, float)->Apply (isaArgs);
@@ -0,0 +1,77 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/TimeZoneIndex.hpp>
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+namespace {
+
+  struct Points {
+    std::vector<double> lat, lon;
+
+    explicit Points (std::size_t n) : lat (n), lon (n) {
+      std::mt19937 rng (5);
+      std::uniform_real_distribution<double> a (-90.0, 90.0), b (-180.0, 180.0);
+      for (std::size_t i = 0; i < n; ++i) {
+        lat[i] = a (rng);
+        lon[i] = b (rng);
+      }
+    }
+  };
+
+  const Points& points () {
+    static const Points p (1 << 20);
+    return p;
+  }
+
+  // one point against every location, what the worker does at startup
+  void BM_TimeZoneAt (benchmark::State& state) {
+    const Points& p = points ();
+    std::size_t i = 0;
+    for (auto _ : state) {
+      benchmark::DoNotOptimize (dotname::timeZoneAt (p.lat[i], p.lon[i]));
+      i = (i + 1) & (p.lat.size () - 1);
+    }
+    state.SetItemsProcessed (state.iterations ());
+  }
+
+  void BM_TimeZoneIndexBuild (benchmark::State& state) {
+    for (auto _ : state) {
+      dotname::TimeZoneIndex index (1.0, static_cast<unsigned> (state.range (0)));
+      benchmark::DoNotOptimize (index.candidates ());
+    }
+  }
+
+  void BM_TimeZoneIndexLookup (benchmark::State& state) {
+    const dotname::TimeZoneIndex index;
+    const Points& p = points ();
+    std::size_t i = 0;
+    for (auto _ : state) {
+      benchmark::DoNotOptimize (index.lookup (p.lat[i], p.lon[i]));
+      i = (i + 1) & (p.lat.size () - 1);
+    }
+    state.SetItemsProcessed (state.iterations ());
+    state.counters["candidates/cell"]
+        = static_cast<double> (index.candidates ()) / static_cast<double> (index.cells ());
+  }
+
+  // 1M points of a grid export, split over range (0) threads
+  void BM_TimeZoneIndexBatch (benchmark::State& state) {
+    const dotname::TimeZoneIndex index;
+    const Points& p = points ();
+    std::vector<dotname::TimeZoneId> zones (p.lat.size ());
+    for (auto _ : state)
+      index.lookup (p.lat.data (), p.lon.data (), p.lat.size (), zones.data (),
+                    static_cast<unsigned> (state.range (0)));
+    state.SetItemsProcessed (state.iterations () * static_cast<std::int64_t> (p.lat.size ()));
+  }
+
+} // namespace
+
+BENCHMARK (BM_TimeZoneAt);
+BENCHMARK (BM_TimeZoneIndexBuild)->Arg (1)->Arg (0)->Unit (benchmark::kMillisecond);
+BENCHMARK (BM_TimeZoneIndexLookup);
+BENCHMARK (BM_TimeZoneIndexBatch)->Arg (1)->Arg (0)->Unit (benchmark::kMillisecond)->UseRealTime ();
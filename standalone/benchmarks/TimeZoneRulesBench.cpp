@@ -0,0 +1,119 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/SunrisetBatch.hpp>
+#include <SunrisetWorker/TimeZoneRules.hpp>
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <random>
+#include <vector>
+
+namespace {
+
+  // random instants 1990..2050
+  const std::vector<std::int64_t>& instants () {
+    static const std::vector<std::int64_t> t = [] {
+      std::vector<std::int64_t> v (1 << 16);
+      std::mt19937_64 rng (7);
+      std::uniform_int_distribution<std::int64_t> d (631152000, 2524608000);
+      for (auto& x : v)
+        x = d (rng);
+      return v;
+    }();
+    return t;
+  }
+
+  const dotname::TimeZoneRules* prague () {
+    return dotname::timeZoneRules ("Europe/Prague");
+  }
+
+  void BM_TimeZoneRulesLoad (benchmark::State& state) {
+    const auto file = dotname::zoneinfoDir () / "Europe/Prague";
+    for (auto _ : state) {
+      dotname::TimeZoneRules rules;
+      benchmark::DoNotOptimize (rules.load (file));
+    }
+  }
+
+  void BM_TimeZoneRulesLookup (benchmark::State& state) {
+    const dotname::TimeZoneRules* rules = prague ();
+    if (!rules) {
+      state.SkipWithError ("no tz database");
+      return;
+    }
+    const auto& t = instants ();
+    std::size_t i = 0;
+    for (auto _ : state) {
+      benchmark::DoNotOptimize (rules->offsetSecondsAt (t[i]));
+      i = (i + 1) & (t.size () - 1);
+    }
+    state.SetItemsProcessed (state.iterations ());
+  }
+
+  // the C library with TZ set once, the per-value cost of a localtime_r () loop
+  void BM_LocaltimeLookup (benchmark::State& state) {
+    setenv ("TZ", ":Europe/Prague", 1);
+    tzset ();
+    const auto& t = instants ();
+    std::size_t i = 0;
+    for (auto _ : state) {
+      std::time_t time = static_cast<std::time_t> (t[i]);
+      std::tm tm;
+      benchmark::DoNotOptimize (localtime_r (&time, &tm)->tm_gmtoff);
+      i = (i + 1) & (t.size () - 1);
+    }
+    state.SetItemsProcessed (state.iterations ());
+    unsetenv ("TZ");
+    tzset ();
+  }
+
+  // two zones side by side through the C library: TZ switched for every value
+  void BM_LocaltimeSetenvChurn (benchmark::State& state) {
+    const char* zones[] = { ":Europe/Prague", ":Australia/Sydney" };
+    const auto& t = instants ();
+    std::size_t i = 0;
+    for (auto _ : state) {
+      setenv ("TZ", zones[i & 1], 1);
+      tzset ();
+      std::time_t time = static_cast<std::time_t> (t[i]);
+      std::tm tm;
+      benchmark::DoNotOptimize (localtime_r (&time, &tm)->tm_gmtoff);
+      i = (i + 1) & (t.size () - 1);
+    }
+    state.SetItemsProcessed (state.iterations ());
+    unsetenv ("TZ");
+    tzset ();
+  }
+
+  // 1M UT results of a date range (16 locations x 65536 days, ascending) to local hours
+  void BM_TimeZoneRulesToLocalHours (benchmark::State& state) {
+    const dotname::TimeZoneRules* rules = prague ();
+    if (!rules) {
+      state.SkipWithError ("no tz database");
+      return;
+    }
+    constexpr std::size_t kCount = 1 << 20;
+    std::vector<int> days (kCount);
+    std::vector<double> ut (kCount), local (kCount);
+    const int first = dotname::dayNumber (1950, 1, 1);
+    for (std::size_t i = 0; i < kCount; ++i) {
+      days[i] = first + static_cast<int> (i / 16);
+      ut[i] = 3.0 + static_cast<double> (i % 16);
+    }
+    for (auto _ : state) {
+      rules->toLocalHours (days.data (), ut.data (), kCount, local.data ());
+      benchmark::DoNotOptimize (local.data ());
+    }
+    state.SetItemsProcessed (state.iterations () * static_cast<std::int64_t> (kCount));
+  }
+
+} // namespace
+
+BENCHMARK (BM_TimeZoneRulesLoad);
+BENCHMARK (BM_TimeZoneRulesLookup);
+BENCHMARK (BM_LocaltimeLookup);
+BENCHMARK (BM_LocaltimeSetenvChurn);
+BENCHMARK (BM_TimeZoneRulesToLocalHours)->Unit (benchmark::kMillisecond);
@@ -0,0 +1,33 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <Trace/Trace.hpp>
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+
+namespace {
+
+  // What every instrumented phase pays in a run without --trace
+  void BM_TraceSpanDisabled (benchmark::State& state) {
+    for (auto _ : state) {
+      TRACE_SPAN ("phase");
+      benchmark::ClobberMemory ();
+    }
+  }
+
+  // The iterations stay under kTraceMaxEvents so every span is recorded; nothing is
+  // flushed, disable () drops the spans again
+  void BM_TraceSpanEnabled (benchmark::State& state) {
+    dotname::Trace::enable (std::filesystem::temp_directory_path () / "followsun-bench.json");
+    for (auto _ : state) {
+      TRACE_SPAN ("phase");
+      benchmark::ClobberMemory ();
+    }
+    dotname::Trace::disable ();
+  }
+
+} // namespace
+
+BENCHMARK (BM_TraceSpanDisabled);
+BENCHMARK (BM_TraceSpanEnabled)->Iterations (1 << 18);
@@ -1,15 +1,25 @@
 // MIT License
 // Copyright (c) 2024-2025 Tomáš Mark
 
+#include "SunrisetWorker/ClockWatch.hpp"
+#include "SunrisetWorker/ConfigStore.hpp"
+#include "SunrisetWorker/EventLoop.hpp"
+#include "SunrisetWorker/SessionEvents.hpp"
+#include "SunrisetWorker/SunGridFile.hpp"
 #include "SunrisetWorker/SunrisetWorker.hpp"
 #include "Logger/Logger.hpp"
+#include "Trace/Trace.hpp"
 #include "Utils/Utils.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <csignal>
 #include <cxxopts.hpp>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -17,6 +27,10 @@
   #include <emscripten/emscripten.h>
 #endif
 
+#if defined(__linux__)
+  #include <cstring>
+#endif
+
 using namespace DotNameUtils;
 
 namespace AppContext {
@@ -31,7 +45,128 @@ namespace AppContext {
 
 std::unique_ptr<dotname::SunrisetWorker> uniqueLib;
 
+#if defined(__linux__)
+// Every concern of the daemon is a task on one EventLoop, all on this thread. The sun task
+// sleeps until the next light/dark transition or local midnight, whichever comes first, on
+// a CLOCK_REALTIME timer. The other tasks cut that sleep short so the schedule is
+// recomputed: a settime / NTP step, a resume or a replaced /etc/localtime (ClockWatch),
+// an edit of config.json (inotify, applied without a restart) and screen unlock or resume
+// from suspend (D-Bus). SIGINT / SIGTERM arrive through a signalfd and end the loop.
+dotname::Task sunTask (dotname::SunrisetWorker& worker, dotname::LoopTimer& wake) {
+  using namespace std::chrono;
+  for (;;) {
+    const auto cycleStart = dotname::Trace::now ();
+    const auto now = system_clock::now ();
+    const dotname::SunStateEngine engine (worker.stateParams (now));
+    const dotname::SunState state = engine.stateAt (now);
+    // the worker remembers the applied theme, wakeups without a transition write nothing
+    if (worker.applyTheme (state.isDay))
+      LOG_I_STREAM << "Switched to " << (state.isDay ? "light" : "dark") << " theme" << std::endl;
+
+    // midnight bounds the wait, the triggers of the next date are recomputed there
+    auto at = engine.nextMidnight (now);
+    const dotname::SunTransition next = engine.nextTransition (now);
+    if (next.found)
+      at = std::min (at, next.at);
+    const auto wait = duration_cast<minutes> (at - now).count ();
+    LOG_D_STREAM << "Sleeping " << wait / 60 << " h " << wait % 60 << " min" << std::endl;
+    dotname::Trace::complete ("daemon cycle", cycleStart, dotname::Trace::now ());
+    co_await wake.until (at);
+  }
+}
+
+dotname::Task signalTask (dotname::EventLoop& loop, const dotname::SignalSet& signals) {
+  int signo = co_await loop.signal (signals);
+  if (signo > 0)
+    LOG_I_STREAM << "Received " << strsignal (signo) << std::endl;
+  loop.stop (signo > 0 ? 0 : 1);
+  co_return 0;
+}
+
+dotname::Task configTask (dotname::EventLoop& loop, dotname::ConfigWatcher& watcher,
+                          dotname::SunrisetWorker& worker, dotname::LoopTimer& wake) {
+  if (watcher.fd () < 0)
+    co_return 0; // no inotify
+  for (;;) {
+    int events = co_await loop.wait (watcher.fd ());
+    if (events < 0)
+      co_return -1;
+    if (watcher.changed () && worker.reloadConfig () == 0)
+      wake.wake ();
+  }
+}
+
+dotname::Task clockTask (dotname::EventLoop& loop, dotname::ClockWatch& clock, int fd,
+                         dotname::SunrisetWorker& worker, dotname::LoopTimer& wake) {
+  for (;;) {
+    int events = co_await loop.wait (fd);
+    if (events < 0)
+      co_return -1;
+    const unsigned changes = clock.check ();
+    if (changes & dotname::kClockResumed)
+      LOG_I_STREAM << "Resumed from suspend, rescheduling" << std::endl;
+    else if (changes & dotname::kClockStepped)
+      LOG_I_STREAM << "System clock changed, rescheduling" << std::endl;
+    if (changes & dotname::kZoneChanged) {
+      LOG_I_STREAM << "Time zone changed, rescheduling" << std::endl;
+      worker.systemZoneChanged ();
+    }
+    if (changes)
+      wake.wake ();
+  }
+}
+
+dotname::Task sessionTask (dotname::EventLoop& loop, dotname::SessionEventListener& session,
+                           int fd, dotname::SunrisetWorker& worker, dotname::LoopTimer& wake) {
+  std::vector<dotname::SessionEvent> events;
+  for (;;) {
+    int ready = co_await loop.wait (fd);
+    if (ready < 0)
+      co_return -1;
+    events.clear ();
+    session.drain (events);
+    for (auto event : events)
+      LOG_D_STREAM << "Session " << dotname::sessionEventName (event) << std::endl;
+    // the desktop may have been changed meanwhile, the sun task applies the state anew
+    if (!events.empty ()) {
+      worker.forgetAppliedTheme ();
+      wake.wake ();
+    }
+  }
+}
+
+int runDaemon (dotname::SunrisetWorker& worker, const dotname::SignalSet& signals) {
+  if (signals.fd () < 0)
+    return 1;
+  dotname::ConfigWatcher watcher (worker.configPath ());
+  dotname::ClockWatch clock;
+  dotname::SessionEventListener session;
+  if (session.connect () != 0)
+    LOG_W_STREAM << "Not listening for unlock/resume: " << session.error () << std::endl;
+
+  dotname::EventLoop loop;
+  dotname::LoopTimer wake (loop);
+  loop.spawn (sunTask (worker, wake));
+  loop.spawn (signalTask (loop, signals));
+  loop.spawn (configTask (loop, watcher, worker, wake));
+  for (int fd : clock.fds ())
+    loop.spawn (clockTask (loop, clock, fd, worker, wake));
+  for (int fd : session.fds ())
+    loop.spawn (sessionTask (loop, session, fd, worker, wake));
+  int rc = loop.run ();
+  LOG_D_STREAM << "Event loop: " << loop.stats ().wakeups << " wakeup(s), "
+               << loop.stats ().resumes << " resume(s)" << std::endl;
+  return rc < 0 ? 1 : rc;
+}
+#else
+int runDaemon (dotname::SunrisetWorker&, const dotname::SignalSet&) {
+  LOG_E_STREAM << "--daemon is only available on Linux" << std::endl;
+  return 1;
+}
+#endif
+
 int handlesArguments (int argc, const char* argv[]) {
+  const auto parseStart = dotname::Trace::now ();
   try {
     auto options = std::make_unique<cxxopts::Options> (argv[0], AppContext::standaloneName);
     options->positional_help ("[optional args]").show_positional_help ();
@@ -53,8 +188,21 @@ int handlesArguments (int argc, const char* argv[]) {
                              cxxopts::value<int> ()->default_value ("0"));
     options->add_options () ("clear", "Clear settings",
                              cxxopts::value<bool> ()->default_value ("false"));
+    options->add_options () ("force", "Apply the theme even if it is already applied",
+                             cxxopts::value<bool> ()->default_value ("false"));
+    options->add_options () ("buildgrid", "Build the precomputed sunrise grid into assets",
+                             cxxopts::value<bool> ()->default_value ("false"));
+    options->add_options () ("daemon", "Keep running and switch at the exact transitions",
+                             cxxopts::value<bool> ()->default_value ("false"));
+    options->add_options () ("trace", "Write a Chrome trace (chrome://tracing) of the run",
+                             cxxopts::value<std::string> ());
 
     const auto result = options->parse (argc, argv);
+    if (result.count ("trace")) {
+      dotname::Trace::enable (result["trace"].as<std::string> ());
+      dotname::Trace::complete ("parse options", parseStart, dotname::Trace::now ());
+    }
+    TRACE_SPAN ("handlesArguments");
 
     if (result.count ("help")) {
       LOG_I_STREAM << options->help ({ "", "Group" }) << std::endl;
@@ -66,6 +214,10 @@ int handlesArguments (int argc, const char* argv[]) {
       LOG_D_STREAM << "Logging to file enabled [-2]" << std::endl;
     }
 
+    if (result["buildgrid"].as<bool> ()) {
+      return dotname::buildSunGridFile (AppContext::assetsPath / "sungrid.bin") == 0 ? 0 : 1;
+    }
+
     if (!result.count ("omit")) {
       dotname::Params params; // new copy of memory
       params.lat.first = result.count ("lat");
@@ -80,10 +232,22 @@ int handlesArguments (int argc, const char* argv[]) {
       params.setOffsetMinutes.second = result["setoffset"].as<int> ();
       params.clear.first = result.count ("clear");
       params.clear.second = result["clear"].as<bool> ();
+      params.force.first = result.count ("force");
+      params.force.second = result["force"].as<bool> ();
+
+      // blocked before the worker starts any thread (the theme backend pool), so every
+      // thread inherits the mask and SIGINT / SIGTERM reach only the daemon's signalfd
+      std::optional<dotname::SignalSet> signals;
+      if (result["daemon"].as<bool> ())
+        signals.emplace (std::initializer_list<int> { SIGINT, SIGTERM });
 
       uniqueLib = std::make_unique<dotname::SunrisetWorker> (
           AppContext::assetsPath, params);           
 
+      if (signals) {
+        return runDaemon (*uniqueLib, *signals);
+      }
+
     } else {
       LOG_D_STREAM << "Loading library omitted [-1]" << std::endl;
     }
@@ -135,15 +299,16 @@ int runApp (int argc, const char* argv[]) {
   LOG_I_STREAM << " ⤷ Emscripten C++ with pthreads support" << std::endl;
 #endif
 
-  if (handlesArguments (argc, argv) != 0) {
+  int rc = handlesArguments (argc, argv);
+  // I know it is smartpointer, but we need to free it before exit scope bracelet
+  uniqueLib = nullptr;
+  dotname::Trace::flush ();
+  if (rc != 0) {
     return 1;
   }
 
   // Performance::simpleCpuBenchmark ();
 
-  // I know it is smartpointer, but we need to free it before exit scope bracelet
-  uniqueLib = nullptr;
-
   // bye
   LOG_I_STREAM << "Sucessfully exited " << AppContext::standaloneName << std::endl;
   return 0;
@@ -0,0 +1,115 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/ConfigStore.hpp>
+#include <gtest/gtest.h>
+
+#include "TempDir.hpp"
+#include "Utils/Utils.hpp"
+
+#include <fstream>
+
+#if defined(__linux__)
+  #include <poll.h>
+#endif
+
+using DotNameUtils::FileIO::readFile;
+
+TEST (ConfigStore, WritesOnlyChanges) {
+  TempDir dir;
+  auto file = dir / "config.json";
+  dotname::ConfigStore store (file);
+  EXPECT_NE (store.load (), 0); // first run, no file yet
+  store.set ("lat", 50.0755);
+  store.set ("utcOffsetMinutes", 60);
+  store.set ("timeZone", "Europe/Prague");
+  store.set ("themeBackends", std::vector<std::string> { "gnome" });
+  ASSERT_EQ (store.commit (), 0);
+  EXPECT_EQ (store.stats ().writes, 1u);
+
+  // the same values again are no change
+  store.set ("lat", 50.0755);
+  store.set ("utcOffsetMinutes", 60);
+  store.set ("timeZone", "Europe/Prague");
+  store.set ("themeBackends", std::vector<std::string> { "gnome" });
+  EXPECT_FALSE (store.dirty ());
+  EXPECT_EQ (store.commit (), 0);
+  EXPECT_EQ (store.stats ().writes, 1u);
+  EXPECT_EQ (store.stats ().skipped, 1u);
+
+  dotname::ConfigStore reread (file);
+  ASSERT_EQ (reread.load (), 0);
+  EXPECT_DOUBLE_EQ (reread.get ("lat", 0.0), 50.0755);
+  EXPECT_EQ (reread.get ("utcOffsetMinutes", 0), 60);
+  EXPECT_EQ (reread.get ("timeZone", ""), "Europe/Prague");
+  EXPECT_EQ (reread.get ("lat", "none"), "none"); // wrong type
+  EXPECT_EQ (reread.get ("themeBackends", std::vector<std::string> {}),
+             std::vector<std::string> { "gnome" });
+  reread.set ("lat", 50.0755);
+  EXPECT_FALSE (reread.dirty ());
+}
+
+TEST (ConfigStore, KeepsUnknownKeys) {
+  TempDir dir;
+  auto file = dir / "config.json";
+  std::ofstream (file) << R"({ "lat": 10, "lon": "east", "comment": "mine" })";
+
+  dotname::ConfigStore store (file);
+  ASSERT_EQ (store.load (), 0);
+  EXPECT_DOUBLE_EQ (store.get ("lat", 0.0), 10.0);
+  EXPECT_DOUBLE_EQ (store.get ("lon", 14.4378), 14.4378); // wrong type
+  EXPECT_EQ (store.get ("missing", 7), 7);
+
+  store.set ("lat", 10.0); // 10 in the file
+  EXPECT_FALSE (store.dirty ());
+  store.set ("lat", 11.0);
+  ASSERT_EQ (store.commit (), 0);
+  EXPECT_NE (readFile (file).find ("\"comment\": \"mine\""), std::string::npos);
+
+  // only the config is left, no temp file
+  std::size_t files = 0;
+  for (const auto& entry : std::filesystem::directory_iterator (file.parent_path ())) {
+    EXPECT_EQ (entry.path ().filename (), "config.json");
+    ++files;
+  }
+  EXPECT_EQ (files, 1u);
+}
+
+TEST (ConfigStore, InvalidFileIsRewritten) {
+  TempDir dir;
+  auto file = dir / "config.json";
+  std::ofstream (file) << "{ not json";
+
+  dotname::ConfigStore store (file);
+  EXPECT_NE (store.load (), 0);
+  EXPECT_TRUE (store.dirty ());
+  ASSERT_EQ (store.commit (), 0);
+  dotname::ConfigStore reread (file);
+  EXPECT_EQ (reread.load (), 0);
+}
+
+#if defined(__linux__)
+TEST (ConfigWatcher, SeesWritesAndReplacements) {
+  TempDir dir;
+  auto file = dir / "config.json";
+  dotname::ConfigWatcher watcher (file);
+  ASSERT_GE (watcher.fd (), 0);
+  auto pending = [&] {
+    pollfd pfd { watcher.fd (), POLLIN, 0 };
+    return poll (&pfd, 1, 1000) == 1 && watcher.changed ();
+  };
+
+  // other files in the directory are not the config
+  std::ofstream (dir / "themestate.json") << "{}";
+  EXPECT_FALSE (pending ());
+
+  std::ofstream (file) << "{}";
+  EXPECT_TRUE (pending ());
+
+  dotname::ConfigStore store (file);
+  store.set ("lat", 1.0);
+  ASSERT_EQ (store.commit (), 0); // rename over the file
+  EXPECT_TRUE (pending ());
+  EXPECT_FALSE (watcher.changed ());
+}
+#endif
@@ -0,0 +1,186 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __DBUSTESTBUS_HPP
+#define __DBUSTESTBUS_HPP
+
+// Private dbus-daemon plus a stub ca.desrt.dconf Writer, shared by DconfWriterTester and
+// DconfWriterBench. The daemon is looked up in PATH; available () is false without it.
+
+#include "DBus/DBusConnection.hpp"
+#include "DBus/GVariant.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <fcntl.h>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <spawn.h>
+#include <string>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+extern char** environ;
+
+class DBusTestBus {
+public:
+  DBusTestBus () {
+    std::string daemon = findInPath ("dbus-daemon");
+    if (daemon.empty ())
+      return;
+    dir_ = std::filesystem::temp_directory_path ()
+           / ("followsun-dbus-" + std::to_string (::getpid ()));
+    std::filesystem::create_directories (dir_);
+    address_ = "unix:path=" + (dir_ / "bus").string ();
+
+    std::ofstream config (dir_ / "bus.conf");
+    config << "<!DOCTYPE busconfig PUBLIC \"-//freedesktop//DTD D-Bus Bus Configuration 1.0//EN\""
+              " \"http://www.freedesktop.org/standards/dbus/1.0/busconfig.dtd\">\n"
+              "<busconfig><type>session</type><listen>"
+           << address_
+           << "</listen><auth>EXTERNAL</auth><policy context=\"default\">"
+              "<allow send_destination=\"*\" eavesdrop=\"true\"/><allow eavesdrop=\"true\"/>"
+              "<allow own=\"*\"/></policy></busconfig>\n"; // the policy of session.conf
+    config.close ();
+
+    std::string configArg = "--config-file=" + (dir_ / "bus.conf").string ();
+    std::vector<char*> argv { const_cast<char*> (daemon.c_str ()),
+                              const_cast<char*> ("--nofork"),
+                              const_cast<char*> (configArg.c_str ()), nullptr };
+    posix_spawn_file_actions_t actions; // keep the daemon's warnings out of the test log
+    posix_spawn_file_actions_init (&actions);
+    posix_spawn_file_actions_addopen (&actions, 2, "/dev/null", O_WRONLY, 0);
+    int spawned = posix_spawn (&pid_, daemon.c_str (), &actions, nullptr, argv.data (), environ);
+    posix_spawn_file_actions_destroy (&actions);
+    if (spawned != 0) {
+      pid_ = -1;
+      return;
+    }
+    // the socket shows up once the daemon listens
+    dotname::dbus::Connection probe;
+    for (int i = 0; i < 250 && probe.connect (address_, 200) != 0; ++i)
+      std::this_thread::sleep_for (std::chrono::milliseconds (20));
+  }
+
+  ~DBusTestBus () {
+    stopDconf ();
+    if (pid_ > 0) {
+      ::kill (pid_, SIGTERM);
+      ::waitpid (pid_, nullptr, 0);
+    }
+    if (!dir_.empty ()) {
+      std::error_code ec;
+      std::filesystem::remove_all (dir_, ec);
+    }
+  }
+
+  bool available () const {
+    return pid_ > 0;
+  }
+
+  const std::string& address () const {
+    return address_;
+  }
+
+  // Owns ca.desrt.dconf and answers Change () calls from a thread, 0 once the name is owned
+  int startDconf () {
+    if (service_.connect (address_) != 0)
+      return -1;
+    dotname::dbus::Message request, reply;
+    request.destination = "org.freedesktop.DBus";
+    request.path = "/org/freedesktop/DBus";
+    request.interface = "org.freedesktop.DBus";
+    request.member = "RequestName";
+    request.signature = "su";
+    dotname::dbus::BodyWriter body (request.body);
+    body.string ("ca.desrt.dconf");
+    body.uint32 (4); // DBUS_NAME_FLAG_DO_NOT_QUEUE
+    std::uint32_t result = 0;
+    if (service_.call (request, reply, 2000) != 0
+        || !dotname::dbus::BodyReader (reply.body).uint32 (result) || result != 1)
+      return -1;
+
+    running_ = true;
+    thread_ = std::thread ([this] { serve (); });
+    return 0;
+  }
+
+  void stopDconf () {
+    running_ = false;
+    if (thread_.joinable ())
+      thread_.join ();
+    service_.close ();
+  }
+
+  // changesets received so far, one per Change () call
+  std::vector<std::vector<dotname::gvariant::Change>> changesets () {
+    std::lock_guard<std::mutex> lock (mutex_);
+    return changesets_;
+  }
+
+private:
+  static std::string findInPath (const std::string& name) {
+    const char* path = std::getenv ("PATH");
+    std::string list = path ? path : "";
+    std::size_t pos = 0;
+    while (pos <= list.size ()) {
+      std::size_t colon = list.find (':', pos);
+      std::filesystem::path candidate
+          = std::filesystem::path (list.substr (pos, colon - pos)) / name;
+      if (::access (candidate.c_str (), X_OK) == 0)
+        return candidate.string ();
+      if (colon == std::string::npos)
+        break;
+      pos = colon + 1;
+    }
+    return {};
+  }
+
+  void serve () {
+    using dotname::dbus::MessageType;
+    while (running_) {
+      dotname::dbus::Message call;
+      if (service_.receive (call, 50) != 0) {
+        if (!service_.isConnected ())
+          return;
+        continue; // timed out, check running_
+      }
+      if (call.type != MessageType::MethodCall || call.member != "Change")
+        continue;
+
+      std::string blob;
+      std::vector<dotname::gvariant::Change> changes;
+      dotname::dbus::Message reply;
+      reply.destination = call.sender;
+      reply.replySerial = call.serial;
+      if (dotname::dbus::BodyReader (call.body).bytes (blob)
+          && dotname::gvariant::parseChangeset (blob, changes) == 0) {
+        std::lock_guard<std::mutex> lock (mutex_);
+        changesets_.push_back (changes);
+        reply.type = MessageType::MethodReturn;
+        reply.signature = "s";
+        dotname::dbus::BodyWriter (reply.body).string (std::to_string (changesets_.size ()));
+      } else {
+        reply.type = MessageType::Error;
+        reply.errorName = "ca.desrt.dconf.Error.InvalidChangeset";
+      }
+      service_.send (reply);
+    }
+  }
+
+  pid_t pid_ = -1;
+  std::filesystem::path dir_;
+  std::string address_;
+  dotname::dbus::Connection service_;
+  std::thread thread_;
+  std::atomic<bool> running_ { false };
+  std::mutex mutex_;
+  std::vector<std::vector<dotname::gvariant::Change>> changesets_;
+};
+
+#endif // __DBUSTESTBUS_HPP
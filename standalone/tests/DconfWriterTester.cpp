@@ -0,0 +1,120 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/DconfWriter.hpp>
+#include <gtest/gtest.h>
+
+#include "DBus/GVariant.hpp"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+  #include "DBusTestBus.hpp"
+  #include <sys/socket.h>
+  #include <sys/un.h>
+#endif
+
+namespace {
+
+  std::string fromHex (const std::string& hex) {
+    std::string s;
+    for (std::size_t i = 0; i + 1 < hex.size (); i += 2)
+      s.push_back (static_cast<char> (std::stoi (hex.substr (i, 2), nullptr, 16)));
+    return s;
+  }
+
+} // namespace
+
+// expected bytes are g_variant_get_data () of the same a{smv} values built by GLib
+TEST (GVariant, ChangesetMatchesGLib) {
+  EXPECT_EQ (dotname::gvariant::serializeChangeset ({ { "/a/b", "x" }, { "/a/c", {} } }),
+             fromHex ("2f612f620000000078000073000500002f612f6300000000050e19"));
+  EXPECT_EQ (dotname::gvariant::serializeChangeset ({}), "");
+  EXPECT_EQ (dotname::gvariant::serializeChangeset (
+                 { { "/org/gnome/desktop/interface/color-scheme", "prefer-dark" },
+                   { "/org/gnome/desktop/interface/gtk-theme", "Adwaita-dark" } }),
+             fromHex ("2f6f72672f676e6f6d652f6465736b746f702f696e746572666163652f636f6c6f722d"
+                      "736368656d65000000000000007072656665722d6461726b000073002a2f6f72672f"
+                      "676e6f6d652f6465736b746f702f696e746572666163652f67746b2d7468656d6500"
+                      "00416477616974612d6461726b00007300274079"));
+}
+
+TEST (GVariant, ChangesetRoundTrip) {
+  std::vector<dotname::gvariant::Change> changes
+      = { { "/org/gnome/desktop/interface/gtk-theme", "Adwaita" },
+          { "/reset/me", {} },
+          { "/long", std::string (300, 'v') } }; // 2 byte offsets
+  std::vector<dotname::gvariant::Change> parsed;
+  ASSERT_EQ (dotname::gvariant::parseChangeset (
+                 dotname::gvariant::serializeChangeset (changes), parsed),
+             0);
+  EXPECT_EQ (parsed, changes);
+
+  EXPECT_EQ (dotname::gvariant::parseChangeset ("\x05garbage", parsed), -1);
+}
+
+#if defined(__linux__)
+
+TEST (DconfWriter, OneChangePerSwitch) {
+  DBusTestBus bus;
+  if (!bus.available ())
+    GTEST_SKIP () << "dbus-daemon not found in PATH";
+  ASSERT_EQ (bus.startDconf (), 0);
+
+  dotname::DconfWriter writer;
+  ASSERT_EQ (writer.connect (bus.address ()), 0) << writer.error ();
+  ASSERT_EQ (writer.switchLightTheme (false), 0) << writer.error ();
+  ASSERT_EQ (writer.switchLightTheme (true), 0) << writer.error ();
+
+  auto changesets = bus.changesets ();
+  ASSERT_EQ (changesets.size (), 2u); // both keys of a switch in one transaction
+  std::vector<dotname::gvariant::Change> dark
+      = { { "/org/gnome/desktop/interface/color-scheme", "prefer-dark" },
+          { "/org/gnome/desktop/interface/gtk-theme", "Adwaita-dark" } };
+  std::vector<dotname::gvariant::Change> light
+      = { { "/org/gnome/desktop/interface/color-scheme", "default" },
+          { "/org/gnome/desktop/interface/gtk-theme", "Adwaita" } };
+  EXPECT_EQ (changesets[0], dark);
+  EXPECT_EQ (changesets[1], light);
+}
+
+TEST (DconfWriter, FailsWithoutService) {
+  DBusTestBus bus;
+  if (!bus.available ())
+    GTEST_SKIP () << "dbus-daemon not found in PATH";
+
+  dotname::DconfWriter writer;
+  ASSERT_EQ (writer.connect (bus.address ()), 0) << writer.error ();
+  EXPECT_EQ (writer.switchLightTheme (true), -1);
+  EXPECT_NE (writer.error ().find ("ServiceUnknown"), std::string::npos) << writer.error ();
+  EXPECT_TRUE (writer.isConnected ());
+
+  dotname::DconfWriter offline;
+  EXPECT_EQ (offline.connect ("unix:path=/nonexistent/bus"), -1);
+  EXPECT_FALSE (offline.isConnected ());
+}
+
+TEST (DBusConnection, SilentPeerLeavesNoHalfOpenConnection) {
+  // a socket that accepts but never answers the auth exchange
+  auto path = std::filesystem::temp_directory_path ()
+              / ("followsun-silent-" + std::to_string (::getpid ()));
+  int listener = ::socket (AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  ASSERT_GE (listener, 0);
+  sockaddr_un sa {};
+  sa.sun_family = AF_UNIX;
+  std::snprintf (sa.sun_path, sizeof (sa.sun_path), "%s", path.c_str ());
+  ASSERT_EQ (::bind (listener, reinterpret_cast<sockaddr*> (&sa), sizeof (sa)), 0);
+  ASSERT_EQ (::listen (listener, 1), 0);
+
+  dotname::dbus::Connection bus;
+  EXPECT_EQ (bus.connect ("unix:path=" + path.string (), 100), -1);
+  EXPECT_EQ (bus.error (), "timed out");
+  EXPECT_FALSE (bus.isConnected ());
+
+  ::close (listener);
+  std::filesystem::remove (path);
+}
+
+#endif
@@ -0,0 +1,180 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/EventLoop.hpp>
+#include <gtest/gtest.h>
+
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+  #include <spawn.h>
+  #include <sys/wait.h>
+  #include <unistd.h>
+
+extern char** environ;
+
+using namespace std::chrono_literals;
+
+namespace {
+
+  dotname::Task answerLater (dotname::EventLoop& loop) {
+    co_await loop.sleepFor (20ms);
+    co_return 42;
+  }
+
+  dotname::Task awaitChild (dotname::EventLoop& loop, int& answer) {
+    answer = co_await answerLater (loop);
+    co_return answer + 1;
+  }
+
+  dotname::Task readPipe (dotname::EventLoop& loop, int fd, std::vector<std::string>& log) {
+    int events = co_await loop.wait (fd);
+    char buffer[16];
+    ssize_t n = ::read (fd, buffer, sizeof (buffer));
+    log.push_back ("read " + std::string (buffer, n > 0 ? static_cast<std::size_t> (n) : 0)
+                   + (events & 1 ? "" : " without EPOLLIN"));
+    co_return 0;
+  }
+
+  dotname::Task writePipe (dotname::EventLoop& loop, int fd, std::vector<std::string>& log) {
+    co_await loop.sleepFor (10ms);
+    log.push_back ("write");
+    co_return ::write (fd, "sun", 3) == 3 ? 0 : -1;
+  }
+
+  dotname::Task sleepLong (dotname::LoopTimer& timer, std::vector<int>& results) {
+    results.push_back (co_await timer.until (std::chrono::system_clock::now () + 1h));
+    // a wake () while nobody slept cuts the next sleep short at once
+    results.push_back (co_await timer.until (std::chrono::system_clock::now () + 1h));
+    co_return 0;
+  }
+
+  dotname::Task wakeSoon (dotname::EventLoop& loop, dotname::LoopTimer& timer) {
+    co_await loop.sleepFor (10ms);
+    timer.wake ();
+    timer.wake ();
+    co_return 0;
+  }
+
+  dotname::Task stopper (dotname::EventLoop& loop, int fd) {
+    co_await loop.wait (fd); // never ready
+    co_return 0;
+  }
+
+  dotname::Task waitInvalid (dotname::EventLoop& loop) {
+    co_return co_await loop.wait (-1);
+  }
+
+  dotname::Task stopLater (dotname::EventLoop& loop) {
+    co_await loop.sleepFor (5ms);
+    loop.stop (7);
+    co_return 0;
+  }
+
+  dotname::Task signalAndChild (dotname::EventLoop& loop, const dotname::SignalSet& signals,
+                                int pid, int& signo, int& status) {
+    ::raise (SIGUSR1);
+    signo = co_await loop.signal (signals);
+    status = co_await loop.childExit (pid);
+    co_return 0;
+  }
+
+} // namespace
+
+TEST (EventLoop, TasksAndSleeps) {
+  dotname::EventLoop loop;
+  int answer = 0;
+  auto start = std::chrono::steady_clock::now ();
+  loop.spawn (awaitChild (loop, answer));
+  EXPECT_EQ (loop.run (), 43);
+  EXPECT_EQ (answer, 42);
+  EXPECT_GE (std::chrono::steady_clock::now () - start, 20ms);
+  // one wakeup for the one deadline, nothing else
+  EXPECT_EQ (loop.stats ().wakeups, 1u);
+}
+
+TEST (EventLoop, FdReadiness) {
+  int fds[2];
+  ASSERT_EQ (::pipe (fds), 0);
+  dotname::EventLoop loop;
+  std::vector<std::string> log;
+  loop.spawn (readPipe (loop, fds[0], log));
+  loop.spawn (writePipe (loop, fds[1], log));
+  EXPECT_EQ (loop.run (), 0);
+  EXPECT_EQ (log, (std::vector<std::string> { "write", "read sun" }));
+  EXPECT_EQ (loop.stats ().wakeups, 2u); // the sleep, then the pipe
+  ::close (fds[0]);
+  ::close (fds[1]);
+}
+
+TEST (EventLoop, TimerWakeCutsSleepShort) {
+  dotname::EventLoop loop;
+  dotname::LoopTimer timer (loop);
+  std::vector<int> results;
+  auto start = std::chrono::steady_clock::now ();
+  loop.spawn (sleepLong (timer, results));
+  loop.spawn (wakeSoon (loop, timer));
+  EXPECT_EQ (loop.run (), 0);
+  EXPECT_EQ (results, (std::vector<int> { 1, 1 }));
+  EXPECT_LT (std::chrono::steady_clock::now () - start, 1s);
+  EXPECT_EQ (loop.stats ().wakeups, 1u);
+}
+
+TEST (EventLoop, StopEndsRun) {
+  int fds[2];
+  ASSERT_EQ (::pipe (fds), 0);
+  {
+    dotname::EventLoop loop;
+    loop.spawn (stopper (loop, fds[0]));
+    loop.spawn (stopLater (loop));
+    EXPECT_EQ (loop.run (), 7);
+  } // the suspended task is destroyed with the loop
+  ::close (fds[0]);
+  ::close (fds[1]);
+
+  // an fd epoll refuses completes at once with -errno
+  dotname::EventLoop loop;
+  loop.spawn (waitInvalid (loop));
+  EXPECT_EQ (loop.run (), -EBADF);
+}
+
+TEST (EventLoop, SignalsAndChildExit) {
+  if (::access ("/bin/sh", X_OK) != 0)
+    GTEST_SKIP () << "no /bin/sh";
+  const char* argv[] = { "/bin/sh", "-c", "exit 3", nullptr };
+  pid_t pid;
+  ASSERT_EQ (::posix_spawn (&pid, argv[0], nullptr, nullptr, const_cast<char**> (argv), environ),
+             0);
+
+  dotname::EventLoop loop;
+  dotname::SignalSet signals { SIGUSR1 };
+  ASSERT_GE (signals.fd (), 0);
+  int signo = 0, status = -1;
+  loop.spawn (signalAndChild (loop, signals, pid, signo, status));
+  EXPECT_EQ (loop.run (), 0);
+  EXPECT_EQ (signo, SIGUSR1);
+  ASSERT_TRUE (WIFEXITED (status));
+  EXPECT_EQ (WEXITSTATUS (status), 3);
+}
+
+TEST (EventLoop, SignalSetRefusesRunningThreads) {
+  // a thread that existed before the set would not inherit the mask
+  std::promise<void> done;
+  std::thread other ([&] { done.get_future ().wait (); });
+  {
+    dotname::SignalSet signals { SIGUSR2 };
+    EXPECT_EQ (signals.fd (), -1);
+  }
+  done.set_value ();
+  other.join ();
+
+  dotname::SignalSet signals { SIGUSR2 };
+  EXPECT_GE (signals.fd (), 0);
+}
+#endif
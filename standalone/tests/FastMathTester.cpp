@@ -0,0 +1,72 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/SunEngine.hpp>
+#include <gtest/gtest.h>
+
+#include "FastMath/FastTrig.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace fm = dotname::fastmath;
+
+TEST (FastMath, KernelsWithinErrorBudget) {
+  std::mt19937 rng (5);
+  std::uniform_real_distribution<double> angle (-1000.0, 1000.0), unit (-1.0, 1.0);
+  for (int i = 0; i < 200000; ++i) {
+    double x = angle (rng), s, c;
+    fm::sinCosDeg (x, s, c);
+    EXPECT_NEAR (s, std::sin (x * fm::kDegRad), 4e-7);
+    EXPECT_NEAR (c, std::cos (x * fm::kDegRad), 4e-7);
+
+    double y = unit (rng), z = unit (rng);
+    EXPECT_NEAR (fm::atan2Deg (y, z), std::atan2 (y, z) * fm::kRadDeg, 1e-4);
+    EXPECT_NEAR (fm::acosDeg (y), std::acos (y) * fm::kRadDeg, 1e-4);
+
+    EXPECT_NEAR (fm::revolution (x), x - 360.0 * std::floor (x / 360.0), 1e-9);
+    EXPECT_NEAR (fm::rev180 (x), x - 360.0 * std::floor (x / 360.0 + 0.5), 1e-9);
+  }
+}
+
+TEST (FastMath, SunrisetWithinSecondOfReference) {
+  std::mt19937 rng (7);
+  std::uniform_int_distribution<int> year (1801, 2099), month (1, 12), day (1, 28);
+  std::uniform_real_distribution<double> lat (-65.0, 65.0), lon (-180.0, 180.0);
+  double worst = 0.0, sum = 0.0;
+  int n = 0;
+  for (int i = 0; i < 100000; ++i) {
+    int y = year (rng), m = month (rng), d = day (rng);
+    double la = lat (rng), lo = lon (rng), r0, s0, r1, s1;
+    int rc0 = dotname::sunriset (dotname::SunEngine::Reference, y, m, d, lo, la, -35.0 / 60.0,
+                                 1, &r0, &s0);
+    int rc1 = dotname::sunriset (dotname::SunEngine::FastMath, y, m, d, lo, la, -35.0 / 60.0, 1,
+                                 &r1, &s1);
+    ASSERT_EQ (rc0, rc1);
+    double e = std::max (std::fabs (r0 - r1), std::fabs (s0 - s1)) * 3600.0;
+    worst = std::max (worst, e);
+    sum += e * e;
+    ++n;
+
+    double l0 = dotname::daylen (dotname::SunEngine::Reference, y, m, d, lo, la, -6.0, 0);
+    double l1 = dotname::daylen (dotname::SunEngine::FastMath, y, m, d, lo, la, -6.0, 0);
+    worst = std::max (worst, std::fabs (l0 - l1) * 3600.0);
+  }
+  EXPECT_LT (std::sqrt (sum / n), 0.1);
+  EXPECT_LT (worst, 1.0);
+}
+
+TEST (FastMath, PolarCases) {
+  double rise, set;
+  // Tromsø: polar night in December, midnight sun in June
+  EXPECT_EQ (dotname::sunriset (dotname::SunEngine::FastMath, 2025, 12, 21, 18.95, 69.65,
+                                -35.0 / 60.0, 1, &rise, &set),
+             -1);
+  EXPECT_EQ (dotname::sunriset (dotname::SunEngine::FastMath, 2025, 6, 21, 18.95, 69.65,
+                                -35.0 / 60.0, 1, &rise, &set),
+             +1);
+  EXPECT_EQ (dotname::daylen (dotname::SunEngine::FastMath, 2025, 6, 21, 18.95, 69.65,
+                              -35.0 / 60.0, 1),
+             24.0);
+}
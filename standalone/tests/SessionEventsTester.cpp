@@ -0,0 +1,143 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/SessionEvents.hpp>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+  #include "DBusTestBus.hpp"
+
+  #include <poll.h>
+#endif
+
+#if defined(__linux__)
+
+namespace {
+
+  using dotname::SessionEvent;
+
+  int emit (dotname::dbus::Connection& bus, const std::string& path,
+            const std::string& interface, const std::string& member, bool value) {
+    dotname::dbus::Message signal;
+    signal.type = dotname::dbus::MessageType::Signal;
+    signal.flags = dotname::dbus::kNoReplyExpected;
+    signal.path = path;
+    signal.interface = interface;
+    signal.member = member;
+    signal.signature = "b";
+    dotname::dbus::BodyWriter (signal.body).uint32 (value ? 1 : 0);
+    return bus.send (signal);
+  }
+
+  int emitScreenSaver (dotname::dbus::Connection& bus, bool active) {
+    return emit (bus, "/org/gnome/ScreenSaver", "org.gnome.ScreenSaver", "ActiveChanged", active);
+  }
+
+  int emitPrepareForSleep (dotname::dbus::Connection& bus, bool start) {
+    return emit (bus, "/org/freedesktop/login1", "org.freedesktop.login1.Manager",
+                 "PrepareForSleep", start);
+  }
+
+  int requestName (dotname::dbus::Connection& bus, const std::string& name) {
+    dotname::dbus::Message request, reply;
+    request.destination = "org.freedesktop.DBus";
+    request.path = "/org/freedesktop/DBus";
+    request.interface = "org.freedesktop.DBus";
+    request.member = "RequestName";
+    request.signature = "su";
+    dotname::dbus::BodyWriter body (request.body);
+    body.string (name);
+    body.uint32 (4); // DBUS_NAME_FLAG_DO_NOT_QUEUE
+    std::uint32_t result = 0;
+    if (bus.call (request, reply, 2000) != 0
+        || !dotname::dbus::BodyReader (reply.body).uint32 (result) || result != 1)
+      return -1;
+    return 0;
+  }
+
+  // polls the listener like the daemon does until count events arrived or timeoutMs passed
+  std::vector<SessionEvent> waitFor (dotname::SessionEventListener& listener, std::size_t count,
+                                     int timeoutMs = 2000) {
+    std::vector<SessionEvent> events;
+    for (int i = 0; i < timeoutMs / 10 && events.size () < count; ++i) {
+      std::vector<pollfd> fds;
+      for (int fd : listener.fds ())
+        fds.push_back ({ fd, POLLIN, 0 });
+      ::poll (fds.data (), fds.size (), 10);
+      listener.drain (events);
+    }
+    return events;
+  }
+
+} // namespace
+
+// the private bus stands in for both, the session and the system bus
+TEST (SessionEvents, MapsSignalsToEvents) {
+  DBusTestBus bus;
+  if (!bus.available ())
+    GTEST_SKIP () << "dbus-daemon not found in PATH";
+
+  dotname::SessionEventListener listener;
+  ASSERT_EQ (listener.connect (bus.address (), bus.address ()), 0) << listener.error ();
+  EXPECT_TRUE (listener.listensToScreenSaver ());
+  EXPECT_TRUE (listener.listensToLogind ());
+  EXPECT_EQ (listener.fds ().size (), 2u);
+
+  dotname::dbus::Connection screenSaver, logind;
+  ASSERT_EQ (screenSaver.connect (bus.address ()), 0);
+  ASSERT_EQ (logind.connect (bus.address ()), 0);
+  ASSERT_EQ (requestName (logind, "org.freedesktop.login1"), 0);
+
+  ASSERT_EQ (emitScreenSaver (screenSaver, true), 0);
+  ASSERT_EQ (emitScreenSaver (screenSaver, false), 0);
+  auto events = waitFor (listener, 2);
+  EXPECT_EQ (events, (std::vector<SessionEvent> { SessionEvent::Locked, SessionEvent::Unlocked }));
+
+  ASSERT_EQ (emitPrepareForSleep (logind, true), 0);
+  ASSERT_EQ (emitPrepareForSleep (logind, false), 0);
+  events = waitFor (listener, 2);
+  EXPECT_EQ (events,
+             (std::vector<SessionEvent> { SessionEvent::Suspending, SessionEvent::Resumed }));
+  EXPECT_STREQ (dotname::sessionEventName (SessionEvent::Resumed), "resumed");
+}
+
+TEST (SessionEvents, BusFiltersOtherSignals) {
+  DBusTestBus bus;
+  if (!bus.available ())
+    GTEST_SKIP () << "dbus-daemon not found in PATH";
+
+  dotname::SessionEventListener listener;
+  ASSERT_EQ (listener.connect (bus.address (), bus.address ()), 0) << listener.error ();
+
+  dotname::dbus::Connection sender;
+  ASSERT_EQ (sender.connect (bus.address ()), 0);
+  // other interfaces and members, and a PrepareForSleep not sent by logind
+  ASSERT_EQ (emit (sender, "/org/gnome/ScreenSaver", "org.gnome.Other", "ActiveChanged", false),
+             0);
+  ASSERT_EQ (emit (sender, "/org/gnome/ScreenSaver", "org.gnome.ScreenSaver", "WakeUpScreen",
+                   false),
+             0);
+  ASSERT_EQ (emitPrepareForSleep (sender, false), 0);
+  // the bus delivers in order, once this one is here the others were dropped
+  ASSERT_EQ (emitScreenSaver (sender, false), 0);
+
+  auto events = waitFor (listener, 1);
+  EXPECT_EQ (events, (std::vector<SessionEvent> { SessionEvent::Unlocked }));
+  EXPECT_EQ (waitFor (listener, 1, 100).size (), 0u);
+}
+
+TEST (SessionEvents, MissingBuses) {
+  dotname::SessionEventListener listener;
+  EXPECT_EQ (listener.connect ("unix:path=/nonexistent/session", "unix:path=/nonexistent/system",
+                               100),
+             -1);
+  EXPECT_FALSE (listener.error ().empty ());
+  EXPECT_TRUE (listener.fds ().empty ());
+  std::vector<SessionEvent> events;
+  EXPECT_EQ (listener.drain (events), 0u);
+}
+
+#endif
@@ -0,0 +1,97 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/StartupSnapshot.hpp>
+#include <gtest/gtest.h>
+
+#include "TempDir.hpp"
+
+#include <filesystem>
+#include <fstream>
+
+namespace {
+
+  // a config.json to stamp the snapshot with, and where the snapshot goes
+  struct Files {
+    TempDir dir;
+    std::filesystem::path config = dir / "config.json", snapshot = dir / "startup.snap";
+    Files () {
+      std::ofstream (config) << R"({ "lat": 50.0755 })";
+    }
+  };
+
+  dotname::StartupSnapshot sample () {
+    dotname::StartupSnapshot snapshot;
+    snapshot.lat = 50.0755;
+    snapshot.lon = 14.4378;
+    snapshot.utcOffsetMinutes = 120;
+    snapshot.timeZone = "Europe/Prague";
+    snapshot.zoneDerived = true;
+    snapshot.riseOffsetMinutes = -15;
+    snapshot.setOffsetMinutes = 30;
+    snapshot.themeTimeoutMs = 1500;
+    snapshot.themeBackends = { "gnome", "kde" };
+    snapshot.year = 2025;
+    snapshot.month = 6;
+    snapshot.day = 21;
+    snapshot.state.rc = 0;
+    snapshot.state.rise = 4.9;
+    snapshot.state.set = 21.25;
+    snapshot.state.lightAt = 4.65;
+    snapshot.state.darkAt = 21.75;
+    return snapshot;
+  }
+
+} // namespace
+
+TEST (StartupSnapshot, RoundTrip) {
+  Files files;
+  auto saved = sample ();
+  ASSERT_EQ (dotname::saveStartupSnapshot (files.snapshot, files.config, saved), 0);
+
+  dotname::StartupSnapshot loaded;
+  ASSERT_EQ (dotname::loadStartupSnapshot (files.snapshot, files.config, 2025, 6, 21, loaded), 0);
+  EXPECT_EQ (loaded.lat, saved.lat);
+  EXPECT_EQ (loaded.lon, saved.lon);
+  EXPECT_EQ (loaded.utcOffsetMinutes, saved.utcOffsetMinutes);
+  EXPECT_EQ (loaded.timeZone, saved.timeZone);
+  EXPECT_EQ (loaded.zoneDerived, saved.zoneDerived);
+  EXPECT_EQ (loaded.riseOffsetMinutes, saved.riseOffsetMinutes);
+  EXPECT_EQ (loaded.setOffsetMinutes, saved.setOffsetMinutes);
+  EXPECT_EQ (loaded.themeTimeoutMs, saved.themeTimeoutMs);
+  EXPECT_EQ (loaded.themeBackends, saved.themeBackends);
+  EXPECT_EQ (loaded.state.rc, saved.state.rc);
+  EXPECT_EQ (loaded.state.lightAt, saved.state.lightAt);
+  EXPECT_EQ (loaded.state.darkAt, saved.state.darkAt);
+  EXPECT_FALSE (std::filesystem::exists (files.snapshot.string () + ".tmp"));
+}
+
+TEST (StartupSnapshot, StaleOnNewDateOrConfig) {
+  Files files;
+  ASSERT_EQ (dotname::saveStartupSnapshot (files.snapshot, files.config, sample ()), 0);
+  dotname::StartupSnapshot loaded;
+  EXPECT_NE (dotname::loadStartupSnapshot (files.snapshot, files.config, 2025, 6, 22, loaded), 0);
+
+  // same size, only the mtime moves
+  auto mtime = std::filesystem::last_write_time (files.config);
+  std::filesystem::last_write_time (files.config, mtime + std::chrono::seconds (1));
+  EXPECT_NE (dotname::loadStartupSnapshot (files.snapshot, files.config, 2025, 6, 21, loaded), 0);
+
+  ASSERT_EQ (dotname::saveStartupSnapshot (files.snapshot, files.config, sample ()), 0);
+  std::filesystem::remove (files.config);
+  EXPECT_NE (dotname::loadStartupSnapshot (files.snapshot, files.config, 2025, 6, 21, loaded), 0);
+}
+
+TEST (StartupSnapshot, RejectsForeignFiles) {
+  Files files;
+  dotname::StartupSnapshot loaded;
+  EXPECT_NE (dotname::loadStartupSnapshot (files.snapshot, files.config, 2025, 6, 21, loaded), 0);
+
+  ASSERT_EQ (dotname::saveStartupSnapshot (files.snapshot, files.config, sample ()), 0);
+  std::filesystem::resize_file (files.snapshot, 16); // truncated
+  EXPECT_NE (dotname::loadStartupSnapshot (files.snapshot, files.config, 2025, 6, 21, loaded), 0);
+
+  auto tooMany = sample ();
+  tooMany.themeBackends.assign (40, "gsettings");
+  EXPECT_NE (dotname::saveStartupSnapshot (files.snapshot, files.config, tooMany), 0);
+}
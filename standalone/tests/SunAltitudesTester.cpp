@@ -0,0 +1,58 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/SunAltitudes.hpp>
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "SunrisetC/sunriset.h"
+}
+
+TEST (SunAltitudes, MatchesSeparateSunrisetCalls) {
+  const double lat = 50.0755, lon = 14.4378;
+  const std::vector<dotname::SunAltitude> altitudes
+      = { dotname::SunAltitudes::RiseSet, dotname::SunAltitudes::CivilTwilight,
+          dotname::SunAltitudes::NauticalTwilight, dotname::SunAltitudes::AstronomicalTwilight };
+  auto crossings = dotname::sunCrossings (2025, 5, 20, lon, lat, altitudes);
+  ASSERT_EQ (crossings.size (), altitudes.size ());
+
+  for (std::size_t i = 0; i < altitudes.size (); ++i) {
+    double rise, set;
+    int rc = __sunriset__ (2025, 5, 20, lon, lat, altitudes[i].altit, altitudes[i].upperLimb,
+                           &rise, &set);
+    EXPECT_EQ (crossings[i].rc, rc);
+    EXPECT_DOUBLE_EQ (crossings[i].rise, rise);
+    EXPECT_DOUBLE_EQ (crossings[i].set, set);
+    EXPECT_NEAR (crossings[i].dayLength,
+                 __daylen__ (2025, 5, 20, lon, lat, altitudes[i].altit, altitudes[i].upperLimb),
+                 1e-9);
+  }
+}
+
+TEST (SunAltitudes, CustomElevationsAreOrdered) {
+  // golden hour ends after sunrise, blue hour starts before it
+  const dotname::SunAltitude altitudes[]
+      = { dotname::SunAltitudes::BlueHour, dotname::SunAltitudes::RiseSet,
+          dotname::SunAltitudes::GoldenHour };
+  dotname::SunCrossing out[3];
+  dotname::sunCrossings (2025, 3, 20, 2.3522, 48.8566, altitudes, 3, out);
+  EXPECT_LT (out[0].rise, out[1].rise);
+  EXPECT_LT (out[1].rise, out[2].rise);
+  EXPECT_GT (out[0].set, out[1].set);
+  EXPECT_GT (out[1].set, out[2].set);
+}
+
+TEST (SunAltitudes, PolarDayAndNight) {
+  const dotname::SunAltitude altitudes[]
+      = { dotname::SunAltitudes::RiseSet, dotname::SunAltitudes::AstronomicalTwilight };
+  dotname::SunCrossing out[2];
+  // Svalbard, midsummer: sun and twilight never end
+  dotname::sunCrossings (2025, 6, 21, 15.6, 78.2, altitudes, 2, out);
+  EXPECT_EQ (out[0].rc, 1);
+  EXPECT_EQ (out[0].dayLength, 24.0);
+  // Svalbard, midwinter: no sunrise, but still astronomical twilight
+  dotname::sunCrossings (2025, 12, 21, 15.6, 78.2, altitudes, 2, out);
+  EXPECT_EQ (out[0].rc, -1);
+  EXPECT_EQ (out[0].dayLength, 0.0);
+  EXPECT_EQ (out[1].rc, 0);
+}
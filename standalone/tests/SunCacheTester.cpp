@@ -0,0 +1,77 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/SunCache.hpp>
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+extern "C" {
+#include "SunrisetC/sunriset.h"
+}
+
+TEST (SunCache, HitsWithinQuantumCell) {
+  dotname::SunCache cache;
+  auto a = cache.get (50.0755, 14.4378, 2025, 5, 20);
+  auto b = cache.get (50.0751, 14.4372, 2025, 5, 20); // same 0.01 degree cell
+  auto c = cache.get (50.0755, 14.4378, 2025, 5, 21);
+  EXPECT_EQ (a.rise, b.rise);
+  EXPECT_EQ (a.riseTimeUT, b.riseTimeUT);
+  EXPECT_NE (a.rise, c.rise);
+
+  double rise, set;
+  sun_rise_set (2025, 5, 20, 14.4378, 50.0755, &rise, &set);
+  EXPECT_NEAR (a.rise, rise, 5.0 / 3600.0);
+  EXPECT_NEAR (a.set, set, 5.0 / 3600.0);
+  EXPECT_EQ (a.riseTimeUT, "3:08"); // 05:08 CEST in Prague on May 20
+
+  auto s = cache.stats ();
+  EXPECT_EQ (s.hits, 1u);
+  EXPECT_EQ (s.misses, 2u);
+  EXPECT_EQ (s.entries, 2u);
+  EXPECT_EQ (s.evictions, 0u);
+}
+
+TEST (SunCache, PolesStayInRange) {
+  // the cell of lat 90 must not be evaluated beyond the pole, in the other hemisphere
+  dotname::SunCache cache;
+  double rise, set;
+  for (double lat : { 90.0, -90.0, 89.999 }) {
+    for (int month : { 6, 12 }) {
+      int rc = sun_rise_set (2025, month, 21, 0.0, lat, &rise, &set);
+      EXPECT_EQ (cache.get (lat, 0.0, 2025, month, 21).rc, rc) << lat << " " << month;
+    }
+  }
+}
+
+TEST (SunCache, EvictsWithinMemoryCap) {
+  dotname::SunCache cache (64 * dotname::SunCache::entryBytes (), 4);
+  EXPECT_EQ (cache.stats ().capacity, 64u);
+  for (int day = 1; day <= 28; ++day)
+    for (int lat = 0; lat < 10; ++lat)
+      cache.get (lat, 0.0, 2025, 1, day);
+  auto s = cache.stats ();
+  EXPECT_LE (s.entries, 64u);
+  EXPECT_LE (s.memoryBytes, 64 * dotname::SunCache::entryBytes ());
+  EXPECT_EQ (s.misses, 280u);
+  EXPECT_EQ (s.evictions, 280u - s.entries);
+
+  cache.clear ();
+  EXPECT_EQ (cache.stats ().entries, 0u);
+}
+
+TEST (SunCache, ConcurrentCountersAddUp) {
+  dotname::SunCache cache;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t)
+    threads.emplace_back ([&cache] {
+      for (int i = 0; i < 5000; ++i)
+        cache.get (40.0 + i % 50, -3.0, 2025, 6, 1 + i % 7);
+    });
+  for (auto& t : threads)
+    t.join ();
+  auto s = cache.stats ();
+  EXPECT_EQ (s.hits + s.misses, 20000u);
+  EXPECT_EQ (s.entries, 350u);
+}
@@ -0,0 +1,79 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/SunEngine.hpp>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+extern "C" {
+#include "SunrisetC/sunriset.h"
+}
+
+namespace {
+
+  // Worst case of an engine against the reference over random dates/locations, seconds
+  double maxErrorSeconds (dotname::SunEngine engine, double altit, int upperLimb) {
+    std::mt19937 rng (3);
+    std::uniform_int_distribution<int> year (1801, 2099), month (1, 12), day (1, 28);
+    std::uniform_real_distribution<double> lat (-65.0, 65.0), lon (-180.0, 180.0);
+    double worst = 0.0;
+    for (int i = 0; i < 20000; ++i) {
+      int y = year (rng), m = month (rng), d = day (rng);
+      double la = lat (rng), lo = lon (rng), r0, s0, r1, s1;
+      int rc0 = dotname::sunriset (dotname::SunEngine::Reference, y, m, d, lo, la, altit,
+                                   upperLimb, &r0, &s0);
+      int rc1 = dotname::sunriset (engine, y, m, d, lo, la, altit, upperLimb, &r1, &s1);
+      EXPECT_EQ (rc0, rc1);
+      worst = std::max ({ worst, std::fabs (r0 - r1), std::fabs (s0 - s1) });
+
+      double l0 = dotname::daylen (dotname::SunEngine::Reference, y, m, d, lo, la, altit,
+                                   upperLimb);
+      double l1 = dotname::daylen (engine, y, m, d, lo, la, altit, upperLimb);
+      worst = std::max (worst, std::fabs (l0 - l1));
+    }
+    return worst * 3600.0;
+  }
+
+} // namespace
+
+TEST (SunEngine, ReferenceIsSunriset) {
+  double r0, s0, r1, s1;
+  int rc0 = sun_rise_set (2025, 5, 20, 14.4378, 50.0755, &r0, &s0);
+  int rc1 = dotname::sunriset (dotname::SunEngine::Reference, 2025, 5, 20, 14.4378, 50.0755,
+                               -35.0 / 60.0, 1, &r1, &s1);
+  EXPECT_EQ (rc0, rc1);
+  EXPECT_EQ (r0, r1);
+  EXPECT_EQ (s0, s1);
+}
+
+TEST (SunEngine, EphemerisTableWithinTenthOfSecond) {
+  EXPECT_LT (maxErrorSeconds (dotname::SunEngine::EphemerisTable, -35.0 / 60.0, 1), 0.1);
+  EXPECT_LT (maxErrorSeconds (dotname::SunEngine::EphemerisTable, -18.0, 0), 0.1);
+}
+
+TEST (SunEngine, EphemerisTablePolarCases) {
+  double rise, set;
+  // Tromsø: polar night in December, midnight sun in June
+  EXPECT_EQ (dotname::sunriset (dotname::SunEngine::EphemerisTable, 2025, 12, 21, 18.95, 69.65,
+                                -35.0 / 60.0, 1, &rise, &set),
+             -1);
+  EXPECT_EQ (dotname::sunriset (dotname::SunEngine::EphemerisTable, 2025, 6, 21, 18.95, 69.65,
+                                -35.0 / 60.0, 1, &rise, &set),
+             1);
+  EXPECT_EQ (dotname::daylen (dotname::SunEngine::EphemerisTable, 2025, 6, 21, 18.95, 69.65,
+                              -35.0 / 60.0, 1),
+             24.0);
+}
+
+TEST (SunEngine, OutsideTableFallsBackToReference) {
+  double r0, s0, r1, s1;
+  dotname::sunriset (dotname::SunEngine::Reference, 2150, 3, 1, 0.0, 45.0, -35.0 / 60.0, 1, &r0,
+                     &s0);
+  dotname::sunriset (dotname::SunEngine::EphemerisTable, 2150, 3, 1, 0.0, 45.0, -35.0 / 60.0, 1,
+                     &r1, &s1);
+  EXPECT_EQ (r0, r1);
+  EXPECT_EQ (s0, s1);
+}
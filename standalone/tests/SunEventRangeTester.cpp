@@ -0,0 +1,64 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/SunEventRange.hpp>
+#include <SunrisetWorker/SunrisetBatch.hpp>
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+extern "C" {
+#include "SunrisetC/sunriset.h"
+}
+
+namespace {
+
+  void expectMatchesPerDay (double lat, double lon, dotname::SunAltitude altitude) {
+    const int from = dotname::dayNumber (1950, 1, 1);
+    const int to = dotname::dayNumber (2049, 12, 31);
+    int expectedDay = from;
+    double worst = 0.0;
+    for (const auto& ev : dotname::SunEventRange (lat, lon, from, to, altitude)) {
+      ASSERT_EQ (ev.dayNumber, expectedDay++);
+      double rise, set;
+      // days_since_2000_Jan_0 (2000, 1, n) == n
+      int rc = __sunriset__ (2000, 1, ev.dayNumber, lon, lat, altitude.altit,
+                             altitude.upperLimb, &rise, &set);
+      ASSERT_EQ (ev.rc, rc) << "day " << ev.dayNumber;
+      worst = std::fmax (worst, std::fmax (std::fabs (ev.rise - rise), std::fabs (ev.set - set)));
+    }
+    EXPECT_EQ (expectedDay, to + 1);
+    EXPECT_LT (worst * 3600.0, 0.001) << "lat " << lat;
+  }
+
+} // namespace
+
+TEST (SunEventRange, MatchesPerDayCallsOverCentury) {
+  expectMatchesPerDay (50.0755, 14.4378, dotname::SunAltitudes::RiseSet);
+  expectMatchesPerDay (-37.8136, 144.9631, dotname::SunAltitudes::CivilTwilight);
+  expectMatchesPerDay (69.65, 18.95, dotname::SunAltitudes::RiseSet); // polar cases
+}
+
+TEST (SunEventRange, EmptyAndSingleDay) {
+  dotname::SunEventRange empty (50.0, 14.0, 10, 9);
+  EXPECT_EQ (empty.size (), 0u);
+  EXPECT_TRUE (empty.begin () == empty.end ());
+
+  dotname::SunEventRange one (50.0, 14.0, 100, 100);
+  EXPECT_EQ (one.size (), 1u);
+  int n = 0;
+  for (const auto& ev : one) {
+    EXPECT_EQ (ev.dayNumber, 100);
+    ++n;
+  }
+  EXPECT_EQ (n, 1);
+}
+
+TEST (SunEventRange, BeginRestarts) {
+  dotname::SunEventRange range (50.0, 14.0, 0, 9);
+  auto it = range.begin ();
+  ++it;
+  ++it;
+  EXPECT_EQ (it->dayNumber, 2);
+  EXPECT_EQ (range.begin ()->dayNumber, 0);
+}
@@ -0,0 +1,78 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/SunGridFile.hpp>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <random>
+
+extern "C" {
+#include "SunrisetC/sunriset.h"
+}
+
+namespace {
+
+  std::filesystem::path gridFile () {
+    static const std::filesystem::path file = [] {
+      auto path = std::filesystem::temp_directory_path () / "SunGridFileTester.bin";
+      dotname::SunGridFileSpec spec;
+      spec.latStep = 2.0;
+      spec.lonStep = 30.0;
+      spec.validationSamples = 20000;
+      EXPECT_EQ (dotname::buildSunGridFile (path, spec, 2), 0);
+      return path;
+    }();
+    return file;
+  }
+
+} // namespace
+
+TEST (SunGridFile, WithinToleranceOfSunriset) {
+  dotname::SunGridFile grid (gridFile ());
+  ASSERT_TRUE (grid.isOpen ());
+  const auto& h = grid.header ();
+  EXPECT_EQ (h.version, dotname::kSunGridFileVersion);
+  EXPECT_EQ (h.rows, 91u);
+  EXPECT_EQ (h.columns, 13u);
+  EXPECT_LE (h.maxErrorSeconds, h.toleranceSeconds);
+
+  std::mt19937 rng (9);
+  std::uniform_int_distribution<int> year (h.validFromYear, h.validToYear), month (1, 12),
+      day (1, 28);
+  std::uniform_real_distribution<double> lat (-90.0, 90.0), lon (-180.0, 180.0);
+  for (int i = 0; i < 50000; ++i) {
+    int y = year (rng), m = month (rng), d = day (rng);
+    double la = lat (rng), lo = lon (rng), r0, s0, r1, s1;
+    int rc0 = __sunriset__ (y, m, d, lo, la, -35.0 / 60.0, 1, &r0, &s0);
+    int rc1 = grid.sunriset (y, m, d, lo, la, &r1, &s1);
+    ASSERT_EQ (rc0, rc1) << y << "-" << m << "-" << d << " " << la << " " << lo;
+    EXPECT_LE (std::fabs (r0 - r1) * 3600.0, h.toleranceSeconds);
+    EXPECT_LE (std::fabs (s0 - s1) * 3600.0, h.toleranceSeconds);
+  }
+
+  // Feb 29 has its own slot
+  double r0, s0, r1, s1;
+  __sunriset__ (2028, 2, 29, 14.4378, 50.0755, -35.0 / 60.0, 1, &r0, &s0);
+  grid.sunriset (2028, 2, 29, 14.4378, 50.0755, &r1, &s1);
+  EXPECT_NEAR (r0, r1, h.toleranceSeconds / 3600.0);
+}
+
+TEST (SunGridFile, SharedAcrossMovesAndRejectsForeignFiles) {
+  dotname::SunGridFile a (gridFile ());
+  dotname::SunGridFile b = std::move (a);
+  EXPECT_FALSE (a.isOpen ());
+  EXPECT_TRUE (b.isOpen ());
+
+  auto bogus = std::filesystem::temp_directory_path () / "SunGridFileTester.bogus";
+  std::ofstream (bogus) << "not a sun grid file, just long enough to cover the header bytes"
+                        << std::string (64, '.');
+  dotname::SunGridFile c;
+  EXPECT_EQ (c.open (bogus), -1);
+  EXPECT_FALSE (c.isOpen ());
+  EXPECT_EQ (c.open ("/nonexistent/sungrid.bin"), -1);
+  std::filesystem::remove (bogus);
+}
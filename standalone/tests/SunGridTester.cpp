@@ -0,0 +1,89 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/SunGrid.hpp>
+#include <SunrisetWorker/SunrisetBatch.hpp>
+#include <gtest/gtest.h>
+
+#include "ThreadPool/WorkStealingPool.hpp"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+extern "C" {
+#include "SunrisetC/sunriset.h"
+}
+
+namespace {
+
+  dotname::SunGridSpec europe () {
+    dotname::SunGridSpec spec;
+    spec.latMin = 35.0;
+    spec.latMax = 71.0;
+    spec.lonMin = -25.0;
+    spec.lonMax = 45.0;
+    spec.resolution = 0.5;
+    spec.fromDay = dotname::dayNumber (2025, 6, 20);
+    spec.toDay = dotname::dayNumber (2025, 6, 22);
+    spec.altitudes = { dotname::SunAltitudes::RiseSet, dotname::SunAltitudes::CivilTwilight };
+    return spec;
+  }
+
+} // namespace
+
+TEST (WorkStealingPool, RunsEveryIndexOnce) {
+  dotname::WorkStealingPool pool (4);
+  EXPECT_EQ (pool.size (), 4u);
+  std::vector<std::atomic<int>> hits (10007);
+  for (int round = 0; round < 3; ++round)
+    pool.parallelFor (hits.size (), [&] (std::size_t i, unsigned) { ++hits[i]; });
+  for (const auto& h : hits)
+    EXPECT_EQ (h.load (), 3);
+
+  EXPECT_THROW (pool.parallelFor (100,
+                                  [] (std::size_t i, unsigned) {
+                                    if (i == 42)
+                                      throw std::runtime_error ("task");
+                                  }),
+                std::runtime_error);
+}
+
+TEST (SunGrid, MatchesSunCrossingsPerCell) {
+  auto spec = europe ();
+  dotname::SunGridEngine engine (3);
+  std::vector<dotname::SunCrossing> out (spec.size ());
+  engine.compute (spec, out.data ());
+
+  ASSERT_EQ (spec.rows (), 73u);
+  ASSERT_EQ (spec.columns (), 141u);
+  for (int day = spec.fromDay; day <= spec.toDay; ++day)
+    for (std::size_t r = 0; r < spec.rows (); r += 7)
+      for (std::size_t c = 0; c < spec.columns (); c += 5) {
+        double lat = spec.latMin + spec.resolution * r;
+        double lon = spec.lonMin + spec.resolution * c;
+        // day number passes through as the day of 2000 Jan
+        auto ref = dotname::sunCrossings (2000, 1, day, lon, lat, spec.altitudes);
+        for (std::size_t a = 0; a < ref.size (); ++a) {
+          const auto& x = out[spec.index (day, r, c, a)];
+          EXPECT_EQ (x.rc, ref[a].rc);
+          EXPECT_DOUBLE_EQ (x.rise, ref[a].rise);
+          EXPECT_DOUBLE_EQ (x.set, ref[a].set);
+          EXPECT_DOUBLE_EQ (x.dayLength, ref[a].dayLength);
+        }
+      }
+}
+
+TEST (SunGrid, ArenaAndThreadCountsAgree) {
+  auto spec = europe ();
+  dotname::SunGridEngine single (1), many (4);
+  std::vector<dotname::SunCrossing> out (spec.size ());
+  single.compute (spec, out.data ());
+  const dotname::SunCrossing* arena = many.compute (spec);
+  for (std::size_t i = 0; i < out.size (); ++i) {
+    EXPECT_EQ (arena[i].rc, out[i].rc);
+    EXPECT_EQ (arena[i].rise, out[i].rise);
+  }
+  // same spec again reuses the arena
+  EXPECT_EQ (many.compute (spec), arena);
+}
@@ -0,0 +1,121 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/SunAltitudes.hpp>
+#include <SunrisetWorker/SunRamp.hpp>
+#include <SunrisetWorker/SunrisetBatch.hpp>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <ctime>
+#include <vector>
+
+namespace {
+
+  using Clock = std::chrono::system_clock;
+
+  Clock::time_point utc (int y, int m, int d, int hh, int mm) {
+    std::tm t{};
+    t.tm_year = y - 1900;
+    t.tm_mon = m - 1;
+    t.tm_mday = d;
+    t.tm_hour = hh;
+    t.tm_min = mm;
+#ifdef _WIN32
+    return Clock::from_time_t (_mkgmtime (&t));
+#else
+    return Clock::from_time_t (timegm (&t));
+#endif
+  }
+
+  Clock::time_point hoursUt (int y, int m, int d, double hours) {
+    return utc (y, m, d, 0, 0)
+           + std::chrono::duration_cast<Clock::duration> (std::chrono::duration<double> (
+               hours * 3600.0));
+  }
+
+} // namespace
+
+TEST (SunRamp, ElevationMatchesTwilightCrossings) {
+  struct Place {
+    double lat, lon;
+  };
+  for (Place p : { Place { 50.0755, 14.4378 }, Place { -33.87, 151.21 }, Place { 64.1, -21.9 },
+                   Place { 1.35, 103.8 } }) {
+    // the curve belongs to the local date, as the crossings do
+    int utcOffset = static_cast<int> (std::lround (p.lon / 15.0)) * 60;
+    dotname::SunRamp ramp (p.lat, p.lon, utcOffset, {});
+    for (int month = 1; month <= 12; ++month) {
+      auto c = dotname::sunCrossings (2025, month, 15, p.lon, p.lat,
+                                      { dotname::SunAltitudes::CivilTwilight });
+      if (c[0].rc != 0)
+        continue; // white nights in Reykjavik
+      EXPECT_NEAR (ramp.elevationAt (hoursUt (2025, month, 15, c[0].rise)), -6.0, 0.1);
+      EXPECT_NEAR (ramp.elevationAt (hoursUt (2025, month, 15, c[0].set)), -6.0, 0.1);
+    }
+  }
+}
+
+TEST (SunRamp, TwilightIsAFewDozenWrites) {
+  dotname::SunRamp ramp (50.0755, 14.4378, 60, {});
+  std::vector<double> values;
+  auto from = utc (2025, 3, 20, 0, 0) - std::chrono::hours (1); // local midnight
+  for (int second = 0; second < 86400; ++second)
+    ramp.fire (from + std::chrono::seconds (second), [&] (double v) { values.push_back (v); });
+
+  // 3500 K at night, 30 steps of 100 K up in the morning and down in the evening
+  ASSERT_EQ (values.size (), 61u);
+  EXPECT_EQ (values.front (), 3500.0);
+  EXPECT_EQ (values[30], 6500.0);
+  EXPECT_EQ (values.back (), 3500.0);
+  for (std::size_t i = 1; i < values.size (); ++i)
+    EXPECT_EQ (std::fabs (values[i] - values[i - 1]), 100.0);
+  EXPECT_EQ (ramp.stats ().coalesced, 0u);
+  EXPECT_EQ (ramp.stats ().rateLimited, 0u);
+}
+
+TEST (SunRamp, CoalescesLateAndRateLimitedUpdates) {
+  dotname::SunRampSpec spec;
+  spec.minInterval = std::chrono::minutes (5);
+  dotname::SunRamp ramp (50.0755, 14.4378, 60, spec);
+  std::vector<Clock::time_point> writes;
+  std::vector<double> values;
+  auto from = utc (2025, 3, 20, 0, 0) - std::chrono::hours (1);
+  for (int second = 0; second < 86400; ++second) {
+    auto now = from + std::chrono::seconds (second);
+    if (ramp.fire (now, [&] (double v) { values.push_back (v); }))
+      writes.push_back (now);
+  }
+
+  ASSERT_GT (values.size (), 2u);
+  EXPECT_LT (values.size (), 61u);
+  for (std::size_t i = 1; i < writes.size (); ++i)
+    EXPECT_GE (writes[i] - writes[i - 1], spec.minInterval);
+  // the held back values still arrive: day reached in the morning, night at the end
+  EXPECT_NE (std::find (values.begin (), values.end (), 6500.0), values.end ());
+  EXPECT_EQ (values.back (), 3500.0);
+  EXPECT_GT (ramp.stats ().rateLimited, 0u);
+  EXPECT_GT (ramp.stats ().coalesced, 0u);
+}
+
+TEST (SunRamp, NextAtIsTheNextChange) {
+  dotname::SunRamp ramp (50.0755, 14.4378, 60, {});
+  auto from = utc (2025, 3, 20, 0, 0) - std::chrono::hours (1);
+  auto noop = [] (double) {};
+  ramp.fire (from, noop);
+  std::size_t wakes = 0;
+  for (auto t = ramp.nextAt (); t < from + std::chrono::hours (24); t = ramp.nextAt ()) {
+    EXPECT_EQ (ramp.fire (t, noop), 1u);
+    ++wakes;
+  }
+  EXPECT_EQ (wakes, 60u);
+}
+
+TEST (SunRamp, PolarDayHoldsDayValue) {
+  dotname::SunRamp ramp (78.2, 15.6, 120, {});
+  double start = 0.0;
+  EXPECT_TRUE (ramp.plan (ramp.localDay (utc (2025, 6, 21, 12, 0)), &start).empty ());
+  EXPECT_EQ (start, 6500.0);
+}
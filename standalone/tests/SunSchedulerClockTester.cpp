@@ -0,0 +1,213 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/ClockWatch.hpp>
+#include <SunrisetWorker/SunScheduler.hpp>
+#include <gtest/gtest.h>
+
+#include "TempDir.hpp"
+
+#include <chrono>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+// Clock steps, suspend and zone changes against a virtual clock: every call passes its
+// own `now` and the zone is a function of the instant
+
+namespace {
+
+  using Clock = std::chrono::system_clock;
+  using std::chrono::hours;
+  using std::chrono::minutes;
+
+  Clock::time_point utc (int y, int m, int d, int hh, int mm) {
+    std::tm t{};
+    t.tm_year = y - 1900;
+    t.tm_mon = m - 1;
+    t.tm_mday = d;
+    t.tm_hour = hh;
+    t.tm_min = mm;
+#ifdef _WIN32
+    return Clock::from_time_t (_mkgmtime (&t));
+#else
+    return Clock::from_time_t (timegm (&t));
+#endif
+  }
+
+  // Europe/Prague in 2025: CEST from March 30 to October 26, 01:00 UTC both
+  int prague (Clock::time_point t) {
+    return t >= utc (2025, 3, 30, 1, 0) && t < utc (2025, 10, 26, 1, 0) ? 120 : 60;
+  }
+
+  dotname::SunStateParams pragueParams () {
+    dotname::SunStateParams p;
+    p.lat = 50.0755;
+    p.lon = 14.4378;
+    p.utcOffsetMinutes = 60;
+    return p;
+  }
+
+  struct Recorder {
+    std::vector<dotname::SunScheduleEvent> events;
+    dotname::SunScheduler::Callback callback () {
+      return [this] (const dotname::SunScheduleEvent& e) { events.push_back (e); };
+    }
+  };
+
+} // namespace
+
+TEST (SunSchedulerClock, LocalScheduleFollowsDst) {
+  Recorder fired;
+  dotname::SunScheduler scheduler (fired.callback (), prague);
+  auto start = utc (2025, 3, 29, 12, 0);
+  auto local = scheduler.addLocal (pragueParams (), start);
+  scheduler.add (pragueParams (), start); // stays on +60
+  // late offsets put the dark trigger next to local midnight, where the offset matters
+  dotname::SunStateParams late = pragueParams ();
+  late.setOffsetMinutes = 300;
+  auto lateLocal = scheduler.addLocal (late, start);
+
+  for (auto now = start; now < start + hours (72); now += minutes (5)) {
+    scheduler.fire (now);
+    // the scheduler wakes up for the switch to CEST even with no transition due then
+    if (now == utc (2025, 3, 30, 0, 30)) {
+      EXPECT_EQ (scheduler.nextWake (), utc (2025, 3, 30, 1, 0));
+    }
+    dotname::SunStateParams expected = late;
+    expected.utcOffsetMinutes = prague (now);
+    EXPECT_EQ (scheduler.isDay (lateLocal),
+               dotname::SunStateEngine (expected).stateAt (now).isDay);
+    expected = pragueParams ();
+    expected.utcOffsetMinutes = prague (now);
+    EXPECT_EQ (scheduler.isDay (local), dotname::SunStateEngine (expected).stateAt (now).isDay);
+  }
+  // only the two local schedules were recomputed for the switch
+  EXPECT_EQ (scheduler.stats ().retimed, 2u);
+  EXPECT_EQ (scheduler.stats ().resyncs, 0u);
+}
+
+TEST (SunSchedulerClock, ZoneChangeRetimesOnlyLocalSchedules) {
+  Recorder fired;
+  int offset = 60;
+  dotname::SunScheduler scheduler (fired.callback (),
+                                   [&offset] (Clock::time_point) { return offset; });
+  auto now = utc (2025, 6, 19, 0, 15);
+  for (int i = 0; i < 100; ++i) {
+    dotname::SunStateParams p = pragueParams ();
+    p.lon += i * 0.01;
+    scheduler.add (p, now);
+  }
+  dotname::SunStateParams p = pragueParams ();
+  // dark from about 01:15 local, taken from the sunset of the same date
+  p.setOffsetMinutes = 300;
+  auto id = scheduler.addLocal (p, now);
+  ASSERT_TRUE (scheduler.isDay (id));
+  const auto windows = scheduler.stats ().windows;
+
+  // moved to the Azores (-60): 23:15 local, past that date's dark trigger
+  offset = -60;
+  EXPECT_EQ (scheduler.zoneChanged (now), 1u);
+  ASSERT_EQ (fired.events.size (), 1u);
+  EXPECT_EQ (fired.events[0].id, id);
+  EXPECT_FALSE (fired.events[0].toLight);
+  EXPECT_EQ (fired.events[0].at, now);
+  EXPECT_EQ (scheduler.stats ().retimed, 1u);
+  EXPECT_EQ (scheduler.stats ().windows, windows);
+
+  // an unchanged zone costs nothing
+  EXPECT_EQ (scheduler.zoneChanged (now + minutes (1)), 0u);
+  EXPECT_EQ (scheduler.stats ().retimed, 1u);
+
+  // and the retimed schedule fires its next trigger at the new offset
+  p.utcOffsetMinutes = offset;
+  auto next = dotname::SunStateEngine (p).nextTransition (now);
+  ASSERT_TRUE (next.found);
+  EXPECT_TRUE (next.toLight);
+  scheduler.fire (next.at - std::chrono::seconds (1));
+  EXPECT_FALSE (scheduler.isDay (id));
+  scheduler.fire (next.at + std::chrono::seconds (1));
+  EXPECT_TRUE (scheduler.isDay (id));
+}
+
+TEST (SunSchedulerClock, ClockStepBackward) {
+  Recorder fired;
+  dotname::SunScheduler scheduler (fired.callback ());
+  auto id = scheduler.add (pragueParams (), utc (2025, 6, 18, 10, 0));
+  scheduler.fire (utc (2025, 6, 18, 20, 0));
+  ASSERT_FALSE (scheduler.isDay (id));
+  fired.events.clear ();
+
+  // NTP pulls the clock back to the morning: light again right away, not tomorrow
+  auto stepped = utc (2025, 6, 18, 11, 0);
+  EXPECT_EQ (scheduler.clockChanged (stepped), 1u);
+  ASSERT_EQ (fired.events.size (), 1u);
+  EXPECT_TRUE (fired.events[0].toLight);
+  EXPECT_EQ (fired.events[0].at, stepped);
+  EXPECT_EQ (scheduler.stats ().resyncs, 1u);
+  EXPECT_LT (scheduler.nextWake (), utc (2025, 6, 18, 20, 0));
+
+  // the evening trigger is pending again
+  EXPECT_EQ (scheduler.fire (utc (2025, 6, 18, 20, 0)), 1u);
+  EXPECT_FALSE (scheduler.isDay (id));
+}
+
+TEST (SunSchedulerClock, ClockStepForward) {
+  Recorder fired;
+  dotname::SunScheduler scheduler (fired.callback ());
+  auto id = scheduler.add (pragueParams (), utc (2025, 6, 18, 10, 0));
+  // a step over the dark trigger reports the state at the new time, once
+  auto stepped = utc (2025, 6, 18, 22, 0);
+  EXPECT_EQ (scheduler.clockChanged (stepped), 1u);
+  EXPECT_FALSE (scheduler.isDay (id));
+  EXPECT_EQ (fired.events.back ().at, stepped);
+  EXPECT_EQ (scheduler.fire (stepped), 0u);
+  // a step that does not cross a trigger fires nothing
+  EXPECT_EQ (scheduler.clockChanged (stepped + minutes (30)), 0u);
+}
+
+TEST (SunSchedulerClock, ResumeAfterDays) {
+  Recorder fired;
+  dotname::SunScheduler scheduler (fired.callback (), prague);
+  auto start = utc (2025, 3, 28, 12, 0);
+  auto id = scheduler.addLocal (pragueParams (), start);
+  // suspended over the DST switch, resumed three days later at night
+  auto resumed = utc (2025, 3, 31, 21, 0);
+  EXPECT_EQ (scheduler.clockChanged (resumed), 1u);
+  EXPECT_FALSE (scheduler.isDay (id));
+  EXPECT_EQ (fired.events.back ().at, resumed);
+  // the next morning comes in at CEST
+  dotname::SunStateParams p = pragueParams ();
+  p.utcOffsetMinutes = 120;
+  auto next = dotname::SunStateEngine (p).nextTransition (resumed);
+  ASSERT_TRUE (next.found);
+  EXPECT_EQ (scheduler.nextWake (), utc (2025, 3, 31, 22, 0)); // local midnight in CEST
+  scheduler.fire (next.at + std::chrono::seconds (1));
+  EXPECT_TRUE (scheduler.isDay (id));
+  EXPECT_LE (std::chrono::abs (fired.events.back ().at - next.at), std::chrono::seconds (1));
+}
+
+#if defined(__linux__)
+
+TEST (ClockWatch, ReportsReplacedZoneFile) {
+  TempDir dir;
+  std::ofstream (dir / "localtime") << "CET";
+
+  {
+    dotname::ClockWatch watch (dir / "localtime");
+    EXPECT_EQ (watch.fds ().size (), 2u);
+    EXPECT_EQ (watch.check (), 0u);
+
+    std::ofstream (dir / "unrelated") << "x";
+    EXPECT_EQ (watch.check () & dotname::kZoneChanged, 0u);
+
+    // the way timedatectl set-timezone swaps the link
+    std::ofstream (dir / "localtime.new") << "EST";
+    std::filesystem::rename (dir / "localtime.new", dir / "localtime");
+    EXPECT_NE (watch.check () & dotname::kZoneChanged, 0u);
+    EXPECT_EQ (watch.check (), 0u); // drained
+  }
+}
+
+#endif
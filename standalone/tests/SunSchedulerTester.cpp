@@ -0,0 +1,186 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/SunScheduler.hpp>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <future>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace {
+
+  using Clock = std::chrono::system_clock;
+
+  Clock::time_point utc (int y, int m, int d, int hh, int mm) {
+    std::tm t{};
+    t.tm_year = y - 1900;
+    t.tm_mon = m - 1;
+    t.tm_mday = d;
+    t.tm_hour = hh;
+    t.tm_min = mm;
+#ifdef _WIN32
+    return Clock::from_time_t (_mkgmtime (&t));
+#else
+    return Clock::from_time_t (timegm (&t));
+#endif
+  }
+
+  std::vector<dotname::SunStateParams> locations (std::size_t n) {
+    std::vector<dotname::SunStateParams> v (n);
+    std::mt19937 rng (15);
+    std::uniform_real_distribution<double> lat (-80.0, 80.0), lon (-180.0, 180.0);
+    std::uniform_int_distribution<int> offset (-90, 90);
+    for (auto& p : v) {
+      p.lat = lat (rng);
+      p.lon = lon (rng);
+      p.utcOffsetMinutes = static_cast<int> (std::lround (p.lon / 15.0)) * 60;
+      p.riseOffsetMinutes = offset (rng);
+      p.setOffsetMinutes = offset (rng);
+    }
+    return v;
+  }
+
+} // namespace
+
+TEST (SunScheduler, FollowsEngineState) {
+  // every fired state equals SunStateEngine::stateAt (), across day windows, polar
+  // dates and offsets that wrap over local midnight
+  auto params = locations (300);
+  params[0].lat = 78.0; // Svalbard, polar day in June
+  params[1].utcOffsetMinutes = 14 * 60;
+  params[1].setOffsetMinutes = 600;
+
+  std::vector<bool> state (params.size ());
+  std::vector<Clock::time_point> last (params.size (), Clock::time_point::min ());
+  dotname::SunScheduler scheduler ([&] (const dotname::SunScheduleEvent& e) {
+    EXPECT_NE (state[e.id], e.toLight);
+    EXPECT_GE (e.at, last[e.id]);
+    state[e.id] = e.toLight;
+    last[e.id] = e.at;
+  });
+
+  auto start = utc (2025, 6, 18, 7, 13);
+  for (const auto& p : params) {
+    auto id = scheduler.add (p, start);
+    state[id] = scheduler.isDay (id);
+  }
+  ASSERT_EQ (scheduler.size (), params.size ());
+
+  for (auto now = start; now < start + std::chrono::hours (72); now += std::chrono::minutes (7)) {
+    scheduler.fire (now);
+    ASSERT_LE (now, scheduler.nextWake ());
+    for (std::size_t i = 0; i < params.size (); ++i) {
+      bool expected = dotname::SunStateEngine (params[i]).stateAt (now).isDay;
+      // a trigger closer than a second to `now` may round either way
+      bool nearTrigger = std::abs (std::chrono::duration_cast<std::chrono::milliseconds> (
+                                       now - last[i])
+                                       .count ())
+                         < 1000;
+      if (!nearTrigger) {
+        ASSERT_EQ (state[i], expected) << "schedule " << i << " lat " << params[i].lat;
+      }
+    }
+  }
+  EXPECT_TRUE (state[0]); // never dark at 78 N in June
+}
+
+TEST (SunScheduler, MatchesNextTransition) {
+  dotname::SunStateParams p;
+  p.lat = 50.0755;
+  p.lon = 14.4378;
+  p.utcOffsetMinutes = 120;
+  p.riseOffsetMinutes = 60;
+  p.setOffsetMinutes = -30;
+
+  std::vector<dotname::SunScheduleEvent> fired;
+  dotname::SunScheduler scheduler ([&] (const dotname::SunScheduleEvent& e) {
+    fired.push_back (e);
+  });
+  auto now = utc (2025, 5, 20, 6, 24);
+  scheduler.add (p, now);
+  dotname::SunStateEngine engine (p);
+  for (int i = 0; i < 6; ++i) {
+    auto next = engine.nextTransition (now);
+    ASSERT_TRUE (next.found);
+    auto wake = scheduler.nextWake ();
+    ASSERT_LE (wake, next.at + std::chrono::milliseconds (1));
+    fired.clear ();
+    scheduler.fire (next.at + std::chrono::milliseconds (1));
+    ASSERT_EQ (fired.size (), 1u);
+    EXPECT_EQ (fired[0].toLight, next.toLight);
+    EXPECT_LT (std::abs (std::chrono::duration<double> (fired[0].at - next.at).count ()), 1e-3);
+    now = next.at + std::chrono::milliseconds (1);
+  }
+}
+
+TEST (SunScheduler, CancelAndReuse) {
+  int fired = 0;
+  dotname::SunScheduler scheduler ([&] (const dotname::SunScheduleEvent&) { ++fired; });
+  auto params = locations (100);
+  auto now = utc (2025, 3, 1, 0, 0);
+  std::vector<dotname::SunScheduleId> ids;
+  for (const auto& p : params)
+    ids.push_back (scheduler.add (p, now));
+  for (auto id : ids)
+    EXPECT_TRUE (scheduler.remove (id));
+  EXPECT_FALSE (scheduler.remove (ids[0]));
+  EXPECT_EQ (scheduler.size (), 0u);
+  EXPECT_EQ (scheduler.nextWake (), Clock::time_point::max ());
+  EXPECT_EQ (scheduler.fire (now + std::chrono::hours (48)), 0u);
+  EXPECT_EQ (fired, 0);
+
+  auto id = scheduler.add (params[0], now);
+  EXPECT_LT (id, 100u); // slot reused
+}
+
+TEST (SunScheduler, CatchesUpAfterSuspend) {
+  std::vector<dotname::SunScheduleEvent> fired;
+  dotname::SunScheduler scheduler ([&] (const dotname::SunScheduleEvent& e) {
+    fired.push_back (e);
+  });
+  dotname::SunStateParams p;
+  p.lat = 50.0;
+  p.lon = 14.0;
+  auto now = utc (2025, 1, 10, 12, 0); // light
+  auto id = scheduler.add (p, now);
+  ASSERT_TRUE (scheduler.isDay (id));
+  // ten days later at night: one event, no replay of the missed days
+  scheduler.fire (utc (2025, 1, 20, 22, 0));
+  ASSERT_EQ (fired.size (), 1u);
+  EXPECT_FALSE (fired[0].toLight);
+  EXPECT_FALSE (scheduler.isDay (id));
+}
+
+TEST (SunScheduler, RunFiresFromOneThread) {
+  std::thread::id fireThread;
+  std::atomic<int> events { 0 };
+  std::promise<void> fired;
+  dotname::SunScheduler scheduler ([&] (const dotname::SunScheduleEvent&) {
+    fireThread = std::this_thread::get_id ();
+    if (++events == 1)
+      fired.set_value ();
+  });
+  std::thread runner ([&] { scheduler.run (); });
+  // a schedule added with a clock far behind, in the other state than now, has a
+  // transition due right away at any time of day
+  dotname::SunStateParams p;
+  p.lat = 50.0;
+  p.lon = 14.0;
+  const dotname::SunStateEngine engine (p);
+  const auto now = Clock::now ();
+  auto then = now - std::chrono::hours (36);
+  while (engine.stateAt (then).isDay == engine.stateAt (now).isDay)
+    then -= std::chrono::hours (1);
+  scheduler.add (p, then);
+  fired.get_future ().wait_for (std::chrono::seconds (2));
+  scheduler.stop ();
+  auto runnerId = runner.get_id ();
+  runner.join ();
+  EXPECT_GT (events, 0);
+  EXPECT_EQ (fireThread, runnerId);
+}
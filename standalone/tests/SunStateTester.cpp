@@ -0,0 +1,198 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/SunState.hpp>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <ctime>
+#include <thread>
+#include <vector>
+
+extern "C" {
+#include "SunrisetC/sunriset.h"
+}
+
+namespace {
+
+  dotname::SunStateParams prague () {
+    dotname::SunStateParams p;
+    p.lat = 50.0755;
+    p.lon = 14.4378;
+    p.utcOffsetMinutes = 120;
+    p.riseOffsetMinutes = 30;
+    p.setOffsetMinutes = -45;
+    return p;
+  }
+
+} // namespace
+
+TEST (SunState, TriggersAndDayState) {
+  dotname::SunStateEngine engine (prague ());
+  double rise, set;
+  sun_rise_set (2025, 5, 20, 14.4378, 50.0755, &rise, &set);
+
+  auto noon = engine.compute (2025, 5, 20, 12.0);
+  EXPECT_EQ (noon.rc, 0);
+  EXPECT_NEAR (noon.rise, rise + 2.0, 1e-9);
+  EXPECT_NEAR (noon.set, set + 2.0, 1e-9);
+  EXPECT_NEAR (noon.lightAt, noon.rise + 0.5, 1e-9);
+  EXPECT_NEAR (noon.darkAt, noon.set - 0.75, 1e-9);
+  EXPECT_TRUE (noon.isDay);
+
+  // after sunrise, before the light trigger
+  EXPECT_FALSE (engine.compute (2025, 5, 20, noon.rise + 0.25).isDay);
+  // before sunset, after the dark trigger
+  EXPECT_FALSE (engine.compute (2025, 5, 20, noon.set - 0.5).isDay);
+  EXPECT_FALSE (engine.compute (2025, 5, 20, 23.5).isDay);
+}
+
+TEST (SunState, WindowOverMidnightAndPolarCases) {
+  // Auckland in UTC, the local day spans UT midnight
+  dotname::SunStateParams p;
+  p.lat = -36.85;
+  p.lon = 174.76;
+  dotname::SunStateEngine auckland (p);
+  auto s = auckland.compute (2025, 1, 15, 0.0);
+  EXPECT_GT (s.lightAt, s.darkAt);
+  EXPECT_TRUE (s.isDay);                                      // 00:00 UT is 13:00 NZDT
+  EXPECT_FALSE (dotname::SunStateEngine::isDayAt (s, 10.0)); // 23:00 NZDT
+
+  p.lat = 78.22; // Longyearbyen
+  p.lon = 15.65;
+  dotname::SunStateEngine svalbard (p);
+  EXPECT_EQ (svalbard.compute (2025, 6, 21, 0.0).rc, 1);
+  EXPECT_TRUE (svalbard.compute (2025, 6, 21, 0.0).isDay);
+  EXPECT_EQ (svalbard.compute (2025, 12, 21, 12.0).rc, -1);
+  EXPECT_FALSE (svalbard.compute (2025, 12, 21, 12.0).isDay);
+}
+
+TEST (SunState, SharedEngineAcrossThreads) {
+  const dotname::SunStateEngine engine (prague ());
+  auto expected = engine.compute (2025, 3, 1, 9.0);
+  std::vector<std::thread> threads;
+  std::vector<int> mismatches (4, 0);
+  for (int t = 0; t < 4; ++t)
+    threads.emplace_back ([&, t] {
+      for (int i = 0; i < 2000; ++i) {
+        auto s = engine.compute (2025, 3, 1, 9.0);
+        mismatches[t] += s.rise != expected.rise || s.isDay != expected.isDay;
+      }
+    });
+  for (auto& t : threads)
+    t.join ();
+  for (int m : mismatches)
+    EXPECT_EQ (m, 0);
+}
+
+namespace {
+
+  using Clock = std::chrono::system_clock;
+
+  // UTC wall clock -> time_point, no time zone database needed
+  Clock::time_point utc (int y, int m, int d, int hh, int mm) {
+    std::tm t{};
+    t.tm_year = y - 1900;
+    t.tm_mon = m - 1;
+    t.tm_mday = d;
+    t.tm_hour = hh;
+    t.tm_min = mm;
+#ifdef _WIN32
+    return Clock::from_time_t (_mkgmtime (&t));
+#else
+    return Clock::from_time_t (timegm (&t));
+#endif
+  }
+
+  bool isDayAt (const dotname::SunStateEngine& engine, Clock::time_point t) {
+    std::time_t secs = Clock::to_time_t (t) + engine.params ().utcOffsetMinutes * 60;
+    std::tm local{};
+#ifdef _WIN32
+    gmtime_s (&local, &secs);
+#else
+    gmtime_r (&secs, &local);
+#endif
+    double hours = local.tm_hour + local.tm_min / 60.0 + local.tm_sec / 3600.0;
+    return engine.compute (local.tm_year + 1900, local.tm_mon + 1, local.tm_mday, hours).isDay;
+  }
+
+} // namespace
+
+TEST (SunState, NextTransitionSameDayAndRollover) {
+  dotname::SunStateEngine engine (prague ());
+  auto s = engine.compute (2025, 5, 20, 12.0);
+
+  auto next = engine.nextTransition (utc (2025, 5, 20, 10, 0)); // 12:00 local
+  ASSERT_TRUE (next.found);
+  EXPECT_FALSE (next.toLight);
+  double seconds = std::chrono::duration<double> (next.at - utc (2025, 5, 20, 0, 0)).count ();
+  EXPECT_NEAR (seconds / 3600.0, s.darkAt - 2.0, 1e-6);
+
+  // 23:00 local, the next light trigger is tomorrow morning
+  next = engine.nextTransition (utc (2025, 5, 20, 21, 0));
+  ASSERT_TRUE (next.found);
+  EXPECT_TRUE (next.toLight);
+  EXPECT_GT (next.at, utc (2025, 5, 21, 0, 0));
+  EXPECT_LT (next.at, utc (2025, 5, 21, 6, 0));
+}
+
+TEST (SunState, NextTransitionFlipsStateWithNegativeOffsets) {
+  auto p = prague ();
+  p.riseOffsetMinutes = -90;
+  p.setOffsetMinutes = -120;
+  dotname::SunStateEngine engine (p);
+  auto t = utc (2025, 10, 20, 0, 0);
+  for (int i = 0; i < 60; ++i) {
+    auto next = engine.nextTransition (t);
+    ASSERT_TRUE (next.found);
+    EXPECT_GT (next.at, t);
+    EXPECT_EQ (isDayAt (engine, next.at - std::chrono::seconds (1)), !next.toLight);
+    EXPECT_EQ (isDayAt (engine, next.at + std::chrono::seconds (1)), next.toLight);
+    EXPECT_LT (next.at - t, std::chrono::hours (24));
+    t = next.at + std::chrono::seconds (1);
+  }
+}
+
+TEST (SunState, NextTransitionAcrossPolarNightAndDay) {
+  dotname::SunStateParams p;
+  p.lat = 78.22; // Longyearbyen
+  p.lon = 15.65;
+  p.utcOffsetMinutes = 60;
+  dotname::SunStateEngine engine (p);
+
+  auto night = engine.nextTransition (utc (2025, 12, 21, 12, 0));
+  ASSERT_TRUE (night.found);
+  EXPECT_TRUE (night.toLight);
+  EXPECT_GT (night.at, utc (2026, 2, 10, 0, 0));
+  EXPECT_LT (night.at, utc (2026, 2, 25, 0, 0));
+
+  auto day = engine.nextTransition (utc (2025, 6, 21, 12, 0));
+  ASSERT_TRUE (day.found);
+  EXPECT_FALSE (day.toLight);
+  EXPECT_GT (day.at, utc (2025, 8, 15, 0, 0));
+  EXPECT_LT (day.at, utc (2025, 8, 31, 0, 0));
+}
+
+TEST (SunState, NextTransitionAtLocalMidnight) {
+  dotname::SunStateParams p;
+  p.lat = 69.65; // Tromsø, the end of the polar day
+  p.lon = 18.96;
+  p.utcOffsetMinutes = 120;
+  dotname::SunStateEngine engine (p);
+
+  // 2025-07-27 is still midnight sun, 07-28 has a sunset: dark from its 00:00 on
+  auto next = engine.nextTransition (utc (2025, 7, 27, 20, 0));
+  ASSERT_TRUE (next.found);
+  EXPECT_FALSE (next.toLight);
+  EXPECT_EQ (next.at, utc (2025, 7, 27, 22, 0));
+
+  // every state change up to mid August is reported, none is skipped
+  auto t = utc (2025, 7, 20, 0, 0);
+  auto next2 = engine.nextTransition (t);
+  for (; t < utc (2025, 8, 15, 0, 0); t += std::chrono::minutes (10)) {
+    if (t >= next2.at)
+      next2 = engine.nextTransition (t);
+    ASSERT_TRUE (next2.found);
+    EXPECT_EQ (isDayAt (engine, t), !next2.toLight);
+  }
+}
@@ -0,0 +1,139 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/SunState.hpp>
+#include <SunrisetWorker/SunTimeline.hpp>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <ctime>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+  using Clock = std::chrono::system_clock;
+  namespace alt = dotname::SunAltitudes;
+
+  Clock::time_point utc (int y, int m, int d, int hh, int mm) {
+    std::tm t{};
+    t.tm_year = y - 1900;
+    t.tm_mon = m - 1;
+    t.tm_mday = d;
+    t.tm_hour = hh;
+    t.tm_min = mm;
+#ifdef _WIN32
+    return Clock::from_time_t (_mkgmtime (&t));
+#else
+    return Clock::from_time_t (timegm (&t));
+#endif
+  }
+
+  const std::vector<dotname::SunRule> kEvening {
+    { alt::AstronomicalTwilight, false, 0, "dark" },
+    { alt::GoldenHour, false, 0, "warm-palette" },
+    { alt::CivilTwilight, false, 0, "dim-wallpaper" },
+    { alt::CivilTwilight, false, 0, "dim-wallpaper" }, // duplicate
+    { alt::RiseSet, true, 0, "light" },
+  };
+
+} // namespace
+
+TEST (SunTimeline, PlanIsSortedAndDeduplicated) {
+  dotname::SunTimeline timeline (50.0755, 14.4378, 60, kEvening);
+  ASSERT_EQ (timeline.actions ().size (), 4u);
+
+  long day = timeline.localDay (utc (2025, 3, 20, 12, 0));
+  const auto& plan = timeline.plan (day);
+  std::vector<std::string> order;
+  for (const auto& e : plan)
+    order.push_back (timeline.action (e));
+  EXPECT_EQ (order,
+             (std::vector<std::string> { "light", "warm-palette", "dim-wallpaper", "dark" }));
+  for (std::size_t i = 1; i < plan.size (); ++i)
+    EXPECT_LT (plan[i - 1].at, plan[i].at);
+}
+
+TEST (SunTimeline, MatchesStateEngineTriggers) {
+  dotname::SunStateParams params;
+  params.lat = 50.0755;
+  params.lon = 14.4378;
+  params.utcOffsetMinutes = 120;
+  params.riseOffsetMinutes = -20;
+  params.setOffsetMinutes = 45;
+  dotname::SunTimeline timeline (params.lat, params.lon, params.utcOffsetMinutes,
+                                 { { alt::RiseSet, true, -20, "light" },
+                                   { alt::RiseSet, false, 45, "dark" } });
+  const dotname::SunStateEngine engine (params);
+
+  auto now = utc (2025, 6, 21, 0, 0);
+  for (int i = 0; i < 200; ++i) {
+    auto next = engine.nextTransition (now);
+    ASSERT_TRUE (next.found);
+    dotname::SunPlanEntry entry;
+    ASSERT_TRUE (timeline.latest (next.at, entry));
+    EXPECT_NEAR (std::chrono::duration<double> (entry.at - next.at).count (), 0.0, 0.01);
+    EXPECT_EQ (timeline.action (entry), next.toLight ? "light" : "dark");
+    now = next.at + std::chrono::seconds (1);
+  }
+}
+
+TEST (SunTimeline, PolarDatesHaveNoEntry) {
+  // Svalbard: no sunset in June, the twilights are not reached either
+  dotname::SunTimeline timeline (78.2, 15.6, 120, kEvening);
+  EXPECT_TRUE (timeline.plan (timeline.localDay (utc (2025, 6, 21, 12, 0))).empty ());
+  EXPECT_EQ (timeline.plan (timeline.localDay (utc (2025, 3, 20, 12, 0))).size (), 3u);
+}
+
+TEST (SunTimeline, FiresEveryEntryOnceInOrder) {
+  dotname::SunTimeline timeline (50.0755, 14.4378, 60, kEvening);
+  auto from = utc (2025, 1, 1, 0, 0);
+  auto to = utc (2025, 2, 1, 0, 0);
+
+  std::vector<dotname::SunPlanEntry> fired;
+  auto record = [&] (const dotname::SunPlanEntry& e) { fired.push_back (e); };
+  EXPECT_EQ (timeline.fire (from, record), 0u);
+  // irregular polling, as a timer with wakeup jitter
+  for (auto t = from; t < to; t += std::chrono::minutes (37))
+    timeline.fire (t, record);
+  timeline.fire (to, record);
+
+  std::vector<dotname::SunPlanEntry> expected;
+  for (long day = timeline.localDay (from) - 1; day <= timeline.localDay (to); ++day)
+    for (const auto& e : timeline.plan (day))
+      if (e.at > from && e.at <= to)
+        expected.push_back (e);
+  ASSERT_EQ (fired.size (), expected.size ());
+  for (std::size_t i = 0; i < fired.size (); ++i) {
+    EXPECT_EQ (fired[i].at, expected[i].at);
+    EXPECT_EQ (fired[i].action, expected[i].action);
+  }
+
+  // the timer needs no wakeups beyond the entries and local midnights
+  timeline.fire (to, record);
+  EXPECT_GT (timeline.nextAt (), to);
+  EXPECT_LE (timeline.nextAt (), to + std::chrono::hours (24));
+}
+
+TEST (SunTimeline, SuspendFiresLatestOnly) {
+  dotname::SunTimeline timeline (50.0755, 14.4378, 60, kEvening);
+  std::vector<std::string> fired;
+  auto record = [&] (const dotname::SunPlanEntry& e) { fired.push_back (timeline.action (e)); };
+  timeline.fire (utc (2025, 3, 1, 12, 0), record);
+  EXPECT_EQ (timeline.fire (utc (2025, 3, 5, 23, 30), record), 1u);
+  EXPECT_EQ (fired, std::vector<std::string> { "dark" });
+}
+
+TEST (SunTimeline, RunStops) {
+  dotname::SunTimeline timeline (50.0755, 14.4378, 60, kEvening);
+  std::thread runner ([&] { timeline.run ([] (const dotname::SunPlanEntry&) {}); });
+  timeline.stop ();
+  runner.join ();
+}
+
+TEST (SunTimeline, StopBeforeRunHolds) {
+  dotname::SunTimeline timeline (50.0755, 14.4378, 60, kEvening);
+  timeline.stop ();
+  timeline.run ([] (const dotname::SunPlanEntry&) {});
+}
@@ -0,0 +1,119 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/SunrisetBatch.hpp>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+extern "C" {
+#include "SunrisetC/sunriset.h"
+}
+
+namespace {
+
+  struct Points {
+    std::vector<int> days;
+    std::vector<double> lat, lon;
+  };
+
+  Points randomPoints (std::size_t n) {
+    Points p;
+    std::mt19937 rng (42);
+    std::uniform_int_distribution<int> day (dotname::dayNumber (1801, 1, 1),
+                                            dotname::dayNumber (2099, 12, 31));
+    std::uniform_real_distribution<double> lat (-89.0, 89.0), lon (-180.0, 180.0);
+    for (std::size_t i = 0; i < n; ++i) {
+      p.days.push_back (day (rng));
+      p.lat.push_back (lat (rng));
+      p.lon.push_back (lon (rng));
+    }
+    return p;
+  }
+
+  void expectMatchesScalar (dotname::SimdIsa isa) {
+    const std::size_t n = 10007; // odd count exercises the tail path
+    Points p = randomPoints (n);
+    std::vector<double> rRise (n), rSet (n), rise (n), set (n);
+    std::vector<int> rRc (n), rc (n);
+    dotname::sunRiseSetBatch (p.days.data (), p.lat.data (), p.lon.data (), n, rRise.data (),
+                              rSet.data (), rRc.data (), dotname::SimdIsa::Scalar);
+    dotname::sunRiseSetBatch (p.days.data (), p.lat.data (), p.lon.data (), n, rise.data (),
+                              set.data (), rc.data (), isa);
+    int rcMismatch = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+      if (rc[i] != rRc[i]) {
+        ++rcMismatch; // only allowed right at the polar boundary
+        continue;
+      }
+      EXPECT_NEAR (rise[i], rRise[i], 1.0 / 3600.0) << dotname::simdIsaName (isa) << " #" << i;
+      EXPECT_NEAR (set[i], rSet[i], 1.0 / 3600.0) << dotname::simdIsaName (isa) << " #" << i;
+    }
+    EXPECT_LE (rcMismatch, 2);
+  }
+
+} // namespace
+
+TEST (SunrisetBatch, DayNumberMatchesMacro) {
+  EXPECT_EQ (dotname::dayNumber (2000, 1, 1), 1);
+  EXPECT_EQ (dotname::dayNumber (1999, 12, 31), 0);
+  EXPECT_EQ (dotname::dayNumber (2025, 5, 20), days_since_2000_Jan_0 (2025, 5, 20));
+}
+
+TEST (SunrisetBatch, ScalarMatchesSunriset) {
+  int day = dotname::dayNumber (2025, 5, 20);
+  double lat = 50.0755, lon = 14.4378, rise, set, bRise, bSet;
+  int bRc;
+  int rc = sun_rise_set (2025, 5, 20, lon, lat, &rise, &set);
+  dotname::sunRiseSetBatch (&day, &lat, &lon, 1, &bRise, &bSet, &bRc, dotname::SimdIsa::Scalar);
+  EXPECT_EQ (rc, bRc);
+  EXPECT_DOUBLE_EQ (rise, bRise);
+  EXPECT_DOUBLE_EQ (set, bSet);
+}
+
+TEST (SunrisetBatch, Sse2MatchesScalar) {
+  expectMatchesScalar (dotname::SimdIsa::Sse2);
+}
+
+TEST (SunrisetBatch, Avx2MatchesScalar) {
+  expectMatchesScalar (dotname::SimdIsa::Avx2);
+}
+
+TEST (SunrisetBatch, Avx512MatchesScalar) {
+  expectMatchesScalar (dotname::SimdIsa::Avx512);
+}
+
+TEST (SunrisetBatch, Float32WithinSeconds) {
+  const std::size_t n = 4099;
+  Points p = randomPoints (n);
+  std::vector<float> lat (p.lat.begin (), p.lat.end ()), lon (p.lon.begin (), p.lon.end ());
+  std::vector<double> rRise (n), rSet (n);
+  std::vector<float> rise (n), set (n);
+  std::vector<int> rRc (n), rc (n);
+  dotname::sunRiseSetBatch (p.days.data (), p.lat.data (), p.lon.data (), n, rRise.data (),
+                            rSet.data (), rRc.data (), dotname::SimdIsa::Scalar);
+  dotname::sunRiseSetBatch (p.days.data (), lat.data (), lon.data (), n, rise.data (), set.data (),
+                            rc.data ());
+
+  // transit may land on the other side of the 0/24 h wrap, compare on the clock face
+  auto diffSeconds = [] (double a, double b) {
+    double h = std::fmod (std::fabs (a - b), 24.0);
+    return std::min (h, 24.0 - h) * 3600.0;
+  };
+  double sum = 0.0, worst = 0.0;
+  std::size_t k = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    if (rc[i] != 0 || rRc[i] != 0)
+      continue;
+    double e = std::max (diffSeconds (rise[i], rRise[i]), diffSeconds (set[i], rSet[i]));
+    sum += e * e;
+    worst = std::max (worst, e);
+    ++k;
+  }
+  ASSERT_GT (k, 0u);
+  EXPECT_LT (std::sqrt (sum / k), 5.0);
+  EXPECT_LT (worst, 300.0); // close to polar day/night acos gets steep
+}
@@ -0,0 +1,41 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __TEMPDIR_HPP
+#define __TEMPDIR_HPP
+
+// A fresh directory per test (mkdtemp), removed again with the object
+
+#include <cstdlib>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+
+class TempDir {
+public:
+  TempDir () {
+    std::string name = (std::filesystem::temp_directory_path () / "followsun-XXXXXX").string ();
+    if (::mkdtemp (name.data ()) == nullptr)
+      throw std::runtime_error ("mkdtemp failed in " + name);
+    path_ = name;
+  }
+  ~TempDir () {
+    std::error_code ec;
+    std::filesystem::remove_all (path_, ec);
+  }
+
+  TempDir (const TempDir&) = delete;
+  TempDir& operator= (const TempDir&) = delete;
+
+  const std::filesystem::path& path () const {
+    return path_;
+  }
+  std::filesystem::path operator/ (const std::string& name) const {
+    return path_ / name;
+  }
+
+private:
+  std::filesystem::path path_;
+};
+
+#endif // __TEMPDIR_HPP
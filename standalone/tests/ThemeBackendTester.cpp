@@ -0,0 +1,130 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/ThemeBackend.hpp>
+#include <gtest/gtest.h>
+
+#include "TempDir.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+  class CountingBackend : public dotname::ThemeBackend {
+  public:
+    std::string name () const override {
+      return "counting";
+    }
+    int apply (bool lightTheme, dotname::ThemeDeadline) override {
+      (lightTheme ? light : dark)++;
+      return 0;
+    }
+    std::atomic<int> light { 0 }, dark { 0 };
+  };
+
+  std::unique_ptr<dotname::ThemeBackend> sleeper (const std::string& seconds) {
+    return std::make_unique<dotname::CommandBackend> (
+        "sleep " + seconds, std::vector<dotname::CommandBackend::Command> { { "sleep", seconds } },
+        std::vector<dotname::CommandBackend::Command> { { "sleep", seconds } });
+  }
+
+} // namespace
+
+TEST (ThemeBackend, Factory) {
+  for (const char* name : { "gnome", "gsettings", "kde", "xfce" }) {
+    auto backend = dotname::makeThemeBackend (name);
+    ASSERT_NE (backend, nullptr) << name;
+    EXPECT_EQ (backend->name (), name);
+  }
+  EXPECT_EQ (dotname::makeThemeBackend ("cde"), nullptr);
+}
+
+TEST (ThemeBackend, InProcessBackend) {
+  dotname::ThemeBackendRegistry registry;
+  auto counting = std::make_unique<CountingBackend> ();
+  CountingBackend* raw = counting.get ();
+  registry.add (std::move (counting));
+  auto results = registry.apply (false, std::chrono::milliseconds (1000));
+  ASSERT_EQ (results.size (), 1u);
+  EXPECT_EQ (results[0].name, "counting");
+  EXPECT_EQ (results[0].rc, 0);
+  EXPECT_EQ (raw->dark, 1);
+  EXPECT_EQ (raw->light, 0);
+}
+
+TEST (ThemeBackend, AppliesOnlyTheNamed) {
+  dotname::ThemeBackendRegistry registry;
+  auto counting = std::make_unique<CountingBackend> ();
+  CountingBackend* raw = counting.get ();
+  registry.add (std::move (counting));
+  registry.add (dotname::makeThemeBackend ("kde"));
+  EXPECT_EQ (registry.names (), (std::vector<std::string> { "counting", "kde" }));
+  auto results = registry.apply (true, std::chrono::milliseconds (1000), { "counting" });
+  ASSERT_EQ (results.size (), 1u);
+  EXPECT_EQ (results[0].name, "counting");
+  EXPECT_EQ (raw->light, 1);
+  EXPECT_TRUE (registry.apply (true, std::chrono::milliseconds (1000), {}).empty ());
+}
+
+#if !defined(_WIN32)
+
+TEST (ThemeBackend, RunsConcurrently) {
+  dotname::ThemeBackendRegistry registry;
+  for (int i = 0; i < 3; ++i)
+    registry.add (sleeper ("0.3"));
+
+  auto start = std::chrono::steady_clock::now ();
+  auto results = registry.apply (true, std::chrono::milliseconds (5000));
+  auto elapsed = std::chrono::steady_clock::now () - start;
+
+  ASSERT_EQ (results.size (), 3u);
+  for (const auto& result : results) {
+    EXPECT_EQ (result.rc, 0) << result.name;
+    EXPECT_GE (result.latency, std::chrono::milliseconds (290));
+  }
+  // the slowest backend, not the sum (0.9 s)
+  EXPECT_LT (elapsed, std::chrono::milliseconds (800));
+}
+
+TEST (ThemeBackend, TimeoutKillsCommand) {
+  dotname::ThemeBackendRegistry registry;
+  registry.add (sleeper ("10"));
+  registry.add (sleeper ("0"));
+  auto start = std::chrono::steady_clock::now ();
+  auto results = registry.apply (false, std::chrono::milliseconds (200));
+  EXPECT_LT (std::chrono::steady_clock::now () - start, std::chrono::seconds (2));
+  EXPECT_EQ (results[0].rc, dotname::kThemeBackendTimedOut);
+  EXPECT_EQ (results[1].rc, 0);
+
+  dotname::CommandBackend missing ("missing", { { "followsun-no-such-program" } }, {});
+  EXPECT_EQ (missing.apply (true, std::chrono::steady_clock::now () + std::chrono::seconds (1)),
+             -1);
+}
+
+TEST (ThemeBackend, HooksGetTheTheme) {
+  TempDir dir;
+  auto out = dir / "out.txt";
+  {
+    std::ofstream hook (dir / "10-record");
+    hook << "#!/bin/sh\necho \"$1\" > '" << out.string () << "'\n";
+  }
+  std::filesystem::permissions (dir / "10-record", std::filesystem::perms::owner_all);
+  std::ofstream (dir / "README") << "not executable\n";
+
+  dotname::ThemeBackendRegistry registry;
+  ASSERT_EQ (registry.addHooks (dir.path ()), 1u);
+  auto results = registry.apply (false, std::chrono::milliseconds (5000));
+  ASSERT_EQ (results.size (), 1u);
+  EXPECT_EQ (results[0].name, "hook:10-record");
+  EXPECT_EQ (results[0].rc, 0);
+  std::string theme;
+  std::ifstream (out) >> theme;
+  EXPECT_EQ (theme, "dark");
+}
+
+#endif
@@ -0,0 +1,130 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/ThemeState.hpp>
+#include <gtest/gtest.h>
+
+#include "TempDir.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+  const std::vector<std::string> kGnome { "gnome" };
+
+  // what SunrisetWorker::applyTheme () does with the backends' results
+  int switchTo (dotname::ThemeState& state, bool lightTheme, const std::string& failing = {}) {
+    for (const auto& name : state.pending (lightTheme))
+      state.record (name, lightTheme, name != failing);
+    return state.applied ();
+  }
+
+} // namespace
+
+TEST (ThemeState, OnlyTransitionsSwitch) {
+  dotname::ThemeState state; // in memory
+  state.setBackends (kGnome);
+  EXPECT_FALSE (state.known ("gnome"));
+  EXPECT_TRUE (state.needsSwitch (false));
+  switchTo (state, false);
+  EXPECT_FALSE (state.needsSwitch (false));
+  EXPECT_FALSE (state.needsSwitch (false));
+  EXPECT_TRUE (state.needsSwitch (true));
+  switchTo (state, true);
+  EXPECT_TRUE (state.lightTheme ("gnome"));
+  EXPECT_EQ (state.stats ().applied, 2u);
+  EXPECT_EQ (state.stats ().skipped, 2u);
+}
+
+TEST (ThemeState, PersistsBetweenRuns) {
+  TempDir dir;
+  auto file = dir / "themestate.json";
+  {
+    dotname::ThemeState first (file);
+    first.setBackends (kGnome);
+    EXPECT_FALSE (first.known ("gnome"));
+    ASSERT_TRUE (first.needsSwitch (true));
+    EXPECT_EQ (switchTo (first, true), 0);
+  }
+  {
+    dotname::ThemeState second (file); // the next one-shot run
+    second.setBackends (kGnome);
+    ASSERT_TRUE (second.known ("gnome"));
+    EXPECT_TRUE (second.lightTheme ("gnome"));
+    EXPECT_FALSE (second.needsSwitch (true));
+  }
+  // the skip did not touch the file
+  dotname::ThemeState third (file);
+  third.setBackends (kGnome);
+  EXPECT_EQ (third.stats ().applied, 1u);
+  EXPECT_EQ (third.stats ().skipped, 0u);
+  EXPECT_TRUE (third.needsSwitch (false));
+}
+
+TEST (ThemeState, SkipsWriteNothing) {
+  TempDir dir;
+  auto file = dir / "themestate.json";
+  dotname::ThemeState state (file);
+  state.setBackends (kGnome);
+  ASSERT_EQ (switchTo (state, false), 0);
+  std::filesystem::remove (file);
+  for (int i = 0; i < 3; ++i)
+    EXPECT_FALSE (state.needsSwitch (false));
+  EXPECT_FALSE (std::filesystem::exists (file));
+
+  // the next applied switch stores the skips along with it
+  ASSERT_EQ (switchTo (state, true), 0);
+  dotname::ThemeState reread (file);
+  EXPECT_EQ (reread.stats ().skipped, 3u);
+}
+
+TEST (ThemeState, FailedBackendIsRetried) {
+  TempDir dir;
+  auto file = dir / "themestate.json";
+  {
+    dotname::ThemeState state (file);
+    state.setBackends ({ "gnome", "kde" });
+    ASSERT_EQ (switchTo (state, false, "kde"), 0);
+    EXPECT_FALSE (state.known ("kde"));
+    EXPECT_EQ (state.pending (false), std::vector<std::string> { "kde" });
+  }
+  dotname::ThemeState next (file);
+  next.setBackends ({ "gnome", "kde" });
+  ASSERT_TRUE (next.needsSwitch (false));
+  EXPECT_EQ (next.pending (false), std::vector<std::string> { "kde" });
+}
+
+TEST (ThemeState, OtherBackendsDropTheState) {
+  dotname::ThemeState state;
+  state.setBackends (kGnome);
+  switchTo (state, true);
+  state.setBackends (kGnome); // the same set keeps it
+  EXPECT_FALSE (state.needsSwitch (true));
+
+  state.setBackends ({ "gnome", "kde" });
+  EXPECT_FALSE (state.known ("gnome"));
+  EXPECT_EQ (state.pending (true), (std::vector<std::string> { "gnome", "kde" }));
+}
+
+TEST (ThemeState, ForgetSwitchesAgain) {
+  dotname::ThemeState state;
+  state.setBackends (kGnome);
+  switchTo (state, true);
+  state.forget (); // e.g. unlocked, the user may have flipped the theme meanwhile
+  EXPECT_TRUE (state.needsSwitch (true));
+}
+
+TEST (ThemeState, CorruptFileIsUnknown) {
+  TempDir dir;
+  auto file = dir / "themestate.json";
+  std::ofstream (file) << "{ not json";
+  dotname::ThemeState state (file);
+  state.setBackends (kGnome);
+  EXPECT_FALSE (state.known ("gnome"));
+  EXPECT_TRUE (state.needsSwitch (false));
+  EXPECT_EQ (switchTo (state, false), 0);
+  EXPECT_TRUE (dotname::ThemeState (file).known ("gnome"));
+}
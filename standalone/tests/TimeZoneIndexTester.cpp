@@ -0,0 +1,125 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/TimeZoneIndex.hpp>
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+  std::string zoneAt (double lat, double lon) {
+    return dotname::timeZoneInfo (dotname::timeZoneAt (lat, lon)).name;
+  }
+
+} // namespace
+
+TEST (TimeZoneIndex, KnownPlaces) {
+  EXPECT_EQ (zoneAt (50.0755, 14.4378), "Europe/Prague");
+  EXPECT_EQ (zoneAt (48.1486, 17.1077), "Europe/Bratislava");
+  EXPECT_EQ (zoneAt (40.7128, -74.0060), "America/New_York");
+  EXPECT_EQ (zoneAt (34.0522, -118.2437), "America/Los_Angeles");
+  EXPECT_EQ (zoneAt (35.6762, 139.6503), "Asia/Tokyo");
+  EXPECT_EQ (zoneAt (-33.8688, 151.2093), "Australia/Sydney");
+  EXPECT_EQ (zoneAt (64.1466, -21.9426), "Atlantic/Reykjavik");
+
+  const auto& prague = dotname::timeZoneInfo (dotname::timeZoneAt (50.0755, 14.4378));
+  EXPECT_EQ (prague.standardOffsetMinutes, 60);
+  EXPECT_FALSE (prague.nautical);
+  EXPECT_EQ (zoneAt (28.6139, 77.2090), "Asia/Kolkata"); // New Delhi
+  EXPECT_EQ (zoneAt (31.5204, 74.3587), "Asia/Karachi"); // Lahore
+  EXPECT_EQ (zoneAt (39.9042, 116.4074), "Asia/Shanghai");
+  EXPECT_EQ (zoneAt (41.8781, -87.6298), "America/Chicago");
+  // the nearest reference location alone would put these into a neighbour's zone
+  EXPECT_EQ (zoneAt (42.2406, -8.7207), "Europe/Madrid"); // Vigo
+  EXPECT_EQ (zoneAt (42.8782, -8.5448), "Europe/Madrid"); // Santiago de Compostela
+  EXPECT_EQ (zoneAt (38.8794, -6.9707), "Europe/Madrid"); // Badajoz
+  EXPECT_EQ (zoneAt (41.1579, -8.6291), "Europe/Lisbon"); // Porto
+  EXPECT_EQ (zoneAt (48.3904, -4.4861), "Europe/Paris"); // Brest
+  EXPECT_EQ (zoneAt (49.4542, -2.5369), "Europe/Guernsey"); // St Peter Port
+  EXPECT_EQ (zoneAt (59.3797, 28.1791), "Europe/Tallinn"); // Narva
+  EXPECT_EQ (zoneAt (59.3706, 28.2189), "Europe/Moscow"); // Ivangorod
+  EXPECT_EQ (zoneAt (54.3520, 18.6466), "Europe/Warsaw"); // Gdańsk
+  EXPECT_EQ (zoneAt (53.6694, 23.8131), "Europe/Minsk"); // Hrodna
+  EXPECT_EQ (zoneAt (65.8355, 24.1368), "Europe/Stockholm"); // Haparanda
+  EXPECT_EQ (zoneAt (65.8481, 24.1466), "Europe/Helsinki"); // Tornio
+  EXPECT_EQ (zoneAt (47.6588, -117.4260), "America/Los_Angeles"); // Spokane
+  // Brno is nearer to Vienna's reference location: a neighbour, with the same offset
+  EXPECT_EQ (dotname::timeZoneInfo (dotname::timeZoneAt (49.1951, 16.6068)).standardOffsetMinutes,
+             60);
+}
+
+#ifndef _WIN32
+TEST (TimeZoneIndex, SystemZoneFromTz) {
+  const char* saved = std::getenv ("TZ");
+  const std::string previous = saved ? saved : "";
+  ::setenv ("TZ", ":Europe/Prague", 1);
+  EXPECT_EQ (dotname::systemTimeZone (), "Europe/Prague");
+  ::setenv ("TZ", "/usr/share/zoneinfo/posix/America/Chicago", 1);
+  EXPECT_EQ (dotname::systemTimeZone (), "America/Chicago");
+  if (saved)
+    ::setenv ("TZ", previous.c_str (), 1);
+  else
+    ::unsetenv ("TZ");
+}
+#endif
+
+TEST (TimeZoneIndex, NauticalZonesAtSea) {
+  // South Pacific, far from any reference location
+  auto id = dotname::timeZoneAt (-48.0, -125.0);
+  const auto& zone = dotname::timeZoneInfo (id);
+  EXPECT_TRUE (zone.nautical);
+  EXPECT_STREQ (zone.name, "Etc/GMT+8");
+  EXPECT_EQ (zone.standardOffsetMinutes, -480);
+  EXPECT_EQ (id, dotname::nauticalTimeZone (-125.0));
+
+  EXPECT_STREQ (dotname::timeZoneInfo (dotname::nauticalTimeZone (0.0)).name, "Etc/GMT");
+  EXPECT_STREQ (dotname::timeZoneInfo (dotname::nauticalTimeZone (180.0)).name, "Etc/GMT-12");
+  EXPECT_STREQ (dotname::timeZoneInfo (dotname::nauticalTimeZone (-180.0)).name, "Etc/GMT+12");
+  EXPECT_EQ (dotname::timeZoneInfo (dotname::nauticalTimeZone (22.6)).standardOffsetMinutes, 120);
+}
+
+TEST (TimeZoneIndex, IndexMatchesBruteForce) {
+  for (double cell : { 1.0, 4.0 }) {
+    dotname::TimeZoneIndex index (cell, 2);
+    EXPECT_EQ (index.cells (), static_cast<std::size_t> (180.0 / cell * 360.0 / cell));
+    // a few candidates per cell, not all of the locations
+    EXPECT_LT (index.candidates (), index.cells () * 8);
+
+    std::mt19937 rng (23);
+    std::uniform_real_distribution<double> lat (-90.0, 90.0), lon (-180.0, 180.0);
+    for (int i = 0; i < 200000; ++i) {
+      double a = lat (rng), b = lon (rng);
+      ASSERT_EQ (index.lookup (a, b), dotname::timeZoneAt (a, b)) << a << ", " << b;
+    }
+    // cell edges and the poles
+    for (double a : { -90.0, -89.5, 0.0, 45.0, 89.999, 90.0 })
+      for (double b : { -180.0, -0.0, 0.0, 14.0, 179.999, 180.0 })
+        EXPECT_EQ (index.lookup (a, b), dotname::timeZoneAt (a, b)) << a << ", " << b;
+  }
+}
+
+TEST (TimeZoneIndex, BatchLookup) {
+  dotname::TimeZoneIndex index;
+  std::vector<double> lat, lon;
+  for (double a = -89.5; a < 90.0; a += 0.5)
+    for (double b = -179.5; b < 180.0; b += 0.5) {
+      lat.push_back (a);
+      lon.push_back (b);
+    }
+  std::vector<dotname::TimeZoneId> zones (lat.size ());
+  index.lookup (lat.data (), lon.data (), lat.size (), zones.data (), 4);
+  for (std::size_t i = 0; i < zones.size (); i += 97)
+    ASSERT_EQ (zones[i], index.lookup (lat[i], lon[i]));
+  // every located zone with land around it turns up somewhere on a 0.5 degree grid
+  std::vector<bool> seen (dotname::timeZoneCount ());
+  for (auto zone : zones)
+    seen[zone] = true;
+  std::size_t count = 0;
+  for (bool s : seen)
+    count += s;
+  EXPECT_GT (count, 300u);
+}
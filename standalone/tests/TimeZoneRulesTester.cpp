@@ -0,0 +1,179 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <SunrisetWorker/SunrisetBatch.hpp>
+#include <SunrisetWorker/TimeZoneRules.hpp>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace {
+
+  std::int64_t utc (int y, int m, int d, int h, int min, int s = 0) {
+    std::tm tm {};
+    tm.tm_year = y - 1900;
+    tm.tm_mon = m - 1;
+    tm.tm_mday = d;
+    tm.tm_hour = h;
+    tm.tm_min = min;
+    tm.tm_sec = s;
+    return static_cast<std::int64_t> (timegm (&tm));
+  }
+
+  bool haveZone (const std::string& name) {
+    return std::filesystem::exists (dotname::zoneinfoDir () / name);
+  }
+
+  // the C library's answer, the reference the tables must reproduce
+  int libcOffset (std::int64_t t) {
+    std::time_t time = static_cast<std::time_t> (t);
+    std::tm tm {};
+    localtime_r (&time, &tm);
+    return static_cast<int> (tm.tm_gmtoff);
+  }
+
+} // namespace
+
+TEST (TimeZoneRules, PragueTransitions2025) {
+  if (!haveZone ("Europe/Prague"))
+    GTEST_SKIP () << "no tz database";
+  const dotname::TimeZoneRules* prague = dotname::timeZoneRules ("Europe/Prague");
+  ASSERT_NE (prague, nullptr);
+  EXPECT_EQ (prague, dotname::timeZoneRules ("Europe/Prague")); // parsed once
+  EXPECT_EQ (prague->offsetSecondsAt (utc (2025, 3, 30, 0, 59, 59)), 3600);
+  EXPECT_EQ (prague->offsetSecondsAt (utc (2025, 3, 30, 1, 0)), 7200);
+  EXPECT_EQ (prague->offsetSecondsAt (utc (2025, 10, 26, 0, 59, 59)), 7200);
+  EXPECT_EQ (prague->offsetSecondsAt (utc (2025, 10, 26, 1, 0)), 3600);
+  // far past the table, from the POSIX rule
+  EXPECT_EQ (prague->offsetSecondsAt (utc (2150, 7, 1, 12, 0)), 7200);
+  EXPECT_EQ (prague->offsetSecondsAt (utc (2150, 1, 1, 12, 0)), 3600);
+  EXPECT_EQ (prague->offsetMinutesAt (std::chrono::system_clock::from_time_t (
+                utc (2025, 6, 21, 12, 0))),
+             120);
+}
+
+TEST (TimeZoneRules, MatchesLocaltime) {
+  const char* zones[] = { "Europe/Prague",   "Australia/Sydney", "America/New_York",
+                          "America/Sao_Paulo", "Asia/Kolkata",   "Europe/Dublin",
+                          "Pacific/Chatham", "Etc/GMT-1" };
+  const char* saved = std::getenv ("TZ");
+  std::string previous = saved ? saved : "";
+  for (const char* zone : zones) {
+    if (!haveZone (zone))
+      continue;
+    const dotname::TimeZoneRules* rules = dotname::timeZoneRules (zone);
+    ASSERT_NE (rules, nullptr) << zone;
+    setenv ("TZ", (std::string (":") + zone).c_str (), 1);
+    tzset ();
+    // every 7 h 13 min from 1970 through 2120, off the hour so both sides of changes are hit
+    for (std::int64_t t = 0; t < utc (2120, 1, 1, 0, 0); t += 7 * 3600 + 13 * 60)
+      ASSERT_EQ (rules->offsetSecondsAt (t), libcOffset (t)) << zone << " at " << t;
+  }
+  if (saved)
+    setenv ("TZ", previous.c_str (), 1);
+  else
+    unsetenv ("TZ");
+  tzset ();
+}
+
+TEST (TimeZoneRules, PosixRules) {
+  dotname::TimeZoneRules rules;
+  ASSERT_EQ (rules.parsePosix ("CET-1CEST,M3.5.0,M10.5.0/3"), 0);
+  EXPECT_EQ (rules.offsetSecondsAt (utc (2024, 3, 31, 0, 59)), 3600);
+  EXPECT_EQ (rules.offsetSecondsAt (utc (2024, 3, 31, 1, 0)), 7200);
+  EXPECT_EQ (rules.offsetSecondsAt (utc (2024, 10, 27, 1, 0)), 3600);
+
+  // southern hemisphere, DST over the new year
+  ASSERT_EQ (rules.parsePosix ("AEST-10AEDT,M10.1.0,M4.1.0/3"), 0);
+  EXPECT_EQ (rules.offsetSecondsAt (utc (2025, 1, 15, 0, 0)), 11 * 3600);
+  EXPECT_EQ (rules.offsetSecondsAt (utc (2025, 7, 15, 0, 0)), 10 * 3600);
+  EXPECT_EQ (rules.offsetSecondsAt (utc (2025, 4, 5, 15, 59)), 11 * 3600);
+  EXPECT_EQ (rules.offsetSecondsAt (utc (2025, 4, 5, 16, 0)), 10 * 3600);
+
+  // no DST, a quoted name and minutes
+  ASSERT_EQ (rules.parsePosix ("<+0530>-5:30"), 0);
+  EXPECT_EQ (rules.offsetSecondsAt (utc (2025, 7, 1, 0, 0)), 19800);
+  EXPECT_EQ (rules.transitions (), 0u);
+
+  // no dates: the US default
+  ASSERT_EQ (rules.parsePosix ("EST5EDT"), 0);
+  EXPECT_EQ (rules.offsetSecondsAt (utc (2025, 3, 9, 6, 59)), -5 * 3600);
+  EXPECT_EQ (rules.offsetSecondsAt (utc (2025, 3, 9, 7, 0)), -4 * 3600);
+
+  // negative DST (Irish winter time) and a Julian day rule
+  ASSERT_EQ (rules.parsePosix ("IST-1GMT0,M10.5.0,M3.5.0/1"), 0);
+  EXPECT_EQ (rules.offsetSecondsAt (utc (2025, 1, 15, 0, 0)), 0);
+  EXPECT_EQ (rules.offsetSecondsAt (utc (2025, 7, 15, 0, 0)), 3600);
+  ASSERT_EQ (rules.parsePosix ("XST3XDT,J60/0,J300/0"), 0);
+  EXPECT_EQ (rules.offsetSecondsAt (utc (2024, 3, 1, 2, 59)), -3 * 3600); // J60 is Mar 1
+  EXPECT_EQ (rules.offsetSecondsAt (utc (2024, 3, 1, 3, 0)), -2 * 3600);
+
+  EXPECT_EQ (rules.parsePosix ("CET-1CEST,M13.5.0,M10.5.0"), -1);
+  EXPECT_EQ (rules.parsePosix ("C-1"), -1);
+  EXPECT_EQ (rules.parsePosix ("CET-1CEST,M3.5.0"), -1);
+  EXPECT_EQ (rules.offsetSecondsAt (0), 0); // left as UTC
+}
+
+TEST (TimeZoneRules, MalformedFiles) {
+  dotname::TimeZoneRules rules;
+  EXPECT_EQ (rules.parse ("not a tz file"), -1);
+  EXPECT_EQ (rules.load ("/nonexistent/zone"), -1);
+  EXPECT_EQ (dotname::timeZoneRules ("No/Such_Zone"), nullptr);
+  EXPECT_EQ (dotname::timeZoneRules ("../../etc/passwd"), nullptr);
+  EXPECT_EQ (dotname::timeZoneRules (""), nullptr);
+
+  if (!haveZone ("Europe/Prague"))
+    return;
+  std::ifstream in (dotname::zoneinfoDir () / "Europe/Prague", std::ios::binary);
+  std::string data ((std::istreambuf_iterator<char> (in)), std::istreambuf_iterator<char> ());
+  ASSERT_EQ (rules.parse (data), 0);
+  EXPECT_GT (rules.transitions (), 100u);
+  EXPECT_EQ (rules.rule (), "CET-1CEST,M3.5.0,M10.5.0/3");
+  EXPECT_EQ (rules.parse (data.substr (0, data.size () / 3)), -1);
+  EXPECT_EQ (rules.transitions (), 0u);
+}
+
+TEST (TimeZoneRules, BatchMatchesSingleLookups) {
+  if (!haveZone ("Australia/Sydney"))
+    GTEST_SKIP () << "no tz database";
+  const dotname::TimeZoneRules* sydney = dotname::timeZoneRules ("Australia/Sydney");
+  ASSERT_NE (sydney, nullptr);
+
+  // ascending, as a date range produces them, then shuffled by a stride
+  std::vector<std::int64_t> instants;
+  for (std::int64_t t = utc (2000, 1, 1, 0, 0); t < utc (2140, 1, 1, 0, 0); t += 86400 / 3)
+    instants.push_back (t);
+  std::vector<std::int64_t> strided;
+  for (std::size_t i = 0; i < instants.size (); ++i)
+    strided.push_back (instants[(i * 7919) % instants.size ()]);
+  for (const auto* input : { &instants, &strided }) {
+    std::vector<int> offsets (input->size ());
+    sydney->offsetsAt (input->data (), input->size (), offsets.data ());
+    for (std::size_t i = 0; i < input->size (); ++i)
+      ASSERT_EQ (offsets[i], sydney->offsetSecondsAt ((*input)[i])) << (*input)[i];
+  }
+
+  // UT hours of a date range to local hours
+  std::vector<int> days;
+  std::vector<double> ut, local;
+  for (int day = dotname::dayNumber (2025, 1, 1); day <= dotname::dayNumber (2025, 12, 31);
+       ++day) {
+    days.push_back (day);
+    ut.push_back (19.5); // 19:30 UT, the next local date in Sydney
+  }
+  local.resize (days.size ());
+  sydney->toLocalHours (days.data (), ut.data (), days.size (), local.data ());
+  EXPECT_DOUBLE_EQ (local.front (), 19.5 + 11.0); // AEDT
+  EXPECT_DOUBLE_EQ (local[180], 19.5 + 10.0);     // AEST in July
+  for (std::size_t i = 0; i < days.size (); ++i) {
+    std::int64_t t = utc (2025, 1, 1, 19, 30) + static_cast<std::int64_t> (i) * 86400;
+    ASSERT_DOUBLE_EQ (local[i], 19.5 + sydney->offsetSecondsAt (t) / 3600.0) << i;
+  }
+}
@@ -0,0 +1,59 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <Trace/Trace.hpp>
+#include <gtest/gtest.h>
+
+#include "TempDir.hpp"
+#include "Utils/Utils.hpp"
+
+#include <string>
+#include <thread>
+
+using DotNameUtils::FileIO::readFile;
+
+TEST (Trace, OffRecordsNothing) {
+  dotname::Trace::disable ();
+  ASSERT_FALSE (dotname::Trace::enabled ());
+  {
+    TRACE_SPAN ("never recorded");
+  }
+  EXPECT_EQ (dotname::Trace::flush (), 0);
+
+  TempDir dir;
+  dotname::Trace::enable (dir / "trace.json");
+  ASSERT_EQ (dotname::Trace::flush (), 0);
+  dotname::Trace::disable ();
+  EXPECT_EQ (readFile (dir / "trace.json").find ("never recorded"), std::string::npos);
+}
+
+TEST (Trace, WritesCompleteEvents) {
+  TempDir dir;
+  auto file = dir / "trace.json";
+  dotname::Trace::enable (file);
+  ASSERT_TRUE (dotname::Trace::enabled ());
+  {
+    TRACE_SPAN ("outer");
+    {
+      TRACE_SPAN (std::string ("inner ") + "\"quoted\"");
+    }
+    std::thread ([] { TRACE_SPAN ("worker"); }).join ();
+  }
+  dotname::Trace::complete ("before enable", 10, 25);
+  ASSERT_EQ (dotname::Trace::flush (), 0);
+  dotname::Trace::disable ();
+
+  std::string json = readFile (file);
+  EXPECT_NE (json.find ("\"traceEvents\""), std::string::npos);
+  EXPECT_NE (json.find ("\"name\":\"outer\""), std::string::npos);
+  EXPECT_NE (json.find ("\"name\":\"inner \\\"quoted\\\"\""), std::string::npos);
+  EXPECT_NE (json.find ("\"dur\":15"), std::string::npos);
+  EXPECT_NE (json.find ("\"ph\":\"X\""), std::string::npos);
+  // the worker thread gets a lane of its own
+  auto worker = json.find ("\"name\":\"worker\"");
+  ASSERT_NE (worker, std::string::npos);
+  auto event = json.rfind ('{', worker);
+  auto end = json.find ('}', worker);
+  EXPECT_EQ (json.substr (event, end - event).find ("\"tid\":1,"), std::string::npos);
+  EXPECT_EQ (json.substr (event, end - event).find ("\"tid\":1}"), std::string::npos);
+}